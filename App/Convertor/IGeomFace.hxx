@@ -56,6 +56,7 @@ public:
     TCollection_AsciiString GetSurfSymb() const{ return m_SurfSymb; }       /**< Get the surface type */
     vector<Standard_Real> GetPrmtList() const{return m_PrmtList;}           /**< Get the coefficients list */
     Standard_Boolean IsReversed() const {return m_bReverse;}                /**< The surface is reversed or not*/
+    void ReleaseData(){ m_SurfExpn.Clear(); vector<Standard_Real>().swap(m_PrmtList); } /**< Release the expression and coefficients kept in surface table */
 
 protected:    
 
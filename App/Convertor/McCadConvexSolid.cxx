@@ -16,8 +16,10 @@
 #include "../Tools/McCadEvaluator.hxx"
 
 
-McCadConvexSolid::McCadConvexSolid(const TopoDS_Solid & theSolid):TopoDS_Solid(theSolid)
+McCadConvexSolid::McCadConvexSolid(const TopoDS_Solid & theSolid, Standard_Boolean bShowProgress)
+    :TopoDS_Solid(theSolid)
 {
+    m_bShowProgress = bShowProgress;
     //m_FaceList = new TopTools_HSequenceOfShape;           // New a sequence to store the faces
     m_DiscPntList = new TColgp_HSequenceOfPnt;      // New a sequence to store the descrete points
     m_EdgePntList = new TColgp_HSequenceOfPnt;      // New a sequence to store the descrete points
@@ -65,8 +67,8 @@ void McCadConvexSolid::GenFacesList(const TopoDS_Solid & theSolid)
 {
     TopExp_Explorer exp;    // Traverse the faces of input solid
 
-    msg->sig_part_label(QString::fromLatin1("Generate the surface list"));
-    msg->sig_progress_part(0);    // Set the progress bar to 0
+    if(m_bShowProgress) msg->sig_part_label(QString::fromLatin1("Generate the surface list"));
+    if(m_bShowProgress) msg->sig_progress_part(0);    // Set the progress bar to 0
 
     Handle_TopTools_HSequenceOfShape face_list = new TopTools_HSequenceOfShape;
 
@@ -93,7 +95,7 @@ void McCadConvexSolid::GenFacesList(const TopoDS_Solid & theSolid)
 
 	pExtFace->SetDeflection(deflection);
         m_STLFaceList.push_back(pExtFace);        
-        msg->sig_progress_part(int(i*100/m_iNumOfFaces));           // Move the progress bar
+        if(m_bShowProgress) msg->sig_progress_part(int(i*100/m_iNumOfFaces));           // Move the progress bar
     }
 
     McCadStitchSurfaces tailor;     // stitch the surfaces with same geomtries and common edge
@@ -134,7 +136,7 @@ void McCadConvexSolid::GenFacesList(const TopoDS_Solid & theSolid)
             }
         }
     }
-    msg->sig_progress_part(100);    // Set the progress bar to 0
+    if(m_bShowProgress) msg->sig_progress_part(100);    // Set the progress bar to 0
 
 }
 
@@ -151,8 +153,8 @@ void McCadConvexSolid::GenFacesList(const TopoDS_Solid & theSolid)
 ************************************************************************/
 void McCadConvexSolid::AddAstSurfaces()
 {
-    msg->sig_part_label(QString::fromLatin1("Add assistant surfaces"));
-    msg->sig_progress_part(0);    // Set the progress bar to 0
+    if(m_bShowProgress) msg->sig_part_label(QString::fromLatin1("Add assistant surfaces"));
+    if(m_bShowProgress) msg->sig_progress_part(0);    // Set the progress bar to 0
     float fs = 100.0/m_STLFaceList.size();
 
     for (unsigned int i = 0; i < m_STLFaceList.size(); i++)
@@ -166,10 +168,10 @@ void McCadConvexSolid::AddAstSurfaces()
             /// Judge the auxiliary face whether can be add into auxiliary face list.*/
             JudgeAssistFaces(theAstFaceList);
         }
-        msg->sig_progress_part(int(fs*(i+1)));
+        if(m_bShowProgress) msg->sig_progress_part(int(fs*(i+1)));
     }
 
-    msg->sig_progress_part(100);    // Set the progress bar to 0
+    if(m_bShowProgress) msg->sig_progress_part(100);    // Set the progress bar to 0
 }
 
 
@@ -224,7 +226,7 @@ Bnd_Box McCadConvexSolid::GetBntBox()
 ************************************************************************/
 void McCadConvexSolid::GenDescPoints(Standard_Boolean bGenVoid)
 {
-    msg->sig_progress_part(0);    // Set the progress bar to 0
+    if(m_bShowProgress) msg->sig_progress_part(0);    // Set the progress bar to 0
     float fs = 100.0/m_STLFaceList.size();
 
     /* Generate sample points of the each face */
@@ -236,11 +238,11 @@ void McCadConvexSolid::GenDescPoints(Standard_Boolean bGenVoid)
             {
                 McCadExtBndFace *pExtFace = m_STLFaceList[i];
                 m_DiscPntList->Append(pExtFace->GetDiscPntList());    // Add the discrete point list of face into the one of solid
-                msg->sig_progress_part(int(fs*(i+1)));
+                if(m_bShowProgress) msg->sig_progress_part(int(fs*(i+1)));
             }
         }
     }
-    msg->sig_progress_part(100);    // Set the progress bar to 0
+    if(m_bShowProgress) msg->sig_progress_part(100);    // Set the progress bar to 0
 }
 
 
@@ -280,8 +282,8 @@ void McCadConvexSolid::GenTriangles(Standard_Boolean bGenVoid)
 ************************************************************************/
 void McCadConvexSolid::GenEdgePoints()
 {
-    msg->sig_part_label(QString::fromLatin1("Create the sample points of edges"));
-    msg->sig_progress_part(0);    // Set the progress bar to 0
+    if(m_bShowProgress) msg->sig_part_label(QString::fromLatin1("Create the sample points of edges"));
+    if(m_bShowProgress) msg->sig_progress_part(0);    // Set the progress bar to 0
     float fs = 100.0/m_STLFaceList.size();
 
     if (m_EdgePntList->IsEmpty())
@@ -290,10 +292,10 @@ void McCadConvexSolid::GenEdgePoints()
         {
             McCadExtBndFace *pExtFace = m_STLFaceList[i];
             m_EdgePntList->Append(pExtFace->GetEdgePntList());    // Add the discrete point list of edge into the one of solid           
-            msg->sig_progress_part(int(fs*(i+1)));
+            if(m_bShowProgress) msg->sig_progress_part(int(fs*(i+1)));
         }
     }
-    msg->sig_progress_part(100);    // Set the progress bar to 0
+    if(m_bShowProgress) msg->sig_progress_part(100);    // Set the progress bar to 0
 }
 
 
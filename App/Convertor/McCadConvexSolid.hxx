@@ -45,7 +45,7 @@ public:
     }
 
     McCadConvexSolid();  
-    McCadConvexSolid(const TopoDS_Solid & theSolid);
+    McCadConvexSolid(const TopoDS_Solid & theSolid, Standard_Boolean bShowProgress = Standard_True);
     ~McCadConvexSolid();
 
 private:
@@ -83,6 +83,7 @@ private:
     void MergeBndFaces(Standard_Boolean bMergeDiscPnt);     /**< Merge boundary surfaces */
 
     McCadMessager_Signal *msg;                              /**< Message */
+    Standard_Boolean m_bShowProgress;                       /**< Send the progress, not in the worker threads */
     vector<McCadTriangle* > m_TriangleList; // Lei Lu 201905
 
 public:
@@ -31,6 +31,8 @@
 
 McCadExtBndFace::McCadExtBndFace()
 {
+    m_bMeshed = Standard_False;
+    m_fDeflection = 0.0;
 }
 
 McCadExtBndFace::McCadExtBndFace(const TopoDS_Face &theFace):McCadExtFace(theFace)
@@ -39,6 +41,8 @@ McCadExtBndFace::McCadExtBndFace(const TopoDS_Face &theFace):McCadExtFace(theFac
     m_DiscPntList = new TColgp_HSequenceOfPnt;
     m_EdgePntList = new TColgp_HSequenceOfPnt;
     m_bFusedFace = Standard_False;
+    m_bMeshed = Standard_False;
+    m_fDeflection = 0.0;
 
     msg = McCadMessager_Signal::Instance();
 }
@@ -177,6 +181,8 @@ Handle_TColgp_HSequenceOfPnt McCadExtBndFace::GetDiscPntList()
 ******************************************************************************/
 Standard_Boolean McCadExtBndFace::GenTriangles(Standard_Real aDeflection)
 {
+    m_bMeshed = Standard_True;
+
     Handle(Poly_Triangulation) mesh;
     BRepAdaptor_Surface BS(*this,Standard_True);
     gp_Trsf T = BS.Trsf();
@@ -185,8 +191,17 @@ Standard_Boolean McCadExtBndFace::GenTriangles(Standard_Real aDeflection)
     try
     {
         TopLoc_Location loc;
-        BRepMesh_IncrementalMesh(*this, aDeflection);
         mesh = BRep_Tool::Triangulation(*this,loc);
+
+        /// The faces decomposed in the same run keep the meshes of decomposition,
+        /// they are reused if they are as fine as required, otherwise the face
+        /// is meshed again with the required deflection.
+        Standard_Boolean bReuse = !mesh.IsNull() && mesh->Deflection() <= aDeflection;
+        if (!bReuse)
+        {
+            BRepMesh_IncrementalMesh(*this, aDeflection);
+            mesh = BRep_Tool::Triangulation(*this,loc);
+        }
     }
     catch(...)
     {
@@ -243,19 +258,27 @@ void McCadExtBndFace::SetDeflection(Standard_Real def)
 }
 
 
+Standard_Real McCadExtBndFace::GetDeflection() const
+{
+    return m_fDeflection;
+}
+
+
 
 /** ***************************************************************************
-* @brief  Return the triangles list of face
+* @brief  Return the triangles list of face. The face is meshed only once, if
+*         the meshing failed it is not tried again, so the void cells reading
+*         the face in parallel do not change it.
 * @param
 * @return vector<McCadTriangle *>
 *
 * @date 13/05/2015
-* @modify 13/05/2015
+* @modify 19/10/2026
 * @author  Lei Lu
 ******************************************************************************/
 vector<McCadTriangle *> McCadExtBndFace::GetTriangleList()
 {
-	if (m_TriangleList.empty())
+	if (m_TriangleList.empty() && !m_bMeshed)
     {
 		GenTriangles(m_fDeflection);
         return m_TriangleList;
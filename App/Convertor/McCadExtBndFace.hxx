@@ -76,6 +76,7 @@ public:
     /**< Combine the triangles of two surfaces */
     void AddTriangles(McCadExtBndFace *&pFace);
     void SetDeflection(Standard_Real def);
+    Standard_Real GetDeflection() const;                        /**< Get the deflection of triangles */
 
 private:
 
@@ -86,6 +87,7 @@ private:
     
     vector<McCadTriangle *> m_TriangleList;
     Standard_Real m_fDeflection;
+    Standard_Boolean m_bMeshed;         /**< The face has been meshed or not */
 
 };
 
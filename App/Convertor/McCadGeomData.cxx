@@ -36,6 +36,11 @@
 #include "GProp_GProps.hxx"
 #include "BRepGProp.hxx"
 
+#include <omp.h>
+#include <Standard_Version.hxx>
+#include <Standard_Failure.hxx>
+#include <BRepBuilderAPI_Copy.hxx>
+
 // #include <STEPControl_Writer.hxx>
 //            STEPControl_Writer wrt;
 //            wrt.Transfer(theShape, STEPControl_AsIs);
@@ -105,6 +110,8 @@ McCadGeomData::~McCadGeomData()
         }
     }
     m_GeomSurfList.clear();
+    m_SurfHash.Clear();
+    m_SurfTable.Clear();
 
     vector<McCadTransfCard *>::iterator iterTrfCard;
     for (iterTrfCard = m_TransfCardList.begin(); iterTrfCard != m_TransfCardList.end(); ++iterTrfCard)
@@ -120,23 +127,6 @@ McCadGeomData::~McCadGeomData()
 
 
 
-/** ********************************************************************
-* @brief Calculate the weight of each surface according to the surface
-*        type and parameters.
-*
-* @param TCollection_AsciiString theFileName
-* @return void
-*
-* @date 31/8/2012
-* @author  Lei Lu
-***********************************************************************/
-Standard_Boolean compare(const IGeomFace * surfA, const IGeomFace * surfB)
-{
-    return surfA->Compare(surfB);
-}
-
-
-
 /** ********************************************************************
 * @brief Get the material solids from the input file read, and generate
 *        the surfaces list.
@@ -155,76 +145,101 @@ void McCadGeomData::InputData( Handle_TopTools_HSequenceOfShape & solid_list, St
     Standard_Integer iNumMatSolid = solid_list->Length();
     msg->sig_message_append(QString::fromLatin1(">>> %1 solids are read.").arg(iNumMatSolid));
 
-    float fs_main = 45.0/iNumMatSolid;   // Control the step of progress bar    
-    //msg->sig_progress_part(0);
-
+    /// Explode the compound solids into solids, record the input solid and the
+    /// lump number of each solid, the order is the same as the registration.
+    vector<TopoDS_Solid> lump_list;
+    vector<Standard_Integer> input_list;
+    vector<Standard_Integer> sub_list;
     for(int i = 1; i <= iNumMatSolid; i++)
     {
-        msg->sig_message_append(QString::fromLatin1("Processing the %1 solid of %2 solids....................%1/%2").arg(i).arg(iNumMatSolid));
-
-        //msg->sig_progress_part(int(fs_part*i));
-        msg->sig_progress_main(5+int(fs_main*i));
-
-        /// TopoDS_Shape theShape = theEntSeq->Value(i).GetSolid();
         TopoDS_Shape theShape = solid_list->Value(i);
-        TopExp_Explorer exp;
-
-        int j = 0;
-        /// If the solid is compound solid, explode each its lumps into solids firstly
         if( theShape.ShapeType() == TopAbs_COMPSOLID || theShape.ShapeType() == TopAbs_COMPOUND )
         {
-            McCadSolid * pSolidList = new McCadSolid();
+            int j = 0;
+            TopExp_Explorer exp;
             for(exp.Init(theShape,TopAbs_SOLID); exp.More(); exp.Next())
             {
                 j++;
-                TopoDS_Solid tmpSolid = TopoDS::Solid(exp.Current());
-                McCadConvexSolid *pConvexSolid = NULL;
-
-                Standard_Real solid_mass = McCadGeomTool::GetVolume(tmpSolid);
-                solid_mass = Abs(solid_mass);
-
-                if(solid_mass >= 0.01)        // Set the minimum volume tolerance
-                {
-                    pConvexSolid = new McCadConvexSolid(tmpSolid);
-                    pConvexSolid->SetVolume(solid_mass);
-                }
-                else
-                {
-                    msg->sig_message_append(QString::fromLatin1("Solid %1 Sub-solid %2 has small volume less than 0.01mm3: %3")
-                                     .arg(i).arg(j).arg(solid_mass));
-                    continue;
-                }
+                lump_list.push_back(TopoDS::Solid(exp.Current()));
+                input_list.push_back(i);
+                sub_list.push_back(j);
+            }
+        }
+        else if( theShape.ShapeType() == TopAbs_SOLID)
+        {
+            lump_list.push_back(TopoDS::Solid(theShape));
+            input_list.push_back(i);
+            sub_list.push_back(0);
+        }
+    }
 
-                AddGeomSurfList(pConvexSolid->GetSTLFaceList());    // Travelse the boundary faces, add in face list                
-                AddGeomAstSurfList(pConvexSolid->GetSTLFaceList()); // Judge whether need add auxiliary faces                
-                pSolidList->AddConvexSolid(pConvexSolid);           // Add the convex solid into a complicate solid                
+    /// The construction of convex solids are independent, they are built in
+    /// parallel. The surfaces are registered later in the input order, so the
+    /// surface and cell numbers are the same as the serial construction.
+    int iNumLump = lump_list.size();
+    vector<McCadConvexSolid *> convex_list(iNumLump, (McCadConvexSolid *)NULL);
+    vector<Standard_Real> volume_list(iNumLump, 0.0);
 
-                //pConvexSolid->DeleteRepeatFaces(bGenVoid);          // Delete the repeated faces of solid
+    float fs_main = iNumLump > 0 ? 45.0/iNumLump : 0.0;   // Control the step of progress bar
+    int iFinished = 0;
 
-                m_ConvexSolidList.push_back(pConvexSolid);          // Add the convex solid in the solid list
-                m_iNumSolid++;
-            }
-            m_SolidList.push_back(pSolidList);            
+#pragma omp parallel for schedule(dynamic)
+    for(int k = 0; k < iNumLump; k++)
+    {
+        /// Only the calling thread sends the messages to the dialog
+        Standard_Boolean bMaster = Standard_True;
+#ifdef _OPENMP
+        bMaster = (omp_get_thread_num() == 0);
+#endif
+        convex_list[k] = CrtConvexSolid(lump_list[k], volume_list[k], bMaster);
+
+        int iProgress = 0;
+#pragma omp critical(McCadGeomData_InputData)
+        {
+            iFinished++;
+            iProgress = iFinished;
         }
-        // If the solid is single solid, add to convex solid list directly
-        else if( theShape.ShapeType() == TopAbs_SOLID)
+        if(bMaster)
         {
-            TopoDS_Solid tmpSolid = TopoDS::Solid(solid_list->Value(i));
+            msg->sig_progress_main(5+int(fs_main*iProgress));
+        }
+    }
 
-            McCadSolid * pSolidList = new McCadSolid();
-            McCadConvexSolid *pConvexSolid = NULL;
+    /// Register the surfaces and the solids in the input order
+    unsigned int k = 0;
+    for(int i = 1; i <= iNumMatSolid; i++)
+    {
+        msg->sig_message_append(QString::fromLatin1("Processing the %1 solid of %2 solids....................%1/%2").arg(i).arg(iNumMatSolid));
 
-            Standard_Real solid_mass = McCadGeomTool::GetVolume(tmpSolid);
-            solid_mass = Abs(solid_mass);
-            if(solid_mass >= 0.01)        // Set the minimum volume tolerance
-            {               
-                pConvexSolid = new McCadConvexSolid(tmpSolid);
-                pConvexSolid->SetVolume(solid_mass);
-            }
-            else
+        TopoDS_Shape theShape = solid_list->Value(i);
+        Standard_Boolean bCompound = theShape.ShapeType() == TopAbs_COMPSOLID
+                                  || theShape.ShapeType() == TopAbs_COMPOUND;
+        if(!bCompound && theShape.ShapeType() != TopAbs_SOLID)
+        {
+            continue;
+        }
+
+        McCadSolid * pSolidList = new McCadSolid();
+        for(; k < lump_list.size() && input_list[k] == i; k++)
+        {
+            McCadConvexSolid *pConvexSolid = convex_list[k];
+            if(pConvexSolid == NULL)
             {
-                msg->sig_message_append(QString::fromLatin1("Solid %1 has small volume less than 0.01mm3: %3")
-                                 .arg(i).arg(solid_mass));
+                if(volume_list[k] >= 0.01)
+                {
+                    msg->sig_message_append(QString::fromLatin1("Solid %1 Sub-solid %2 can not be converted")
+                                     .arg(i).arg(sub_list[k]));
+                }
+                else if(bCompound)
+                {
+                    msg->sig_message_append(QString::fromLatin1("Solid %1 Sub-solid %2 has small volume less than 0.01mm3: %3")
+                                     .arg(i).arg(sub_list[k]).arg(volume_list[k]));
+                }
+                else
+                {
+                    msg->sig_message_append(QString::fromLatin1("Solid %1 has small volume less than 0.01mm3: %3")
+                                     .arg(i).arg(volume_list[k]));
+                }
                 continue;
             }
 
@@ -232,18 +247,80 @@ void McCadGeomData::InputData( Handle_TopTools_HSequenceOfShape & solid_list, St
             AddGeomAstSurfList(pConvexSolid->GetSTLFaceList()); // Judge whether need add auxiliary faces
             pSolidList->AddConvexSolid(pConvexSolid);           // Add the convex solid into a complicate solid
 
-            //pConvexSolid->DeleteRepeatFaces(bGenVoid);                  // Delete the repeated faces of solid
+            //pConvexSolid->DeleteRepeatFaces(bGenVoid);          // Delete the repeated faces of solid
 
-            m_ConvexSolidList.push_back(pConvexSolid);          // Add the convex solid in the solid list            
+            m_ConvexSolidList.push_back(pConvexSolid);          // Add the convex solid in the solid list
             m_iNumSolid++;
-            m_SolidList.push_back(pSolidList);            
         }
+
+        /// The single solid with small volume is not added as before
+        if(!bCompound && pSolidList->GetConvexSolidList().empty())
+        {
+            delete pSolidList;
+            pSolidList = NULL;
+            continue;
+        }
+        m_SolidList.push_back(pSolidList);
     }
     return;
 }
 
 
 
+/** ********************************************************************
+* @brief Calculate the volume and construct the convex solid, it is
+*        called by the worker threads. The solid is copied firstly, the
+*        decomposed solids share the faces with their neighbours, the
+*        faces can not be meshed by two threads at the same time.
+*
+* @param const TopoDS_Solid & theSolid
+*        Standard_Real & fVolume           The volume of solid
+*        Standard_Boolean bShowProgress    Send the progress or not
+* @return McCadConvexSolid *  NULL if the volume is too small or the
+*                             construction fails
+*
+* @date 19/10/2026
+* @author  agent
+*********************************************************************/
+McCadConvexSolid * McCadGeomData::CrtConvexSolid(const TopoDS_Solid & theSolid,
+                                                 Standard_Real & fVolume,
+                                                 Standard_Boolean bShowProgress)
+{
+    McCadConvexSolid *pConvexSolid = NULL;
+    try
+    {
+        TopoDS_Solid tmpSolid = theSolid;
+#ifdef _OPENMP
+#if OCC_VERSION_HEX >= 0x070200
+        BRepBuilderAPI_Copy copier(theSolid, Standard_True, Standard_True);   // Keep the meshes
+#else
+        BRepBuilderAPI_Copy copier(theSolid);
+#endif
+        tmpSolid = TopoDS::Solid(copier.Shape());
+#endif
+        fVolume = Abs(McCadGeomTool::GetVolume(tmpSolid));
+        if(fVolume >= 0.01)        // Set the minimum volume tolerance
+        {
+            pConvexSolid = new McCadConvexSolid(tmpSolid, bShowProgress);
+            pConvexSolid->SetVolume(fVolume);
+        }
+    }
+    catch(Standard_Failure)
+    {
+        Standard_Failure::Caught()->Print(cout);
+        cout << endl;
+        if(pConvexSolid != NULL)
+        {
+            delete pConvexSolid;
+            pConvexSolid = NULL;
+        }
+    }
+
+    return pConvexSolid;
+}
+
+
+
 /** ********************************************************************
 * @brief Traverse the boundary faces of solid and add into geometery
 *        surface list.
@@ -336,12 +413,15 @@ void McCadGeomData::AddInGeomFaceList(IGeomFace*& pGeomFace, McCadExtFace *& pEx
 {
     Standard_Boolean bExist = Standard_False; // Assume that the geometry surface didn't existed in the face list
 
-    /**< Travelse the geometry face list, add the new surface generated into the list.
-         if the face with same geometry is existed already,no need to add more */
-    vector<IGeomFace *>::iterator iterPos;
-    for (iterPos = m_GeomSurfList.begin(); iterPos != m_GeomSurfList.end(); ++iterPos)
+    /**< Travelse the surfaces near the new surface in the hash index, add the new surface
+         generated into the list. if the face with same geometry is existed already,no need
+         to add more. The candidates are in list order, the same one as traversing the list
+         is found. */
+    vector<Standard_Integer> index_list;
+    m_SurfHash.GetCandidates(pGeomFace, index_list);
+    for (unsigned int i = 0; i < index_list.size(); i++)
     {
-        IGeomFace * pIterFace = *iterPos;
+        IGeomFace * pIterFace = m_GeomSurfList.at(index_list[i]);
         if(pGeomFace->IsEqual( pIterFace ))
         {
             bExist = Standard_True;         /// The geometry suface has already existed in list.
@@ -374,6 +454,8 @@ void McCadGeomData::AddInGeomFaceList(IGeomFace*& pGeomFace, McCadExtFace *& pEx
         pGeomFace->SetSurfNum(iNum + 1);        //  Set the surface number, it is same to face number
 
         m_GeomSurfList.push_back(pGeomFace);    // Add the geometry surface into geometry face list.
+        m_SurfHash.Add(pGeomFace, iNum);        // Index the surface at its position in list.
+        m_SurfTable.Add(pGeomFace);             // Add the row of surface into surface table.
     }
 }
 
@@ -499,11 +581,31 @@ void McCadGeomData::SetManager(const McCadVoidCellManager * pManager)
 * @return void
 *
 * @date 31/8/2012
+* @modify 19/10/2026
 * @author  Lei Lu
 ***********************************************************************/
 void McCadGeomData::SortSurface()
 {
-    sort(m_GeomSurfList.begin(),m_GeomSurfList.end(),compare); // Sort the geometry surface list.
+    /// Sort the rows of surface table, and put the geometry surfaces in the same order.
+    vector<Standard_Integer> order_list;
+    m_SurfTable.Sort(order_list);
+
+    vector<IGeomFace *> sorted_list;
+    sorted_list.reserve(m_GeomSurfList.size());
+    for (unsigned int i = 0; i < order_list.size(); i++)
+    {
+        sorted_list.push_back(m_GeomSurfList.at(order_list[i]));
+    }
+    m_GeomSurfList.swap(sorted_list);
+
+    /// All the surfaces are added, the hash index is not needed any more. The
+    /// expressions and coefficients are in the surface table, the geometry
+    /// surfaces keep only the data read by the writers.
+    m_SurfHash.Clear();
+    for (unsigned int i = 0; i < m_GeomSurfList.size(); i++)
+    {
+        m_GeomSurfList.at(i)->ReleaseData();
+    }
     cout<<endl;
     cout<< "There are " <<m_GeomSurfList.size()<<" faces in face list"<<endl;
 }
@@ -523,18 +625,8 @@ void McCadGeomData::SortSurface()
 ***********************************************************************/
 void McCadGeomData::UpdateFaceNum()
 {
-    Standard_Integer iSurfNumNew;
-    Standard_Integer iSurfNumOld;
-
-    for(unsigned int i = 0; i < m_GeomSurfList.size(); i++)
-    {
-        IGeomFace * pFace = m_GeomSurfList.at(i);
-        iSurfNumNew = i+1;
-        iSurfNumOld = pFace->GetSurfNum();
-        GenMapSurfNum(iSurfNumOld,iSurfNumNew);
-    }
-
-    /** Update the face number of solids, voids and outer spaces. */
+    /** The new surface numbers are recorded in the surface table when sorting.
+        Update the face number of solids, voids and outer spaces. */
     for (unsigned int i = 0; i < m_SolidList.size(); i++)
     {
         McCadSolid * pSolid = m_SolidList.at(i);
@@ -614,37 +706,6 @@ Standard_Integer McCadGeomData::AddTransfCard(gp_Ax3 theAxis, gp_Pnt theApex)
 
 
 
-
-/** ********************************************************************
-* @brief Generate the map for store the old surface number and new
-*        surface number
-*
-* @param Standard_Integer iSurfNumOld
-*        Standard_Integer iSurfNumNew
-* @return Standard_Boolean
-*
-* @date 31/8/2012
-* @author  Lei Lu
-***********************************************************************/
-Standard_Boolean McCadGeomData::GenMapSurfNum(Standard_Integer iSurfNumOld,Standard_Integer iSurfNumNew)
-{
-    pair<Standard_Integer,Standard_Integer>(iSurfNumOld,iSurfNumNew);
-    pair<map<Standard_Integer,Standard_Integer>::iterator,bool> result;
-    result = m_mapSurfNum.insert(pair<Standard_Integer,Standard_Integer>(iSurfNumOld,iSurfNumNew));
-
-    if(result.second)
-    {
-        return Standard_True;
-    }
-    else
-    {
-        return Standard_False;
-    }
-}
-
-
-
-
 /** ********************************************************************
 * @brief Input the old surface number, given the new number
 *
@@ -656,19 +717,10 @@ Standard_Boolean McCadGeomData::GenMapSurfNum(Standard_Integer iSurfNumOld,Stand
 ***********************************************************************/
 Standard_Integer McCadGeomData::GetNewFaceNum(Standard_Integer iOldNum)
 {
-    /// get the the surface number of map, which records the old surface number
-    /// and new surface number after sorting.
-    map<Standard_Integer,Standard_Integer>::iterator iter;
-    iter = m_mapSurfNum.find(iOldNum);
-    Standard_Integer iNewFaceNum;
-
-    if (iter != m_mapSurfNum.end())
-    {
-        iNewFaceNum = iter->second;
-    }
-    else
+    /// get the new surface number recorded in surface table after sorting.
+    Standard_Integer iNewFaceNum = m_SurfTable.GetNewNum(iOldNum);
+    if (iNewFaceNum == 0)
     {
-        iNewFaceNum = 0;
         return iNewFaceNum;
     }
 
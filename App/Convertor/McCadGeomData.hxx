@@ -7,6 +7,8 @@
 #include "IGeomFace.hxx"
 #include "McCadGeomCone.hxx"
 #include "McCadSolid.hxx"
+#include "McCadGeomSurfHash.hxx"
+#include "McCadGeomSurfTable.hxx"
 
 #include <OSD_File.hxx>
 #include <vector>
@@ -50,9 +52,10 @@ private:
     McCadVoidCell * m_pOutVoid;                             /**< The out box of the whole model */
 
     vector <IGeomFace *> m_GeomSurfList;                    /**< Geometry surface list */    
+    McCadGeomSurfHash m_SurfHash;                           /**< Hash index of geometry surface list */
     vector <McCadTransfCard *> m_TransfCardList;            /**< Surface transf card List */
 
-    map<Standard_Integer,Standard_Integer> m_mapSurfNum;    /**< When sort the surface list, reset the surface number */
+    McCadGeomSurfTable m_SurfTable;                         /**< Compact table of geometry surface list */
 
 public:
 
@@ -80,15 +83,13 @@ private:
          generate the auxiliary faces and add them into geometry face list. */
     void AddGeomAstSurfList(const vector<McCadExtBndFace *> &theExtFaceList);
 
-    /**< Generate a map to record the old surface number of new one */
-    Standard_Boolean GenMapSurfNum(Standard_Integer,Standard_Integer);
     /**< Generate a geometry face */
     IGeomFace *GenGeomSurface(McCadExtFace *& pExtFace);
     /**< Add the generated geometry face to geometry face list */
     void AddInGeomFaceList(IGeomFace*& pGeomFace, McCadExtFace *& pExtFace);
-
-    /** Friend function which can be used to compare the weight of each surface and sort them */
-    friend Standard_Boolean compare(const IGeomFace * surfA, const IGeomFace * surfB);
+    /**< Construct the convex solid in the worker thread */
+    McCadConvexSolid * CrtConvexSolid(const TopoDS_Solid & theSolid, Standard_Real & fVolume,
+                                      Standard_Boolean bShowProgress);
 
 public:
 
@@ -0,0 +1,341 @@
+#include "McCadGeomSurfHash.hxx"
+
+#include "McCadGeomPlane.hxx"
+#include "McCadGeomCylinder.hxx"
+#include "McCadGeomCone.hxx"
+#include "McCadGeomSphere.hxx"
+#include "McCadGeomTorus.hxx"
+#include "McCadGeomRevolution.hxx"
+
+#include <math.h>
+#include <algorithm>
+
+#include <BRep_Tool.hxx>
+#include <GeomAdaptor_Surface.hxx>
+#include <TopLoc_Location.hxx>
+
+#include "../Tools/McCadConvertConfig.hxx"
+
+McCadGeomSurfHash::McCadGeomSurfHash()
+{
+}
+
+McCadGeomSurfHash::~McCadGeomSurfHash()
+{
+    m_BucketMap.clear();
+}
+
+
+
+/** ********************************************************************
+* @brief Clear the buckets, it is called when the positions of surface
+*        list are changed.
+*
+* @param
+* @return void
+*
+* @date 19/10/2026
+* @author  agent
+*********************************************************************/
+void McCadGeomSurfHash::Clear()
+{
+    m_BucketMap.clear();
+}
+
+
+
+/** ********************************************************************
+* @brief Add the surface into the bucket of its coefficients
+*
+* @param IGeomFace * pGeomFace
+*        Standard_Integer iIndex    Position in the geometry surface list
+* @return void
+*
+* @date 19/10/2026
+* @author  agent
+*********************************************************************/
+void McCadGeomSurfHash::Add(IGeomFace * pGeomFace, Standard_Integer iIndex)
+{
+    vector<long long> key_list;
+    GenCellKey(pGeomFace, Standard_False, key_list);
+    m_BucketMap[HashKey(pGeomFace->GetFaceType(), key_list)].push_back(iIndex);
+}
+
+
+
+/** ********************************************************************
+* @brief Get the surfaces which may be same as the given surface. The
+*        positions are sorted ascending, so IsEqual is called in the
+*        same order as traversing the whole list.
+*
+* @param IGeomFace * pGeomFace
+*        vector<Standard_Integer> & index_list
+* @return void
+*
+* @date 19/10/2026
+* @author  agent
+*********************************************************************/
+void McCadGeomSurfHash::GetCandidates(IGeomFace * pGeomFace,
+                                      vector<Standard_Integer> & index_list) const
+{
+    index_list.clear();
+
+    vector<long long> key_list;
+    GenCellKey(pGeomFace, Standard_False, key_list);
+    ProbeNeighbours(pGeomFace->GetFaceType(), key_list, 0, index_list);
+
+    /// The plane with opposite direction and parameter D is the same plane
+    if (pGeomFace->GetFaceType() == surfPlane)
+    {
+        GenCellKey(pGeomFace, Standard_True, key_list);
+        ProbeNeighbours(pGeomFace->GetFaceType(), key_list, 0, index_list);
+    }
+
+    sort(index_list.begin(), index_list.end());
+    index_list.erase(unique(index_list.begin(), index_list.end()), index_list.end());
+}
+
+
+
+/** ********************************************************************
+* @brief Add the surface of the face into the bucket of its coefficients.
+*        The decomposition compares the faces with IsSameSurfaces, which
+*        calls IsEqual of the geometry surfaces, so the same buckets hold.
+*
+* @param const TopoDS_Face & theFace
+*        Standard_Integer iIndex    Position in the face list
+* @return void
+*
+* @date 19/10/2026
+* @author  agent
+*********************************************************************/
+void McCadGeomSurfHash::Add(const TopoDS_Face & theFace, Standard_Integer iIndex)
+{
+    IGeomFace *pGeomFace = GenGeomFace(theFace);
+    if (NULL == pGeomFace)
+    {
+        return;     // IsSameSurfaces does not compare the other surfaces
+    }
+    Add(pGeomFace, iIndex);
+    delete pGeomFace;
+    pGeomFace = NULL;
+}
+
+
+
+/** ********************************************************************
+* @brief Get the faces which may be on the same surface as the given face
+*
+* @param const TopoDS_Face & theFace
+*        vector<Standard_Integer> & index_list
+* @return void
+*
+* @date 19/10/2026
+* @author  agent
+*********************************************************************/
+void McCadGeomSurfHash::GetCandidates(const TopoDS_Face & theFace,
+                                      vector<Standard_Integer> & index_list) const
+{
+    index_list.clear();
+
+    IGeomFace *pGeomFace = GenGeomFace(theFace);
+    if (NULL == pGeomFace)
+    {
+        return;
+    }
+    GetCandidates(pGeomFace, index_list);
+    delete pGeomFace;
+    pGeomFace = NULL;
+}
+
+
+
+/** ********************************************************************
+* @brief Create the geometry surface of the face in the same way as
+*        McCadGeomTool::IsSameSurfaces
+*
+* @param const TopoDS_Face & theFace
+* @return IGeomFace *
+*
+* @date 19/10/2026
+* @author  agent
+*********************************************************************/
+IGeomFace * McCadGeomSurfHash::GenGeomFace(const TopoDS_Face & theFace)
+{
+    TopLoc_Location loc;
+    Handle_Geom_Surface hGeom = BRep_Tool::Surface(theFace,loc);
+    GeomAdaptor_Surface GeomSurf(hGeom);
+
+    switch (GeomSurf.GetType())
+    {
+        case GeomAbs_Plane:
+            return new McCadGeomPlane(GeomSurf);
+        case GeomAbs_Cylinder:
+            return new McCadGeomCylinder(GeomSurf);
+        case GeomAbs_Cone:
+            return new McCadGeomCone(GeomSurf);
+        case GeomAbs_Sphere:
+            return new McCadGeomSphere(GeomSurf);
+        case GeomAbs_Torus:
+            return new McCadGeomTorus(GeomSurf);
+        case GeomAbs_SurfaceOfRevolution:
+            return new McCadGeomRevolution(GeomSurf);
+        default:
+            break;
+    }
+    return NULL;
+}
+
+
+
+/** ********************************************************************
+* @brief Quantise the coefficients compared by IsEqual of the surface.
+*        The distance cell is not smaller than the tolerance, the
+*        direction cell is larger than the angle tolerance, so two same
+*        surfaces differ at most one cell in each coefficient.
+*
+* @param IGeomFace * pGeomFace
+*        Standard_Boolean bOpposite      Use the opposite plane
+*        vector<long long> & key_list
+* @return void
+*
+* @date 19/10/2026
+* @author  agent
+*********************************************************************/
+void McCadGeomSurfHash::GenCellKey(IGeomFace * pGeomFace, Standard_Boolean bOpposite,
+                                   vector<long long> & key_list)
+{
+    key_list.clear();
+
+    Standard_Real dis_cell = McCadConvertConfig::GetTolerence();
+    if (dis_cell < 1.0e-7)
+    {
+        dis_cell = 1.0e-7;
+    }
+    Standard_Real dir_cell = 1.0e-2;
+
+    switch (pGeomFace->GetFaceType())
+    {
+        case surfPlane:
+        {
+            /// The plane is compared with the fixed distance tolerance
+            McCadGeomPlane *pPlane = (McCadGeomPlane*)pGeomFace;
+            Standard_Real fSign = bOpposite ? -1.0 : 1.0;
+            gp_Dir theDir = pPlane->GetDir();
+            key_list.push_back((long long)floor(fSign*pPlane->GetPrmtD()/1.0e-5));
+            key_list.push_back((long long)floor(fSign*theDir.X()/dir_cell));
+            key_list.push_back((long long)floor(fSign*theDir.Y()/dir_cell));
+            break;
+        }
+        case surfCylinder:
+        {
+            /// The axis can be opposite, use the absolute value of direction
+            McCadGeomCylinder *pCyln = (McCadGeomCylinder*)pGeomFace;
+            gp_Dir theDir = pCyln->GetAxisDir();
+            key_list.push_back((long long)floor(pCyln->GetRadius()/dis_cell));
+            key_list.push_back((long long)floor(fabs(theDir.X())/dir_cell));
+            key_list.push_back((long long)floor(fabs(theDir.Y())/dir_cell));
+            break;
+        }
+        case surfCone:
+        {
+            McCadGeomCone *pCone = (McCadGeomCone*)pGeomFace;
+            gp_Pnt theApex = pCone->GetApex();
+            key_list.push_back((long long)floor(theApex.X()/dis_cell));
+            key_list.push_back((long long)floor(theApex.Y()/dis_cell));
+            key_list.push_back((long long)floor(theApex.Z()/dis_cell));
+            key_list.push_back((long long)floor(pCone->GetSemiAngle()/dis_cell));
+            break;
+        }
+        case surfSphere:
+        {
+            McCadGeomSphere *pSphere = (McCadGeomSphere*)pGeomFace;
+            gp_Pnt theCenter = pSphere->GetCenter();
+            key_list.push_back((long long)floor(theCenter.X()/dis_cell));
+            key_list.push_back((long long)floor(theCenter.Y()/dis_cell));
+            key_list.push_back((long long)floor(theCenter.Z()/dis_cell));
+            key_list.push_back((long long)floor(pSphere->GetRadius()/dis_cell));
+            break;
+        }
+        case surfTorus:
+        {
+            McCadGeomTorus *pTorus = (McCadGeomTorus*)pGeomFace;
+            key_list.push_back((long long)floor(pTorus->GetMajorRadius()/dis_cell));
+            key_list.push_back((long long)floor(pTorus->GetMinorRadius()/dis_cell));
+            break;
+        }
+        case surfRev:
+        {
+            McCadGeomRevolution *pRev = (McCadGeomRevolution*)pGeomFace;
+            key_list.push_back((long long)floor(pRev->GetMajorRadius()/dis_cell));
+            key_list.push_back((long long)floor(pRev->GetMinorRadius()/dis_cell));
+            break;
+        }
+        default:
+            break;
+    }
+}
+
+
+
+/** ********************************************************************
+* @brief Combine the surface type and the quantised coefficients
+*
+* @param SurfType eType
+*        const vector<long long> & key_list
+* @return Standard_Size
+*
+* @date 19/10/2026
+* @author  agent
+*********************************************************************/
+Standard_Size McCadGeomSurfHash::HashKey(SurfType eType, const vector<long long> & key_list)
+{
+    Standard_Size iHash = (Standard_Size)eType + 1;
+    for (unsigned int i = 0; i < key_list.size(); i++)
+    {
+        unsigned long long iKey = (unsigned long long)key_list[i];
+        iKey ^= iKey >> 33;
+        iKey *= 0xff51afd7ed558ccdULL;
+        iKey ^= iKey >> 33;
+        iHash ^= (Standard_Size)iKey + 0x9e3779b9 + (iHash << 6) + (iHash >> 2);
+    }
+    return iHash;
+}
+
+
+
+/** ********************************************************************
+* @brief Collect the surfaces in the cells which differ at most one in
+*        each quantised coefficient, one dimension per recursion.
+*
+* @param SurfType eType
+*        vector<long long> & key_list       It is restored when returns
+*        unsigned int iDim
+*        vector<Standard_Integer> & index_list
+* @return void
+*
+* @date 19/10/2026
+* @author  agent
+*********************************************************************/
+void McCadGeomSurfHash::ProbeNeighbours(SurfType eType, vector<long long> & key_list,
+                                        unsigned int iDim, vector<Standard_Integer> & index_list) const
+{
+    if (iDim == key_list.size())
+    {
+        map<Standard_Size, vector<Standard_Integer> >::const_iterator iter
+                = m_BucketMap.find(HashKey(eType, key_list));
+        if (iter != m_BucketMap.end())
+        {
+            index_list.insert(index_list.end(), iter->second.begin(), iter->second.end());
+        }
+        return;
+    }
+
+    long long iKey = key_list[iDim];
+    for (long long iStep = -1; iStep <= 1; iStep++)
+    {
+        key_list[iDim] = iKey + iStep;
+        ProbeNeighbours(eType, key_list, iDim + 1, index_list);
+    }
+    key_list[iDim] = iKey;
+}
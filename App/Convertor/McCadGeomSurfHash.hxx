@@ -0,0 +1,70 @@
+#ifndef MCCADGEOMSURFHASH_HXX
+#define MCCADGEOMSURFHASH_HXX
+
+#include <map>
+#include <vector>
+#include <Standard.hxx>
+#include <TopoDS_Face.hxx>
+
+#include "IGeomFace.hxx"
+
+using namespace std;
+
+/** Hash index of the geometry surface list. The surface is put into a bucket
+    of its quantised coefficients, the plane with distance and direction, the
+    cylinder with radius and axis, the cone with apex and semi angle, the
+    sphere with center and radius, the torus and revolution with radii. The
+    cell size is not smaller than the tolerance of IsEqual, so the same surface
+    is always in the bucket or the neighbour buckets of the query. */
+class McCadGeomSurfHash
+{
+public:
+
+    void* operator new(size_t,void* anAddress)
+    {
+      return anAddress;
+    }
+    void* operator new(size_t size)
+    {
+      return Standard::Allocate(size);
+    }
+    void  operator delete(void *anAddress)
+    {
+      if (anAddress) Standard::Free((Standard_Address&)anAddress);
+    }
+
+    McCadGeomSurfHash();
+    ~McCadGeomSurfHash();
+
+public:
+
+    /**< Clear the buckets */
+    void Clear();
+    /**< Add the surface at the position of surface list */
+    void Add(IGeomFace * pGeomFace, Standard_Integer iIndex);
+    /**< Get the positions of surfaces near the given surface, sorted ascending */
+    void GetCandidates(IGeomFace * pGeomFace, vector<Standard_Integer> & index_list) const;
+    /**< Add the surface of the face at the position of face list */
+    void Add(const TopoDS_Face & theFace, Standard_Integer iIndex);
+    /**< Get the positions of faces which may be on the same surface, sorted ascending */
+    void GetCandidates(const TopoDS_Face & theFace, vector<Standard_Integer> & index_list) const;
+
+private:
+
+    map<Standard_Size, vector<Standard_Integer> > m_BucketMap;  /**< Surface positions of each bucket */
+
+private:
+
+    /**< Create the geometry surface of the face, NULL if the type is not supported */
+    static IGeomFace * GenGeomFace(const TopoDS_Face & theFace);
+    /**< Get the quantised coefficients of the surface, the opposite plane if bOpposite */
+    static void GenCellKey(IGeomFace * pGeomFace, Standard_Boolean bOpposite,
+                           vector<long long> & key_list);
+    /**< Hash the surface type and quantised coefficients into bucket key */
+    static Standard_Size HashKey(SurfType eType, const vector<long long> & key_list);
+    /**< Collect the surfaces of the bucket and its neighbour buckets */
+    void ProbeNeighbours(SurfType eType, vector<long long> & key_list,
+                         unsigned int iDim, vector<Standard_Integer> & index_list) const;
+};
+
+#endif // MCCADGEOMSURFHASH_HXX
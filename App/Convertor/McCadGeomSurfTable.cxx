@@ -0,0 +1,252 @@
+#include "McCadGeomSurfTable.hxx"
+
+#include <algorithm>
+
+#include "../Tools/McCadConvertConfig.hxx"
+
+McCadGeomSurfTable::McCadGeomSurfTable()
+{
+}
+
+McCadGeomSurfTable::~McCadGeomSurfTable()
+{
+    Clear();
+}
+
+
+
+/** ********************************************************************
+* @brief Clear the rows of the table
+*
+* @param
+* @return void
+*
+* @date 19/10/2026
+* @author  agent
+*********************************************************************/
+void McCadGeomSurfTable::Clear()
+{
+    m_TypeList.clear();
+    m_SequList.clear();
+    m_SymbIdxList.clear();
+    m_CoefList.clear();
+    m_CoefPosList.clear();
+    m_CoefNumList.clear();
+    m_TrNumList.clear();
+    m_NumList.clear();
+    m_NewNumList.clear();
+    m_SymbList.clear();
+}
+
+
+
+/** ********************************************************************
+* @brief Add the registered surface as a new row. The symbol sequence,
+*        the coefficients and the transform card are read once here.
+*
+* @param IGeomFace * pGeomFace
+* @return Standard_Integer     The row of the surface
+*
+* @date 19/10/2026
+* @author  agent
+*********************************************************************/
+Standard_Integer McCadGeomSurfTable::Add(IGeomFace * pGeomFace)
+{
+    Standard_Integer iRow = m_TypeList.size();
+
+    TCollection_AsciiString strSymb = pGeomFace->GetSurfSymb();
+    Standard_Integer iSymb = -1;
+    for (unsigned int i = 0; i < m_SymbList.size(); i++)
+    {
+        if (m_SymbList[i].IsEqual(strSymb))
+        {
+            iSymb = i;
+            break;
+        }
+    }
+    if (iSymb < 0)
+    {
+        iSymb = m_SymbList.size();
+        m_SymbList.push_back(strSymb);
+    }
+
+    m_TypeList.push_back(pGeomFace->GetFaceType());
+    m_SequList.push_back(McCadConvertConfig::GetSurfSequNum(strSymb));
+    m_SymbIdxList.push_back(iSymb);
+
+    /// The rows have different numbers of coefficients, none of them is dropped
+    const vector<Standard_Real> & prmt_list = pGeomFace->GetPrmtList();
+    m_CoefPosList.push_back(m_CoefList.size());
+    m_CoefNumList.push_back(prmt_list.size());
+    m_CoefList.insert(m_CoefList.end(), prmt_list.begin(), prmt_list.end());
+
+    TCollection_AsciiString strTrNum = pGeomFace->GetTransfNum();
+    m_TrNumList.push_back(strTrNum.IsIntegerValue() ? strTrNum.IntegerValue() : 0);
+    m_NumList.push_back(pGeomFace->GetSurfNum());
+
+    return iRow;
+}
+
+
+
+/** ********************************************************************
+* @brief Sort the rows by the sequence number of surface symbol and the
+*        first coefficient. The rows are compared as IGeomFace::Compare
+*        compares the surfaces, so the order is the same as sorting the
+*        geometry surface list. The new surface numbers are recorded.
+*
+* @param vector<Standard_Integer> & order_list   The old row of each new row
+* @return void
+*
+* @date 19/10/2026
+* @author  agent
+*********************************************************************/
+void McCadGeomSurfTable::Sort(vector<Standard_Integer> & order_list)
+{
+    Standard_Integer iSize = Size();
+
+    order_list.resize(iSize);
+    for (Standard_Integer i = 0; i < iSize; i++)
+    {
+        order_list[i] = i;
+    }
+    sort(order_list.begin(), order_list.end(), RowLess(this));
+
+    PermuteCoef(order_list);
+    Permute(m_TypeList, order_list);
+    Permute(m_SequList, order_list);
+    Permute(m_SymbIdxList, order_list);
+    Permute(m_TrNumList, order_list);
+    Permute(m_NumList, order_list);
+
+    /// The surface number given when registered is the row number plus one
+    m_NewNumList.assign(iSize, 0);
+    for (Standard_Integer i = 0; i < iSize; i++)
+    {
+        Standard_Integer iOldNum = m_NumList[i];
+        if (iOldNum > 0 && iOldNum <= iSize)
+        {
+            m_NewNumList[iOldNum-1] = i+1;
+        }
+    }
+}
+
+
+
+/** ********************************************************************
+* @brief Get the new surface number of the old surface number
+*
+* @param Standard_Integer iOldNum
+* @return Standard_Integer
+*
+* @date 19/10/2026
+* @author  agent
+*********************************************************************/
+Standard_Integer McCadGeomSurfTable::GetNewNum(Standard_Integer iOldNum) const
+{
+    if (iOldNum <= 0 || iOldNum > (Standard_Integer)m_NewNumList.size())
+    {
+        return 0;
+    }
+    return m_NewNumList[iOldNum-1];
+}
+
+
+
+/** ********************************************************************
+* @brief Compare the sequence number of symbols, then the first
+*        coefficient of the surfaces
+*
+* @param Standard_Integer iRowA, Standard_Integer iRowB
+* @return bool
+*
+* @date 19/10/2026
+* @author  agent
+*********************************************************************/
+bool McCadGeomSurfTable::RowLess::operator()(Standard_Integer iRowA, Standard_Integer iRowB) const
+{
+    if (m_pTable->m_SequList[iRowA] != m_pTable->m_SequList[iRowB])
+    {
+        return m_pTable->m_SequList[iRowA] < m_pTable->m_SequList[iRowB];
+    }
+    return m_pTable->GetFirstCoef(iRowA) < m_pTable->GetFirstCoef(iRowB);
+}
+
+
+
+/** ********************************************************************
+* @brief The first coefficient of the row, it is the weight of sorting
+*
+* @param Standard_Integer i
+* @return Standard_Real
+*
+* @date 19/10/2026
+* @author  agent
+*********************************************************************/
+Standard_Real McCadGeomSurfTable::GetFirstCoef(Standard_Integer i) const
+{
+    if (m_CoefNumList[i] == 0)
+    {
+        return 0.0;
+    }
+    return m_CoefList[m_CoefPosList[i]];
+}
+
+
+
+/** ********************************************************************
+* @brief Reorder the rows of the array
+*
+* @param vector<T> & theList
+*        const vector<Standard_Integer> & order_list
+* @return void
+*
+* @date 19/10/2026
+* @author  agent
+*********************************************************************/
+template<class T>
+void McCadGeomSurfTable::Permute(vector<T> & theList, const vector<Standard_Integer> & order_list)
+{
+    vector<T> sorted_list;
+    sorted_list.reserve(theList.size());
+    for (unsigned int i = 0; i < order_list.size(); i++)
+    {
+        sorted_list.push_back(theList[order_list[i]]);
+    }
+    theList.swap(sorted_list);
+}
+
+
+
+/** ********************************************************************
+* @brief Reorder the coefficients of the rows, the rows have different
+*        numbers of coefficients, so the starts are given again
+*
+* @param const vector<Standard_Integer> & order_list
+* @return void
+*
+* @date 19/10/2026
+* @author  agent
+*********************************************************************/
+void McCadGeomSurfTable::PermuteCoef(const vector<Standard_Integer> & order_list)
+{
+    vector<Standard_Real> sorted_list;
+    vector<Standard_Integer> pos_list;
+    vector<Standard_Integer> num_list;
+    sorted_list.reserve(m_CoefList.size());
+    pos_list.reserve(order_list.size());
+    num_list.reserve(order_list.size());
+    for (unsigned int i = 0; i < order_list.size(); i++)
+    {
+        Standard_Integer iRow = order_list[i];
+        pos_list.push_back(sorted_list.size());
+        num_list.push_back(m_CoefNumList[iRow]);
+        for (Standard_Integer j = 0; j < m_CoefNumList[iRow]; j++)
+        {
+            sorted_list.push_back(m_CoefList[m_CoefPosList[iRow]+j]);
+        }
+    }
+    m_CoefList.swap(sorted_list);
+    m_CoefPosList.swap(pos_list);
+    m_CoefNumList.swap(num_list);
+}
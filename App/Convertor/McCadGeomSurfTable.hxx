@@ -0,0 +1,94 @@
+#ifndef MCCADGEOMSURFTABLE_HXX
+#define MCCADGEOMSURFTABLE_HXX
+
+#include <vector>
+#include <Standard.hxx>
+#include <TCollection_AsciiString.hxx>
+
+#include "IGeomFace.hxx"
+
+using namespace std;
+
+/** Compact table of the geometry surface list. Each registered surface is a
+    row of contiguous arrays: type code, sequence number of the surface symbol,
+    coefficients, transform card number and surface number. The coefficients of
+    all rows are in one array, each row records its start and count. The
+    sorting and renumbering run on the rows without virtual calls and string
+    copies, the geometry surface list is permuted in the same order, and the
+    surface card is written from the rows. */
+class McCadGeomSurfTable
+{
+public:
+
+    void* operator new(size_t,void* anAddress)
+    {
+      return anAddress;
+    }
+    void* operator new(size_t size)
+    {
+      return Standard::Allocate(size);
+    }
+    void  operator delete(void *anAddress)
+    {
+      if (anAddress) Standard::Free((Standard_Address&)anAddress);
+    }
+
+    McCadGeomSurfTable();
+    ~McCadGeomSurfTable();
+
+public:
+
+    /**< Clear the table */
+    void Clear();
+    /**< Add the row of the surface, return the row number */
+    Standard_Integer Add(IGeomFace * pGeomFace);
+    /**< Sort the rows by symbol sequence and first coefficient, give the old row of each new row */
+    void Sort(vector<Standard_Integer> & order_list);
+    /**< Get the new surface number after sorting of the old surface number, 0 if not existed */
+    Standard_Integer GetNewNum(Standard_Integer iOldNum) const;
+
+    Standard_Integer Size() const { return m_TypeList.size(); }                 /**< Number of rows */
+    SurfType GetType(Standard_Integer i) const { return (SurfType)m_TypeList[i]; } /**< Surface type of row */
+    Standard_Integer GetNum(Standard_Integer i) const { return m_NumList[i]; }  /**< Surface number of row */
+    Standard_Integer GetTrNum(Standard_Integer i) const { return m_TrNumList[i]; }  /**< Transform card of row, 0 if none */
+    Standard_Integer GetCoefNum(Standard_Integer i) const { return m_CoefNumList[i]; }  /**< Number of coefficients of row */
+    const Standard_Real * GetCoef(Standard_Integer i) const { return m_CoefList.empty() ? NULL : &m_CoefList[0] + m_CoefPosList[i]; } /**< Coefficients of row */
+    const TCollection_AsciiString & GetSymb(Standard_Integer i) const { return m_SymbList[m_SymbIdxList[i]]; } /**< Symbol of row */
+
+private:
+
+    vector<Standard_Integer> m_TypeList;            /**< Surface type code of rows */
+    vector<Standard_Integer> m_SequList;            /**< Sequence number of the surface symbols */
+    vector<Standard_Integer> m_SymbIdxList;         /**< Symbol of rows, position in symbol list */
+    vector<Standard_Real> m_CoefList;               /**< Coefficients of all rows */
+    vector<Standard_Integer> m_CoefPosList;         /**< Start of the coefficients of rows */
+    vector<Standard_Integer> m_CoefNumList;         /**< Number of coefficients of rows */
+    vector<Standard_Integer> m_TrNumList;           /**< Transform card number of rows */
+    vector<Standard_Integer> m_NumList;             /**< Surface number given when registered */
+    vector<Standard_Integer> m_NewNumList;          /**< New surface number of each old surface number */
+
+    vector<TCollection_AsciiString> m_SymbList;     /**< The different surface symbols */
+
+private:
+
+    /**< Compare two rows with the weight used by IGeomFace::Compare */
+    class RowLess
+    {
+    public:
+        RowLess(const McCadGeomSurfTable * pTable):m_pTable(pTable){}
+        bool operator()(Standard_Integer iRowA, Standard_Integer iRowB) const;
+    private:
+        const McCadGeomSurfTable * m_pTable;
+    };
+    friend class RowLess;
+
+    /**< The first coefficient of row, 0 if it has none */
+    Standard_Real GetFirstCoef(Standard_Integer i) const;
+    /**< Reorder the rows of an array in the sorted order */
+    template<class T>
+    static void Permute(vector<T> & theList, const vector<Standard_Integer> & order_list);
+    /**< Reorder the coefficients in the sorted order, the starts of rows are updated */
+    void PermuteCoef(const vector<Standard_Integer> & order_list);
+};
+
+#endif // MCCADGEOMSURFTABLE_HXX
@@ -312,20 +312,29 @@ void McCadMcnpWriter::PrintSurfDesc(Standard_OStream & theStream)
     theStream<<"c "<<endl;
 
     Standard_Integer iNum = m_iInitFaceNum; // Set the initial surface number.
-    vector<IGeomFace *>::iterator iterPos;
-    for (iterPos = pData->m_GeomSurfList.begin(); iterPos != pData->m_GeomSurfList.end(); ++iterPos)
+
+    /// The rows of surface table are in the same order as the sorted surface list
+    const McCadGeomSurfTable & theTable = pData->m_SurfTable;
+    assert(theTable.Size() == (Standard_Integer)pData->m_GeomSurfList.size());
+    for (Standard_Integer iRow = 0; iRow < theTable.Size(); iRow++)
     {
-        IGeomFace * pFace = * iterPos;
-        assert(pFace);
         theStream.setf(ios::left);
         theStream<<setw(6)<< iNum++;                        // Surface number
-        theStream<<setw(4)<< pFace->GetTransfNum();         // Transform card number
-        theStream<<setw(4)<< pFace->GetSurfSymb();          // The symbol of surface type
+        if (theTable.GetTrNum(iRow) != 0)                   // Transform card number
+        {
+            theStream<<setw(4)<< theTable.GetTrNum(iRow);
+        }
+        else
+        {
+            theStream<<setw(4)<< "";
+        }
+        theStream<<setw(4)<< theTable.GetSymb(iRow);        // The symbol of surface type
 
         // Output the each parameter of surface
         theStream.setf(ios::fixed);
         theStream<<setprecision(7);
-        for (unsigned int i = 0; i < (pFace->GetPrmtList()).size(); i++ )
+        const Standard_Real * pCoef = theTable.GetCoef(iRow);
+        for (Standard_Integer i = 0; i < theTable.GetCoefNum(iRow); i++ )
         {
             if ( i%4 == 0 && i != 0 )
             {
@@ -334,7 +343,7 @@ void McCadMcnpWriter::PrintSurfDesc(Standard_OStream & theStream)
             }
             theStream.unsetf(ios::left);
             theStream.setf(ios::right);
-            theStream<<setw(15)<<pFace->GetPrmtList().at(i)<<" ";
+            theStream<<setw(15)<<pCoef[i]<<" ";
         }
         theStream<<endl;
         theStream.unsetf(ios::right);
@@ -0,0 +1,326 @@
+#include "McCadSolidBVH.hxx"
+
+#include <algorithm>
+#include <Standard_Real.hxx>
+
+#define BVH_BIN_NUM     16          /**< Number of bins to evaluate the splitting */
+#define BVH_LEAF_SIZE   4           /**< Max number of boxes in leaf */
+
+McCadSolidBVH::McCadSolidBVH()
+{
+}
+
+McCadSolidBVH::~McCadSolidBVH()
+{
+    m_BoxList.clear();
+    m_BoundList.clear();
+    m_IndexList.clear();
+    m_NodeList.clear();
+}
+
+
+
+/** ********************************************************************
+* @brief Surface area of the box, it is the cost of visiting the box
+*
+* @param const Standard_Real * pMin, const Standard_Real * pMax
+* @return Standard_Real
+*
+* @date 19/10/2026
+* @author  agent
+*********************************************************************/
+static Standard_Real BoxArea(const Standard_Real * pMin, const Standard_Real * pMax)
+{
+    Standard_Real dx = pMax[0] - pMin[0];
+    Standard_Real dy = pMax[1] - pMin[1];
+    Standard_Real dz = pMax[2] - pMin[2];
+    return dx*dy + dy*dz + dz*dx;
+}
+
+
+
+/** ********************************************************************
+* @brief Build the tree of the boxes
+*
+* @param const vector<Bnd_Box> & box_list
+* @return void
+*
+* @date 19/10/2026
+* @author  agent
+*********************************************************************/
+void McCadSolidBVH::Build(const vector<Bnd_Box> & box_list)
+{
+    m_BoxList = box_list;
+    m_BoundList.clear();
+    m_IndexList.clear();
+    m_NodeList.clear();
+
+    if (m_BoxList.empty())
+    {
+        return;
+    }
+
+    for (unsigned int i = 0; i < m_BoxList.size(); i++)
+    {
+        /// The bounds include the gap as Bnd_Box::IsOut does,
+        /// the void box is out of any box and never reached.
+        Standard_Real fXmin, fYmin, fZmin, fXmax, fYmax, fZmax;
+        if (m_BoxList[i].IsVoid())
+        {
+            fXmin = fYmin = fZmin = RealLast();
+            fXmax = fYmax = fZmax = -RealLast();
+        }
+        else
+        {
+            m_BoxList[i].Get(fXmin, fYmin, fZmin, fXmax, fYmax, fZmax);
+        }
+        m_BoundList.push_back(fXmin);
+        m_BoundList.push_back(fYmin);
+        m_BoundList.push_back(fZmin);
+        m_BoundList.push_back(fXmax);
+        m_BoundList.push_back(fYmax);
+        m_BoundList.push_back(fZmax);
+        m_IndexList.push_back(i);
+    }
+
+    m_NodeList.reserve(2*m_BoxList.size());
+    m_NodeList.push_back(BVHNode());
+    BuildNode(0, 0, m_IndexList.size());
+}
+
+
+
+/** ********************************************************************
+* @brief Compute the box of the node, and split the boxes with binned
+*        surface area heuristic. If the heuristic can not split them,
+*        they are split at the median of the longest centroid extent.
+*
+* @param Standard_Integer iNode
+*        Standard_Integer iFirst, Standard_Integer iLast   Boxes [iFirst,iLast)
+* @return void
+*
+* @date 19/10/2026
+* @author  agent
+*********************************************************************/
+void McCadSolidBVH::BuildNode(Standard_Integer iNode, Standard_Integer iFirst, Standard_Integer iLast)
+{
+    Standard_Real fMin[3] = { RealLast(), RealLast(), RealLast()};
+    Standard_Real fMax[3] = {-RealLast(),-RealLast(),-RealLast()};
+    Standard_Real fCenMin[3] = { RealLast(), RealLast(), RealLast()};
+    Standard_Real fCenMax[3] = {-RealLast(),-RealLast(),-RealLast()};
+
+    for (Standard_Integer i = iFirst; i < iLast; i++)
+    {
+        const Standard_Real * pBound = &m_BoundList[6*m_IndexList[i]];
+        for (Standard_Integer k = 0; k < 3; k++)
+        {
+            fMin[k] = min(fMin[k], pBound[k]);
+            fMax[k] = max(fMax[k], pBound[k+3]);
+            Standard_Real fCen = 0.5*(pBound[k] + pBound[k+3]);
+            fCenMin[k] = min(fCenMin[k], fCen);
+            fCenMax[k] = max(fCenMax[k], fCen);
+        }
+    }
+
+    for (Standard_Integer k = 0; k < 3; k++)
+    {
+        m_NodeList[iNode].fMin[k] = fMin[k];
+        m_NodeList[iNode].fMax[k] = fMax[k];
+    }
+    m_NodeList[iNode].iLeft = -1;
+    m_NodeList[iNode].iFirst = iFirst;
+    m_NodeList[iNode].iCount = iLast - iFirst;
+
+    Standard_Integer iNum = iLast - iFirst;
+    if (iNum <= BVH_LEAF_SIZE)
+    {
+        return;
+    }
+
+    Standard_Integer iAxis = 0;
+    for (Standard_Integer k = 1; k < 3; k++)
+    {
+        if (fCenMax[k] - fCenMin[k] > fCenMax[iAxis] - fCenMin[iAxis])
+        {
+            iAxis = k;
+        }
+    }
+    Standard_Real fExtent = fCenMax[iAxis] - fCenMin[iAxis];
+    if (fExtent <= 0.0)
+    {
+        return;         // All the boxes have the same center
+    }
+
+    /// Put the boxes into bins along the axis
+    Standard_Integer iBinCount[BVH_BIN_NUM];
+    Standard_Real fBinMin[BVH_BIN_NUM][3], fBinMax[BVH_BIN_NUM][3];
+    for (Standard_Integer b = 0; b < BVH_BIN_NUM; b++)
+    {
+        iBinCount[b] = 0;
+        for (Standard_Integer k = 0; k < 3; k++)
+        {
+            fBinMin[b][k] = RealLast();
+            fBinMax[b][k] = -RealLast();
+        }
+    }
+
+    Standard_Real fScale = BVH_BIN_NUM/fExtent;
+    for (Standard_Integer i = iFirst; i < iLast; i++)
+    {
+        const Standard_Real * pBound = &m_BoundList[6*m_IndexList[i]];
+        Standard_Real fCen = 0.5*(pBound[iAxis] + pBound[iAxis+3]);
+        Standard_Integer b = min(BVH_BIN_NUM-1, (Standard_Integer)((fCen - fCenMin[iAxis])*fScale));
+        iBinCount[b]++;
+        for (Standard_Integer k = 0; k < 3; k++)
+        {
+            fBinMin[b][k] = min(fBinMin[b][k], pBound[k]);
+            fBinMax[b][k] = max(fBinMax[b][k], pBound[k+3]);
+        }
+    }
+
+    /// Sweep the bins from the right, then from the left to evaluate the cost
+    Standard_Real fRightArea[BVH_BIN_NUM];
+    Standard_Integer iRightCount[BVH_BIN_NUM];
+    Standard_Real fAccMin[3] = { RealLast(), RealLast(), RealLast()};
+    Standard_Real fAccMax[3] = {-RealLast(),-RealLast(),-RealLast()};
+    Standard_Integer iAccCount = 0;
+    for (Standard_Integer b = BVH_BIN_NUM-1; b > 0; b--)
+    {
+        iAccCount += iBinCount[b];
+        for (Standard_Integer k = 0; k < 3; k++)
+        {
+            fAccMin[k] = min(fAccMin[k], fBinMin[b][k]);
+            fAccMax[k] = max(fAccMax[k], fBinMax[b][k]);
+        }
+        iRightCount[b] = iAccCount;
+        fRightArea[b] = iAccCount > 0 ? BoxArea(fAccMin, fAccMax) : 0.0;
+    }
+
+    Standard_Integer iBestBin = -1;
+    Standard_Real fBestCost = RealLast();
+    for (Standard_Integer k = 0; k < 3; k++)
+    {
+        fAccMin[k] = RealLast();
+        fAccMax[k] = -RealLast();
+    }
+    iAccCount = 0;
+    for (Standard_Integer b = 0; b < BVH_BIN_NUM-1; b++)
+    {
+        iAccCount += iBinCount[b];
+        for (Standard_Integer k = 0; k < 3; k++)
+        {
+            fAccMin[k] = min(fAccMin[k], fBinMin[b][k]);
+            fAccMax[k] = max(fAccMax[k], fBinMax[b][k]);
+        }
+        if (iAccCount == 0 || iRightCount[b+1] == 0)
+        {
+            continue;
+        }
+        Standard_Real fCost = iAccCount*BoxArea(fAccMin, fAccMax) + iRightCount[b+1]*fRightArea[b+1];
+        if (fCost < fBestCost)
+        {
+            fBestCost = fCost;
+            iBestBin = b;
+        }
+    }
+
+    Standard_Integer iMid;
+    if (iBestBin >= 0)
+    {
+        /// Boxes in the bins up to the best bin are on the left
+        Standard_Integer i = iFirst, j = iLast - 1;
+        while (i <= j)
+        {
+            const Standard_Real * pBound = &m_BoundList[6*m_IndexList[i]];
+            Standard_Real fCen = 0.5*(pBound[iAxis] + pBound[iAxis+3]);
+            Standard_Integer b = min(BVH_BIN_NUM-1, (Standard_Integer)((fCen - fCenMin[iAxis])*fScale));
+            if (b <= iBestBin)
+            {
+                i++;
+            }
+            else
+            {
+                swap(m_IndexList[i], m_IndexList[j]);
+                j--;
+            }
+        }
+        iMid = i;
+    }
+    else
+    {
+        iMid = iFirst + iNum/2;
+    }
+
+    if (iMid == iFirst || iMid == iLast)
+    {
+        iMid = iFirst + iNum/2;
+    }
+
+    Standard_Integer iLeft = m_NodeList.size();
+    m_NodeList.push_back(BVHNode());
+    m_NodeList.push_back(BVHNode());
+    m_NodeList[iNode].iLeft = iLeft;
+    m_NodeList[iNode].iCount = 0;
+
+    BuildNode(iLeft, iFirst, iMid);
+    BuildNode(iLeft+1, iMid, iLast);
+}
+
+
+
+/** ********************************************************************
+* @brief Traverse the tree with the box, the leaf boxes are checked with
+*        Bnd_Box::IsOut as the traversal of the solid list.
+*
+* @param const Bnd_Box & theBox
+*        vector<Standard_Integer> & index_list
+* @return void
+*
+* @date 19/10/2026
+* @author  agent
+*********************************************************************/
+void McCadSolidBVH::Query(const Bnd_Box & theBox, vector<Standard_Integer> & index_list) const
+{
+    index_list.clear();
+    if (m_NodeList.empty() || theBox.IsVoid())
+    {
+        return;
+    }
+
+    Standard_Real fMin[3], fMax[3];
+    theBox.Get(fMin[0], fMin[1], fMin[2], fMax[0], fMax[1], fMax[2]);
+
+    vector<Standard_Integer> stack_list;
+    stack_list.push_back(0);
+    while (!stack_list.empty())
+    {
+        const BVHNode & theNode = m_NodeList[stack_list.back()];
+        stack_list.pop_back();
+
+        if (   fMin[0] > theNode.fMax[0] || fMax[0] < theNode.fMin[0]
+            || fMin[1] > theNode.fMax[1] || fMax[1] < theNode.fMin[1]
+            || fMin[2] > theNode.fMax[2] || fMax[2] < theNode.fMin[2])
+        {
+            continue;
+        }
+
+        if (theNode.iCount > 0)
+        {
+            for (Standard_Integer i = theNode.iFirst; i < theNode.iFirst + theNode.iCount; i++)
+            {
+                Standard_Integer index = m_IndexList[i];
+                if (!theBox.IsOut(m_BoxList[index]))
+                {
+                    index_list.push_back(index);
+                }
+            }
+        }
+        else
+        {
+            stack_list.push_back(theNode.iLeft+1);
+            stack_list.push_back(theNode.iLeft);
+        }
+    }
+
+    sort(index_list.begin(), index_list.end());
+}
@@ -0,0 +1,65 @@
+#ifndef MCCADSOLIDBVH_HXX
+#define MCCADSOLIDBVH_HXX
+
+#include <vector>
+#include <Standard.hxx>
+#include <Bnd_Box.hxx>
+
+using namespace std;
+
+/** Bounding volume hierarchy over the boundary boxes of convex solids. The
+    tree is built once with binned surface area heuristic, the boxes of a node
+    are split at the bin boundary of the longest centroid extent which gives
+    the least cost. The query gives the solids whose boxes are not out of the
+    given box, in ascending order as the traversal of the solid list. */
+class McCadSolidBVH
+{
+public:
+
+    void* operator new(size_t,void* anAddress)
+    {
+      return anAddress;
+    }
+    void* operator new(size_t size)
+    {
+      return Standard::Allocate(size);
+    }
+    void  operator delete(void *anAddress)
+    {
+      if (anAddress) Standard::Free((Standard_Address&)anAddress);
+    }
+
+    McCadSolidBVH();
+    ~McCadSolidBVH();
+
+public:
+
+    /**< Build the tree of the boxes, the index of box is the index of solid */
+    void Build(const vector<Bnd_Box> & box_list);
+    /**< Get the boxes colliding with the given box, sorted ascending */
+    void Query(const Bnd_Box & theBox, vector<Standard_Integer> & index_list) const;
+
+private:
+
+    /** Node of the tree, the leaf has boxes and the inner node has two children */
+    struct BVHNode
+    {
+        Standard_Real fMin[3];          /**< Min point of the node box */
+        Standard_Real fMax[3];          /**< Max point of the node box */
+        Standard_Integer iLeft;         /**< Left child, the right child is iLeft+1 */
+        Standard_Integer iFirst;        /**< First box in index list of leaf */
+        Standard_Integer iCount;        /**< Number of boxes of leaf, 0 for inner node */
+    };
+
+    vector<Bnd_Box> m_BoxList;              /**< Boxes of solids */
+    vector<Standard_Real> m_BoundList;      /**< Min and max of boxes, six values each */
+    vector<Standard_Integer> m_IndexList;   /**< Boxes ordered by the leaves */
+    vector<BVHNode> m_NodeList;             /**< Nodes, the first is the root */
+
+private:
+
+    /**< Split the node of boxes from iFirst to iLast recursively */
+    void BuildNode(Standard_Integer iNode, Standard_Integer iFirst, Standard_Integer iLast);
+};
+
+#endif // MCCADSOLIDBVH_HXX
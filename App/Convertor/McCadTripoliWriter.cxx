@@ -846,6 +846,7 @@ vector<McCadTripoliCell *> McCadTripoliWriter::GenOuterSpaceList(McCadVoidCell *
 * @return void
 *
 * @date 31/8/2013
+* @modify 19/10/2026
 * @author  Lei Lu
 ***********************************************************************/
 void McCadTripoliWriter::PrintSurfDesc(Standard_OStream & theStream)
@@ -858,10 +859,12 @@ void McCadTripoliWriter::PrintSurfDesc(Standard_OStream & theStream)
 
     Standard_Integer iNum = m_iInitFaceNum; // Set the initial surface number.
 
-    vector<IGeomFace *>::iterator iterPos;
-    for (iterPos = (pData->m_GeomSurfList).begin(); iterPos != (pData->m_GeomSurfList).end(); ++iterPos)
+    /// The rows of surface table are in the same order as the sorted surface list
+    const McCadGeomSurfTable & theTable = pData->m_SurfTable;
+    assert(theTable.Size() == (Standard_Integer)pData->m_GeomSurfList.size());
+    for (Standard_Integer iRow = 0; iRow < theTable.Size(); iRow++)
     {
-       IGeomFace * pFace = *iterPos;
+       IGeomFace * pFace = pData->m_GeomSurfList.at(iRow);
        assert(pFace);
        theStream.setf(ios::left);
        theStream<<"SURF "<<setw(6)<< iNum++;            // Surface number
@@ -871,7 +874,7 @@ void McCadTripoliWriter::PrintSurfDesc(Standard_OStream & theStream)
        theStream.setf(ios::fixed);
        theStream<<setprecision(7);
 
-       vector<Standard_Real> surf_list = GetSurfPrmt(pFace);
+       vector<Standard_Real> surf_list = GetSurfPrmt(pFace, theTable.GetCoef(iRow), theTable.GetCoefNum(iRow));
        for (unsigned int i = 0; i < surf_list.size(); i++ )
        {
            if ( i%4 == 0 && i != 0 )
@@ -928,24 +931,26 @@ TCollection_AsciiString McCadTripoliWriter::GetSurfSymb(IGeomFace *& pFace)
 *        surface describtion
 *
 * @param IGeom * pFace
+*        const Standard_Real * pCoef    Coefficients in surface table
+*        Standard_Integer iCoefNum      Number of coefficients
 * @return vector<Standard_Real> parameters list
 *
 * @date 09/10/2013
-* @modify 10/09/2014
+* @modify 19/10/2026
 * @author  Lei Lu
 ***********************************************************************/
-vector<Standard_Real> McCadTripoliWriter::GetSurfPrmt(IGeomFace *& pFace)
+vector<Standard_Real> McCadTripoliWriter::GetSurfPrmt(IGeomFace *& pFace, const Standard_Real * pCoef,
+                                                      Standard_Integer iCoefNum)
 {
     vector<Standard_Real> prmt_list;
     TCollection_AsciiString McnpSymb = pFace->GetSurfSymb();
     if (McnpSymb == "P")
     {
-        int iNum = (pFace->GetPrmtList()).size();
-        for (Standard_Integer i = 0; i < iNum-1; i++ )
+        for (Standard_Integer i = 0; i < iCoefNum-1; i++ )
         {
-            prmt_list.push_back(pFace->GetPrmtList().at(i));
+            prmt_list.push_back(pCoef[i]);
         }
-        prmt_list.push_back(-1*pFace->GetPrmtList().at(iNum-1));
+        prmt_list.push_back(-1*pCoef[iCoefNum-1]);
         return prmt_list;
     }
 
@@ -998,10 +1003,9 @@ vector<Standard_Real> McCadTripoliWriter::GetSurfPrmt(IGeomFace *& pFace)
         return prmt_list;
     }
 
-    int iNum = (pFace->GetPrmtList()).size();
-    for (Standard_Integer i = 0; i < iNum; i++ )
+    for (Standard_Integer i = 0; i < iCoefNum; i++ )
     {
-        prmt_list.push_back(pFace->GetPrmtList().at(i));
+        prmt_list.push_back(pCoef[i]);
     }
     return prmt_list;
 }
@@ -57,7 +57,8 @@ private:
     /**< Find in the cell number list, are there any repeated cells */
     Standard_Boolean FindRepeatCell(int iFaceNum, vector<Standard_Integer> & list);
 
-    vector<Standard_Real> GetSurfPrmt(IGeomFace *& pFace);  /**< Get the parameter list of a surface */
+    vector<Standard_Real> GetSurfPrmt(IGeomFace *& pFace, const Standard_Real * pCoef,
+                                      Standard_Integer iCoefNum);  /**< Get the parameter list of a surface */
     TCollection_AsciiString GetSurfSymb(IGeomFace *& pFace);/**< Get the type of surface */
 
 };
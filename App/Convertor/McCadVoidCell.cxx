@@ -7,6 +7,7 @@
 #include <assert.h>
 #include <omp.h>
 #include <Standard.hxx>
+#include <Standard_Version.hxx>
 
 #include <BRepClass3d_SolidClassifier.hxx>
 #include <BRepBuilderAPI_MakeEdge.hxx>
@@ -15,24 +16,31 @@
 #include <STEPControl_Writer.hxx>
 //#include <McCadCSGUtil_SolidBuilder.hxx>
 #include <BOPTools_AlgoTools.hxx>
+#include <Precision.hxx>
 
 #include "McCadVoidCellManager.hxx"
+#include "McCadVoidKdTree.hxx"
 #include "McCadGeomPlane.hxx"
 #include "../Tools/McCadConvertConfig.hxx"
 #include "../Tools/McCadGeomTool.hxx"
 #include "../Tools/McCadMathTool.hxx"
+#include "../Tools/McCadBoxCollision.hxx"
+#include "../Tools/McCadEvaluator.hxx"
 
 #include <gp_Pln.hxx>
 
 
 McCadVoidCell::McCadVoidCell()
 {
+    m_iCollisionLength = 0;
+    m_bInherited = Standard_False;
 }
 
 McCadVoidCell::McCadVoidCell(const TopoDS_Solid & theSolid):TopoDS_Solid(theSolid)
 {
     m_SplitAxis = XAxis;
-    m_VertexList = new TColgp_HSequenceOfPnt;
+    m_iCollisionLength = 0;
+    m_bInherited = Standard_False;
 
     GetBntBox();
     GetGeomFaceList();
@@ -42,7 +50,6 @@ McCadVoidCell::McCadVoidCell(const TopoDS_Solid & theSolid):TopoDS_Solid(theSoli
 McCadVoidCell::~McCadVoidCell()
 {
     m_CollidedSolidNumList.clear();
-    m_VertexList->Clear();
 
     for (unsigned int i = 0; i < m_CollisionList.size(); i++)
     {
@@ -143,39 +150,67 @@ void McCadVoidCell::SetBntBox(Standard_Real fXmin, Standard_Real fYmin, Standard
 
 /** ********************************************************************
 * @brief Calculate the collied faces of material solid with void box,
-*        The convex solids are stored at the McCadGeomData.
+*        The convex solids are stored at the McCadGeomData. If the
+*        collisions are inherited from the parent box, only the collied
+*        faces of parent are checked, and the faces not crossing the split
+*        plane are collied without checking again.
 *
 * @param McCadGeomData * pData
+*        Standard_Boolean bShowProgress   Send the progress or not, only
+*                                         the calling thread sends it
 * @return void
 *
 * @date 31/8/2012
-* @modify 28/7/2016
+* @modify 19/10/2026
 * @author  Lei Lu
 ************************************************************************/
-void McCadVoidCell::CalColliedFaces(McCadGeomData * pData)
+void McCadVoidCell::CalColliedFaces(McCadGeomData * pData, Standard_Boolean bShowProgress)
 { 
     McCadMessager_Signal * msg = McCadMessager_Signal::Instance();
     float fs = 100.0/m_CollidedSolidNumList.size();
+    vector<McCadConvexSolid *> solid_list = pData->GetConvexSolid();
 
     for (unsigned int i = 0; i < m_CollidedSolidNumList.size(); i++)
     {        
-        msg->sig_progress_part(int(fs*(i+1)));
+        if(bShowProgress)
+        {
+            msg->sig_progress_part(int(fs*(i+1)));
+        }
         int index = m_CollidedSolidNumList.at(i);
-        McCadConvexSolid * pSolid = (pData->GetConvexSolid()).at(index);
+        McCadConvexSolid * pSolid = solid_list.at(index);
         assert(pSolid);
 
         Bnd_Box bbox_solid = pSolid->GetBntBox();
         if(!CalColliedBox(bbox_solid))
         {
             m_CollidedSolidNumList.erase(m_CollidedSolidNumList.begin()+i);
+            if (m_bInherited)
+            {
+                m_InheritFaceList.erase(m_InheritFaceList.begin()+i);
+            }
             i--;      
             continue;
         }
 
+        /// The faces not collied with parent box can not collide with the child box
+        vector<int> face_index_list;
+        if (m_bInherited)
+        {
+            face_index_list = m_InheritFaceList.at(i);
+        }
+        else
+        {
+            for (unsigned int j = 0; j < pSolid->GetSTLFaceList().size(); j++)
+            {
+                face_index_list.push_back(j);
+            }
+        }
+
         McCadVoidCollision *pCollision = new McCadVoidCollision();
         Standard_Boolean bSolidCollied = Standard_False; // If the void collied with this solid
-        for (unsigned int j = 0; j < pSolid->GetSTLFaceList().size(); j++)
+        for (unsigned int m = 0; m < face_index_list.size(); m++)
         {
+            int j = face_index_list.at(m);
             McCadExtBndFace *pFace = pSolid->GetSTLFaceList().at(j);
             Bnd_Box bbox_face = pFace->GetBndBox();
 
@@ -185,32 +220,46 @@ void McCadVoidCell::CalColliedFaces(McCadGeomData * pData)
                 continue;
             }            
 
-            if(hasSameFaces(pFace))
+            if(HasSameFaces(pFace))
             {                
                 continue;
             }
 
-	    if (CalColliedTriangle(pFace->GetTriangleList()))
+            /// If the face does not cross the split plane of parent box,
+            /// the part of face in the parent box is in this box.
+            if (m_bInherited && IsInInheritRange(bbox_face))
             {
                 bCollied = Standard_True;
             }
-            //else if (CalColliedPoints(pFace->GetDiscPntList()))
-            //{              
-            //     bCollied = Standard_True;
-            //}
-            else if (CalColliedFace(pFace))
-            {                
-                bCollied = Standard_True;
-            }
             else
             {
-                bCollied = Standard_False;
+                /// The face is within the deflection of its triangles, if there is no
+                /// triangle near the box, the face can not reach the box either.
+                vector<McCadTriangle *> tri_list = pFace->GetTriangleList();
+                if (CalColliedTriangle(tri_list))
+                {
+                    bCollied = Standard_True;
+                }
+                //else if (CalColliedPoints(pFace->GetDiscPntList()))
+                //{              
+                //     bCollied = Standard_True;
+                //}
+                else if ((tri_list.empty() || CalColliedTriangle(tri_list, 2.0*pFace->GetDeflection()))
+                         && CalColliedFace(pFace))
+                {                
+                    bCollied = Standard_True;
+                }
+                else
+                {
+                    bCollied = Standard_False;
+                }
             }
 
 
             if (bCollied)
             {                
                 pCollision->AddColliedFace(pFace->GetFaceNum());                
+                pCollision->AddColliedFaceIndex(j);
                 if(pFace->HaveAstSurf())
                 {
                     for (unsigned int k = 0; k < pFace->GetAstFaces().size(); k++)
@@ -236,6 +285,7 @@ void McCadVoidCell::CalColliedFaces(McCadGeomData * pData)
         {
             pCollision->SetColliedSolidNum(index+1);
             m_CollisionList.push_back(pCollision);
+            m_iCollisionLength += pCollision->GetExpLength();
             continue;
         }        
 
@@ -273,17 +323,29 @@ void McCadVoidCell::CalColliedFaces(McCadGeomData * pData)
         {
             pCollision->SetColliedSolidNum(index+1);
             m_CollisionList.push_back(pCollision);
+            m_iCollisionLength += pCollision->GetExpLength();
         }
         else
         {
             m_CollidedSolidNumList.erase(m_CollidedSolidNumList.begin()+i);
+            if (m_bInherited)
+            {
+                m_InheritFaceList.erase(m_InheritFaceList.begin()+i);
+            }
             i--;
             delete pCollision;
             pCollision = NULL;
         }
     }
 
-    msg->sig_progress_part(100);
+    /// The candidates are not used any more
+    m_bInherited = Standard_False;
+    m_InheritFaceList.clear();
+
+    if(bShowProgress)
+    {
+        msg->sig_progress_part(100);
+    }
 }
 
 
@@ -347,18 +409,31 @@ Standard_Boolean McCadVoidCell::HasSameFaces(McCadExtBndFace *& pFace)
 
 // Lei Lu 201905
 /** ********************************************************************
-* @brief
+* @brief If the triangles have common points with the void box. The
+*        triangles are checked with separating axis test, the box can be
+*        enlarged with a gap for finding the triangles near the box.
 *
-* @param Handle_TColgp_HSequenceOfPnt point_list
+* @param vector<McCadTriangle*> triangle_list
+*        Standard_Real fGap
 * @return Standard_Boolean
 *
 * @date 20/8/2012
+* @modify 19/10/2026
 * @author  Lei Lu
 ************************************************************************/
-Standard_Boolean McCadVoidCell::CalColliedTriangle(vector<McCadTriangle*> triangle_list)
+Standard_Boolean McCadVoidCell::CalColliedTriangle(vector<McCadTriangle*> triangle_list, Standard_Real fGap)
 {
     Standard_Boolean bInVoid = Standard_False;
 
+    m_bBox.SetGap(0.0);
+    Standard_Real dXmin, dYmin, dZmin, dXmax, dYmax, dZmax;
+    m_bBox.Get(dXmin, dYmin, dZmin, dXmax, dYmax, dZmax);
+    gp_Pnt min_pnt(dXmin-fGap, dYmin-fGap, dZmin-fGap);
+    gp_Pnt max_pnt(dXmax+fGap, dYmax+fGap, dZmax+fGap);
+
+    Bnd_Box bbox_gap;
+    bbox_gap.Update(min_pnt.X(), min_pnt.Y(), min_pnt.Z(), max_pnt.X(), max_pnt.Y(), max_pnt.Z());
+
     vector<McCadTriangle *>::iterator iterTri;
     for (iterTri = triangle_list.begin(); iterTri != triangle_list.end(); ++iterTri)
     {
@@ -367,15 +442,16 @@ Standard_Boolean McCadVoidCell::CalColliedTriangle(vector<McCadTriangle*> triang
 
         // By boundary box
         Bnd_Box bbox_tri = pTri->GetBndBox();
-		if (!CalColliedBox(bbox_tri))
-		{
-			continue;
-		}
+        if (fGap > 0.0 ? bbox_gap.IsOut(bbox_tri) : !CalColliedBox(bbox_tri))
+        {
+            continue;
+        }
 
         // By vertex
-        for (Standard_Integer i = 1; i <= pTri->GetVexList()->Length();i++)
+        Handle_TColgp_HSequenceOfPnt vex_list = pTri->GetVexList();
+        for (Standard_Integer i = 1; i <= vex_list->Length();i++)
         {
-                gp_Pnt pnt = pTri->GetVexList()->Value(i);
+                gp_Pnt pnt = vex_list->Value(i);
                 if (IsPointInBBox(pnt))
                 {
                     bInVoid = Standard_True;
@@ -383,56 +459,14 @@ Standard_Boolean McCadVoidCell::CalColliedTriangle(vector<McCadTriangle*> triang
                 }
         }
 
-         for (unsigned int i = 0; i < m_BndFaceList.size(); i++)
-         {
-                McCadExtBndFace * pExtFace = m_BndFaceList[i];
-
-                int nPoint = 0; // The number of collied points between triangle and cylinder
-                TopoDS_Shape section_shape;
-                try             // Calculate the intersected section
-                {
-                    BRepAlgoAPI_Section section(*pExtFace, *pTri);
-                    section.ComputePCurveOn1(Standard_True);
-                    section.Approximation(Standard_True);
-                    section.Build();
-                    section_shape = section.Shape();
-                }
-                catch(...)
-                {
-                    std::cout<<"ERROR"<<endl;
-                    bInVoid = Standard_False;
-                    return bInVoid;
-                }
-
-                // How many intersected pointed do the triangle and cylinder have.
-                for (TopExp_Explorer ex(section_shape, TopAbs_VERTEX); ex.More(); ex.Next())
-                {
-                    nPoint++;
-                }
-
-                if (nPoint > 0)
-                {
-                    bInVoid = Standard_True;
-                    return bInVoid;
-                }
+        // By separating axis, the triangle crossing the box without vertex in it
+        if (vex_list->Length() == 3
+            && McCadBoxCollision::TriangleBox(vex_list->Value(1), vex_list->Value(2), vex_list->Value(3),
+                                              min_pnt, max_pnt))
+        {
+            bInVoid = Standard_True;
+            return bInVoid;
         }
-
-		 /* for (unsigned int i = 0; i < m_BndFaceList.size(); i++)
-		  {
-			  McCadExtBndFace * pExtFace = m_BndFaceList[i];
-			  Handle(Geom_Surface) S2 = BRep_Tool::Surface(*pExtFace, loc);
-
-			  GeomAPI_IntSS Intersector(S1, S2, 1.0e-5);
-			  if (Intersector.IsDone())
-			  {
-				  Standard_Integer nb = Intersector.NbLines();
-				  if (nb > 0)
-				  {
-					  bInVoid = Standard_True;
-					  break;
-				  }
-			  }
-		  }*/
     }
     return bInVoid;
 }
@@ -525,9 +559,14 @@ Standard_Boolean McCadVoidCell::CalColliedBox(Bnd_Box & box)
 
 
 /** ********************************************************************
-* @brief Further collision detection, use the boolean operation between
-*        face and void box, if they have common section, then they are
-*        collied.
+* @brief Further collision detection, the surface of face is classified
+*        with the common part of void box and boundary box of face, if it
+*        does not go through the common part, they are not collied. The
+*        surface is infinite and the face is a trimmed part of it, e.g. a
+*        sector of cylinder, so the surfaces going through the common part
+*        and the surfaces which can not be classified use the boolean
+*        operation between face and void box, if they have common section,
+*        then they are collied.
 *        Because same faces have been merged, and in some case, the merged
 *        surfaces are large the original surfaces, so the origianl same
 *        surfaces should be used for detecting the collision instead of
@@ -537,6 +576,7 @@ Standard_Boolean McCadVoidCell::CalColliedBox(Bnd_Box & box)
 * @return TopoDS_Shape
 *
 * @date 20/3/2013
+* @modify 19/10/2026
 * @author  Lei Lu
 ************************************************************************/
 Standard_Boolean McCadVoidCell::CalColliedFace(McCadExtBndFace *& theFace)
@@ -544,9 +584,37 @@ Standard_Boolean McCadVoidCell::CalColliedFace(McCadExtBndFace *& theFace)
     Standard_Boolean PerformNow = Standard_False;
     int nCount = 0;    
 
+    /// The face is within its boundary box, only the common part of the boxes is checked.
+    /// The surface not going through it excludes the face, the crossing is not enough
+    /// to accept the face because the face may not cover the crossed part of surface.
+    BoxPosition thePos = BoxUnknownPosition;
     if(!theFace->IsFusedFace())
+    {
+        Bnd_Box bbox_face = theFace->GetBndBox();
+        Standard_Real xMin1, yMin1, zMin1, xMax1, yMax1, zMax1;
+        Standard_Real xMin2, yMin2, zMin2, xMax2, yMax2, zMax2;
+        bbox_face.Get(xMin1, yMin1, zMin1, xMax1, yMax1, zMax1);
+        m_bBox.Get(xMin2, yMin2, zMin2, xMax2, yMax2, zMax2);
+
+        gp_Pnt min_pnt(Max(xMin1,xMin2), Max(yMin1,yMin2), Max(zMin1,zMin2));
+        gp_Pnt max_pnt(Min(xMax1,xMax2), Min(yMax1,yMax2), Min(zMax1,zMax2));
+        if (min_pnt.X() <= max_pnt.X() && min_pnt.Y() <= max_pnt.Y() && min_pnt.Z() <= max_pnt.Z())
+        {
+            thePos = McCadBoxCollision::SurfaceBox(theFace->GetAdpFace(), min_pnt, max_pnt, 1.0e-5);
+        }
+        else
+        {
+            thePos = BoxAboveSurf;      // No common part, the face is out of the box
+        }
+    }
+
+    /// The crossed face and the surface of revolution are checked with boolean operation
+    if(!theFace->IsFusedFace() && (thePos == BoxCrossSurf || thePos == BoxUnknownPosition))
     {
         BRepAlgoAPI_Section section(*this,*theFace,PerformNow);
+#if OCC_VERSION_HEX >= 0x070200
+        section.SetNonDestructive(Standard_True);   // The face is read by other threads
+#endif
         section.ComputePCurveOn1(Standard_True);
         section.Approximation(Standard_True);
         section.Build();
@@ -590,70 +658,99 @@ Standard_Boolean McCadVoidCell::CalColliedFace(McCadExtBndFace *& theFace)
 /** ********************************************************************
 * @brief The vertexes of void box are in the convex solid or not, if
 *        then means they have collision.
+*        The convex solid is the common part of the half spaces of its
+*        boundary surfaces and assisted surfaces, the solid is at the
+*        minus side of the forward face. The vertex is in the solid if it
+*        is inside all the half spaces. The eight vertexes are evaluated
+*        together with each surface, the surfaces are not traversed any
+*        more when all the vertexes are out of the solid.
+*        With CheckPointClassify, the vertexes are checked again with
+*        the BRep classifier and the difference is printed.
 *
 * @param McCadConvexSolid *& pSolid
 * @return Standard_Boolean
 *
 * @date 20/3/2013
+* @modify 19/10/2026
 * @author  Lei Lu
 ************************************************************************/
 Standard_Boolean McCadVoidCell::IsVertexInSolid(McCadConvexSolid *& pSolid)
 {
-    SetVertexList();   // Set the vertex of void cell
-    BRepClass3d_SolidClassifier bsc3d(*pSolid);
-    for (Standard_Integer i = 1; i <= m_VertexList->Length(); i++)
+    Standard_Real fTol = 1.0e-5;
+
+    m_bBox.SetGap(0.0);
+    Standard_Real dXmin, dYmin, dZmin, dXmax, dYmax, dZmax;
+    m_bBox.Get(dXmin, dYmin, dZmin, dXmax, dYmax, dZmax);
+    gp_Pnt min_pnt(dXmin, dYmin, dZmin), max_pnt(dXmax, dYmax, dZmax);
+
+    /// The boundary surfaces and the assisted surfaces bounding the solid
+    vector<McCadExtFace *> face_list;
+    vector<McCadExtBndFace *> bnd_face_list = pSolid->GetSTLFaceList();
+    for (unsigned int i = 0; i < bnd_face_list.size(); i++)
     {
-        gp_Pnt pnt = m_VertexList->Value(i);
-        bsc3d.Perform(pnt,1.0e-05);
-        if ( bsc3d.State() == TopAbs_IN)
+        McCadExtBndFace *pFace = bnd_face_list.at(i);
+        face_list.push_back(pFace);
+        if(pFace->HaveAstSurf())
         {
-            return Standard_True;
+            vector<McCadExtAstFace *> ast_face_list = pFace->GetAstFaces();
+            for (unsigned int j = 0; j < ast_face_list.size(); j++)
+            {
+                if(!ast_face_list.at(j)->IsSplitFace())
+                {
+                    face_list.push_back(ast_face_list.at(j));
+                }
+            }
         }
     }
-    return Standard_False;
-}
 
+    Standard_Boolean bInSolid[8];
+    Standard_Integer iNumIn = 8;
+    for (Standard_Integer i = 0; i < 8; i++)
+    {
+        bInSolid[i] = Standard_True;
+    }
 
+    for (unsigned int j = 0; j < face_list.size() && iNumIn > 0; j++)
+    {
+        McCadExtFace *pFace = face_list.at(j);
+        Standard_Real fSide = (pFace->GetOrientation() == TopAbs_REVERSED) ? -1.0 : 1.0;
 
+        Standard_Real fDist[8];
+        if(!McCadBoxCollision::VertexDistance(pFace->GetAdpFace(), min_pnt, max_pnt, fDist))
+        {
+            for (Standard_Integer i = 0; i < 8; i++)
+            {
+                fDist[i] = McCadEvaluator::Evaluate(pFace->GetAdpFace(),
+                                                    McCadBoxCollision::BoxVertex(min_pnt, max_pnt, i));
+            }
+        }
 
+        for (Standard_Integer i = 0; i < 8; i++)
+        {
+            if (bInSolid[i] && fSide*fDist[i] > -fTol)
+            {
+                bInSolid[i] = Standard_False;
+                iNumIn--;
+            }
+        }
+    }
 
-/** ********************************************************************
-* @brief Travelse the vertexes of void box and add into vertex list
-*
-* @param
-* @return void
-*
-* @date 20/3/2013
-* @author  Lei Lu
-************************************************************************/
-void McCadVoidCell::SetVertexList()
-{
-    if(m_VertexList->Length()!=0)
+    if(McCadConvertConfig::CheckPointClassify())
     {
-        return;
+        BRepClass3d_SolidClassifier bsc3d(*pSolid);
+        for (Standard_Integer i = 0; i < 8; i++)
+        {
+            gp_Pnt pnt = McCadBoxCollision::BoxVertex(min_pnt, max_pnt, i);
+            bsc3d.Perform(pnt,1.0e-05);
+            if ((bsc3d.State() == TopAbs_IN) != bInSolid[i])
+            {
+                cout<<"#McCadVoidCell_Point classification differs from BRep classifier at ("
+                    <<pnt.X()<<", "<<pnt.Y()<<", "<<pnt.Z()<<")"<<endl;
+            }
+        }
     }
 
-    Standard_Real dXmin, dYmin, dZmin, dXmax, dYmax, dZmax;
-    m_bBox.Get(dXmin, dYmin, dZmin, dXmax, dYmax, dZmax);
-
-    gp_Pnt Pnt1(dXmax,dYmax,dZmax);
-    gp_Pnt Pnt2(dXmax,dYmax,dZmin);
-    gp_Pnt Pnt3(dXmax,dYmin,dZmax);
-    gp_Pnt Pnt4(dXmax,dYmin,dZmin);
-
-    gp_Pnt Pnt5(dXmin,dYmin,dZmin);
-    gp_Pnt Pnt6(dXmin,dYmax,dZmin);
-    gp_Pnt Pnt7(dXmin,dYmin,dZmax);
-    gp_Pnt Pnt8(dXmin,dYmax,dZmax);
-
-    m_VertexList->Append(Pnt1);
-    m_VertexList->Append(Pnt2);
-    m_VertexList->Append(Pnt3);
-    m_VertexList->Append(Pnt4);
-    m_VertexList->Append(Pnt5);
-    m_VertexList->Append(Pnt6);
-    m_VertexList->Append(Pnt7);
-    m_VertexList->Append(Pnt8);
+    return iNumIn > 0;
 }
 
 
@@ -760,6 +857,33 @@ TCollection_AsciiString McCadVoidCell::GetExpression()
 
 
 
+/** ********************************************************************
+* @brief Get the length of expression given by GetExpression. The lengths
+*        of collisions are summed when they are added, only the numbers of
+*        six boundary surfaces are counted here, so the splitting can be
+*        decided without writing the expression.
+*
+* @param
+* @return Standard_Integer
+*
+* @date 19/10/2026
+* @author  agent
+***********************************************************************/
+Standard_Integer McCadVoidCell::GetExpressionLength()
+{
+    /// ")&" and the numbers with separators, the "(" takes the place of the
+    /// last " " removed, or it is removed itself if there is no surface.
+    Standard_Integer iLength = 2;
+    for (unsigned int i = 0; i < m_BndFaceList.size(); i++)
+    {
+        McCadExtBndFace * pExtFace = m_BndFaceList[i];
+        iLength += McCadVoidCollision::SurfNumLength(pExtFace->GetFaceNum(),Standard_False) + 1;
+    }
+    return iLength + m_iCollisionLength;
+}
+
+
+
 
 /** ********************************************************************
 * @brief Get the MCNP cell expression of out space, this is used for the
@@ -832,13 +956,16 @@ vector<McCadExtBndFace*> McCadVoidCell::GetGeomFaceList()
 *
 * @param vector<McCadVoidCell*> & void_list
          McCadGeomData *pData
+         Standard_Boolean bShowProgress   Send the progress or not
 * @return TCollection_AsciiString
 *
 * @date 31/8/2012
+* @modify 19/10/2026
 * @author  Lei Lu
 ***********************************************************************/
 Standard_Boolean McCadVoidCell::SplitVoidCell(vector<McCadVoidCell*> & void_list,
-                                              McCadGeomData *pData)
+                                              McCadGeomData *pData,
+                                              Standard_Boolean bShowProgress)
 {        
     /// In order to prevent the splitting from running inifinitly,
     /// If the split depth larger than the given limitation, stop the recursion.
@@ -847,35 +974,59 @@ Standard_Boolean McCadVoidCell::SplitVoidCell(vector<McCadVoidCell*> & void_list
         return Standard_False;
     }
 
-    //cout<<"Expression   "<<this->GetExpression().Length()<<"    "<<McCadConvertConfig::GetMaxDiscLength()<<endl;
+    //cout<<"Expression   "<<this->GetExpressionLength()<<"    "<<McCadConvertConfig::GetMaxDiscLength()<<endl;
     /// If the expression length is longer than limitation.
-    if (this->GetExpression().Length() > McCadConvertConfig::GetMaxDiscLength())
+    if (this->GetExpressionLength() > McCadConvertConfig::GetMaxDiscLength())
     {
         /// Split the void into two parts with X, Y or Z plane, calculate the
         /// lengthes in three direction, choose the longest as splitting plane.
         gp_Pnt max_pntA,min_pntA;
         gp_Pnt max_pntB,min_pntB;
 
+        /// With adaptive splitting, choose the plane separating the collided solids,
+        /// the weight of each solid is the length of its collision expression.
+        Standard_Boolean bChosen = Standard_False;
+        Standard_Real fSplitPos = 0.0;
+        if (McCadConvertConfig::AdaptiveVoidSplit())
+        {
+            vector<McCadConvexSolid *> solid_list = pData->GetConvexSolid();
+            vector<Bnd_Box> box_list;
+            vector<Standard_Real> weight_list;
+            for (unsigned int i = 0; i < m_CollisionList.size(); i++)
+            {
+                McCadVoidCollision *pCollision = m_CollisionList.at(i);
+                McCadConvexSolid *pSolid = solid_list.at(pCollision->GetColliedSolidNum()-1);
+                box_list.push_back(pSolid->GetBntBox());
+                weight_list.push_back(McCadVoidKdTree::SolidWeight(pCollision->GetFaceNumList().size()
+                                                                   + pCollision->GetAstFaceNumList().size()));
+            }
+            bChosen = McCadVoidKdTree::ChooseSplitPlane(box_list, weight_list, m_MinPnt, m_MaxPnt,
+                                                        m_SplitAxis, fSplitPos);
+        }
+
         double xLength = Abs(m_MaxPnt.X() - m_MinPnt.X());
         double yLength = Abs(m_MaxPnt.Y() - m_MinPnt.Y());
         double zLength = Abs(m_MaxPnt.Z() - m_MinPnt.Z());
 
-        if (xLength >= yLength && xLength >= zLength)
-        {
-            m_SplitAxis = XAxis;
-        }
-        else if (yLength >= zLength)
-        {
-            m_SplitAxis = YAxis;
-        }
-        else
+        if (!bChosen)
         {
-            m_SplitAxis = ZAxis;
+            if (xLength >= yLength && xLength >= zLength)
+            {
+                m_SplitAxis = XAxis;
+            }
+            else if (yLength >= zLength)
+            {
+                m_SplitAxis = YAxis;
+            }
+            else
+            {
+                m_SplitAxis = ZAxis;
+            }
         }
 
         if(this->m_SplitAxis == XAxis)
         {
-            Standard_Integer xMid = (m_MaxPnt.X()+ m_MinPnt.X())/2;
+            Standard_Integer xMid = bChosen ? fSplitPos : (m_MaxPnt.X()+ m_MinPnt.X())/2;
 
             max_pntA.SetCoord(xMid,m_MaxPnt.Y(),m_MaxPnt.Z());
             min_pntA.SetCoord(m_MinPnt.X(),m_MinPnt.Y(),m_MinPnt.Z());
@@ -885,7 +1036,7 @@ Standard_Boolean McCadVoidCell::SplitVoidCell(vector<McCadVoidCell*> & void_list
         }
         else if(this->m_SplitAxis == YAxis)
         {
-            Standard_Integer yMid = (m_MaxPnt.Y()+ m_MinPnt.Y())/2;
+            Standard_Integer yMid = bChosen ? fSplitPos : (m_MaxPnt.Y()+ m_MinPnt.Y())/2;
 
             max_pntA.SetCoord(m_MaxPnt.X(),yMid,m_MaxPnt.Z());
             min_pntA.SetCoord(m_MinPnt.X(),m_MinPnt.Y(),m_MinPnt.Z());
@@ -896,7 +1047,7 @@ Standard_Boolean McCadVoidCell::SplitVoidCell(vector<McCadVoidCell*> & void_list
         }
         else if(this->m_SplitAxis == ZAxis)
         {
-            Standard_Integer zMid = (m_MaxPnt.Z()+ m_MinPnt.Z())/2;
+            Standard_Integer zMid = bChosen ? fSplitPos : (m_MaxPnt.Z()+ m_MinPnt.Z())/2;
 
             max_pntA.SetCoord(m_MaxPnt.X(),m_MaxPnt.Y(),zMid);
             min_pntA.SetCoord(m_MinPnt.X(),m_MinPnt.Y(),m_MinPnt.Z());
@@ -909,20 +1060,20 @@ Standard_Boolean McCadVoidCell::SplitVoidCell(vector<McCadVoidCell*> & void_list
         McCadVoidCell * pVoidA = new McCadVoidCell(BRepPrimAPI_MakeBox(min_pntA,max_pntA).Solid());
         McCadVoidCell * pVoidB = new McCadVoidCell(BRepPrimAPI_MakeBox(min_pntB,max_pntB).Solid());
 
-        /// Transfer the collied solids to the child void boxes.
-        pVoidA->SetCollidedSolidNumList(m_CollidedSolidNumList);
-        pVoidB->SetCollidedSolidNumList(m_CollidedSolidNumList);
+        /// Transfer the collied solids and faces to the child void boxes.
+        pVoidA->InheritCollisions(this);
+        pVoidB->InheritCollisions(this);
 
         //msg->sig_progress_part(0);
-        pVoidA->CalColliedFaces(pData);
+        pVoidA->CalColliedFaces(pData, bShowProgress);
         //msg->sig_progress_part(50);
-        pVoidB->CalColliedFaces(pData);
+        pVoidB->CalColliedFaces(pData, bShowProgress);
         //msg->sig_progress_part(100);
 
         pVoidA->SetSplitDepth(m_iSplitDepth+1);
         pVoidB->SetSplitDepth(m_iSplitDepth+1);
 
-        if(!pVoidA->SplitVoidCell(void_list,pData)) /// If the void box can not be split further
+        if(!pVoidA->SplitVoidCell(void_list,pData,bShowProgress)) /// If the void box can not be split further
         {
             void_list.push_back(pVoidA);
         }
@@ -932,7 +1083,7 @@ Standard_Boolean McCadVoidCell::SplitVoidCell(vector<McCadVoidCell*> & void_list
             pVoidA = NULL;
         }
 
-        if(!pVoidB->SplitVoidCell(void_list,pData)) /// If the void box can not be split further
+        if(!pVoidB->SplitVoidCell(void_list,pData,bShowProgress)) /// If the void box can not be split further
         {
             void_list.push_back(pVoidB);           
         }
@@ -988,6 +1139,74 @@ void McCadVoidCell::SetCollidedSolidNumList(vector<int> theCollidedSolidNumList
 
 
 
+/** ********************************************************************
+* @brief Take the collisions of parent box as the candidates of child box.
+*        The collied solids and their collied faces are transferred, the
+*        faces not collied with parent box are not checked again. The
+*        range out of the split plane is recorded, the collied faces of
+*        parent within it are collied with the child box as well.
+*
+* @param McCadVoidCell * pParent
+* @return void
+*
+* @date 19/10/2026
+* @author  agent
+***********************************************************************/
+void McCadVoidCell::InheritCollisions(McCadVoidCell * pParent)
+{
+    SetCollidedSolidNumList(pParent->m_CollidedSolidNumList);
+
+    m_InheritFaceList.clear();
+    for (unsigned int i = 0; i < pParent->m_CollisionList.size(); i++)
+    {
+        m_InheritFaceList.push_back(pParent->m_CollisionList.at(i)->GetFaceIndexList());
+    }
+    assert(m_InheritFaceList.size() == m_CollidedSolidNumList.size());
+
+    /// Only the bounds on the split plane are different from the parent box.
+    Standard_Real fTol = Precision::Confusion();
+    for (Standard_Integer k = 0; k < 3; k++)
+    {
+        Standard_Real fMin = m_MinPnt.Coord(k+1), fMax = m_MaxPnt.Coord(k+1);
+        m_fInheritMin[k] = fMin > pParent->m_MinPnt.Coord(k+1) + fTol ? fMin : -RealLast();
+        m_fInheritMax[k] = fMax < pParent->m_MaxPnt.Coord(k+1) - fTol ? fMax : RealLast();
+    }
+    m_bInherited = Standard_True;
+}
+
+
+
+/** ********************************************************************
+* @brief The box of face does not cross the split plane of the parent
+*        box, so the part of face in the parent box is in this box.
+*
+* @param Bnd_Box & box
+* @return Standard_Boolean
+*
+* @date 19/10/2026
+* @author  agent
+***********************************************************************/
+Standard_Boolean McCadVoidCell::IsInInheritRange(Bnd_Box & box)
+{
+    if (box.IsVoid())
+    {
+        return Standard_False;
+    }
+
+    Standard_Real fMin[3], fMax[3];
+    box.Get(fMin[0], fMin[1], fMin[2], fMax[0], fMax[1], fMax[2]);
+    for (Standard_Integer k = 0; k < 3; k++)
+    {
+        if (fMin[k] < m_fInheritMin[k] || fMax[k] > m_fInheritMax[k])
+        {
+            return Standard_False;
+        }
+    }
+    return Standard_True;
+}
+
+
+
 
 
 /** ********************************************************************
@@ -1038,6 +1257,12 @@ void McCadVoidCell::ChangeFaceNum(McCadGeomData *pData)
             pCollision->ChangeAstFaceNum(k,iAstFaceNumNew);
         }
     }
+
+    m_iCollisionLength = 0;
+    for (unsigned int i = 0; i < m_CollisionList.size(); i++)
+    {
+        m_iCollisionLength += m_CollisionList.at(i)->GetExpLength();
+    }
 }
 
 
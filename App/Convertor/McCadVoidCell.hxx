@@ -56,13 +56,16 @@ private:
     Bnd_Box m_bBox;                                 /**< The boundary box */
 
     vector<McCadVoidCollision *> m_CollisionList;   /**< Record the collied convex solids */
+    Standard_Boolean m_bInherited;                  /**< The collisions are inherited from parent box */
+    vector< vector<int> > m_InheritFaceList;        /**< Collied face indexes of parent for each solid */
+    Standard_Real m_fInheritMin[3];                 /**< The inherited faces within the range */
+    Standard_Real m_fInheritMax[3];                 /**< are collied without checking again */
+    Standard_Integer m_iCollisionLength;            /**< Expression length of the collisions */
     vector<McCadExtBndFace*> m_BndFaceList;         /**< Boundary faces list of void solid */
 
     SplitAxis m_SplitAxis;          /**< if the box contains too many collied surfaces, split the box using X,Y or Z*/
     unsigned int m_iSplitDepth;     /**< How many levels has been splitted */
 
-    Handle_TColgp_HSequenceOfPnt m_VertexList;      /**< The vertex of void box */
-
 public:  
 
     Bnd_Box GetBntBox();            /**< Get the boundary box */
@@ -76,19 +79,22 @@ public:
     vector<McCadExtBndFace*> GetGeomFaceList();     /**< Get the boundary faces of void box */
 
     /**< if the void expression is too long, split it into two parts */
-    Standard_Boolean SplitVoidCell(vector<McCadVoidCell*> & void_list,McCadGeomData * pData);
+    Standard_Boolean SplitVoidCell(vector<McCadVoidCell*> & void_list,McCadGeomData * pData,
+                                   Standard_Boolean bShowProgress = Standard_True);
 
     void SetSplitDepth(Standard_Integer iSplitDepth);   /**< Set the split depth */
+    void InheritCollisions(McCadVoidCell * pParent);    /**< Take the collisions of parent box as candidates */
     void ChangeFaceNum(McCadGeomData * pData);          /**< Change the face number after surface sorting */
-    void CalColliedFaces(McCadGeomData *pData);         /**< Calculate which surfaces of material solid collied with box */
+    /**< Calculate which surfaces of material solid collied with box */
+    void CalColliedFaces(McCadGeomData *pData, Standard_Boolean bShowProgress = Standard_True);
 
     vector<McCadExtBndFace *> GetBndFaces();            /**< Get the boundary faces of void box */
     vector<McCadVoidCollision*> GetCollisions();        /**< Get the collisions with material solids*/
 
 private:
 
-    void SetVertexList();                               /**< Get the vertexes and save into list */
     TCollection_AsciiString GetExpression();            /**< Get the expression of void cell */
+    Standard_Integer GetExpressionLength();             /**< Get the length of expression without writing it */
     Standard_Boolean IsPointInBBox(gp_Pnt pnt);         /**< If the point is in the box */
 
     /**< Set the collied solid index list */
@@ -97,8 +103,10 @@ private:
     Standard_Boolean IsVertexInSolid(McCadConvexSolid *& pSolid);   /**< If the vertex of box is in the solid */
     Standard_Boolean CalColliedFace(McCadExtBndFace *&theFace);     /**< The box is collied with face */
     Standard_Boolean CalColliedBox(Bnd_Box & box);                  /**< If the box is collied with another box*/
+    Standard_Boolean IsInInheritRange(Bnd_Box & box);               /**< The box does not cross the split plane */
 
-    Standard_Boolean CalColliedTriangle(vector<McCadTriangle*> triangle_list);
+    /**< If the triangles are collied with box, the box is enlarged with the gap */
+    Standard_Boolean CalColliedTriangle(vector<McCadTriangle*> triangle_list, Standard_Real fGap = 0.0);
 
     /**< Calculate the collision with sample points */
     Standard_Boolean CalColliedPoints(Handle_TColgp_HSequenceOfPnt point_list);
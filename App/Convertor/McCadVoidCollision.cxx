@@ -1,7 +1,13 @@
 #include "McCadVoidCollision.hxx"
 
+#include <stdlib.h>
+#include "../Tools/McCadConvertConfig.hxx"
+
 McCadVoidCollision::McCadVoidCollision()
 {
+    m_iSolidNum = 0;
+    m_iFaceLength = 0;
+    m_iAstFaceLength = 0;
 }
 
 McCadVoidCollision::~McCadVoidCollision()
@@ -47,6 +53,7 @@ void McCadVoidCollision::AddColliedFace(int iFaceNum)
     if(bRepeat == Standard_False)
     {
         m_FaceNumList.push_back(iFaceNum);
+        m_iFaceLength += SurfNumLength(iFaceNum,Standard_True) + 1;   // Number and ":"
     }
 }
 
@@ -76,6 +83,7 @@ void McCadVoidCollision::AddColliedAstFace(int iAstFaceNum)
     if(bRepeat == Standard_False)
     {
         m_AstFaceNumList.push_back(iAstFaceNum);
+        m_iAstFaceLength += SurfNumLength(iAstFaceNum,Standard_True) + 1;   // Number and " "
     }
 }
 
@@ -137,11 +145,44 @@ vector<int> McCadVoidCollision::GetAstFaceNumList()
 ***********************************************************************/
 void McCadVoidCollision::ChangeFaceNum(int index, int value)
 {  
+    m_iFaceLength += SurfNumLength(value,Standard_True)
+                   - SurfNumLength(m_FaceNumList.at(index),Standard_True);
     m_FaceNumList.at(index) = value;
 }
 
 
 
+/** ********************************************************************
+* @brief Add the index of collied face in the boundary face list of
+*        solid, the child void boxes check only these faces again.
+* @param int index
+* @return void
+*
+* @date 19/10/2026
+* @author  agent
+***********************************************************************/
+void McCadVoidCollision::AddColliedFaceIndex(int index)
+{
+    m_FaceIndexList.push_back(index);
+}
+
+
+
+/** ********************************************************************
+* @brief Get the indexes of collied faces in boundary face list of solid
+* @param
+* @return vector<int>
+*
+* @date 19/10/2026
+* @author  agent
+***********************************************************************/
+vector<int> McCadVoidCollision::GetFaceIndexList()
+{
+    return m_FaceIndexList;
+}
+
+
+
 /** ********************************************************************
 * @brief Change the assisted face number at collied face list
 * @param int index, int value
@@ -152,6 +193,8 @@ void McCadVoidCollision::ChangeFaceNum(int index, int value)
 ***********************************************************************/
 void McCadVoidCollision::ChangeAstFaceNum(int index, int value)
 {
+    m_iAstFaceLength += SurfNumLength(value,Standard_True)
+                      - SurfNumLength(m_AstFaceNumList.at(index),Standard_True);
     m_AstFaceNumList.at(index) = value;
 }
 
@@ -169,3 +212,58 @@ void McCadVoidCollision::ChangeSolidNum(int iSolidNum )
 {
     m_iSolidNum = iSolidNum;
 }
+
+
+
+/** ********************************************************************
+* @brief Get the length of the expression of collision written by
+*        McCadVoidCell::GetExpression, it is updated when the surfaces
+*        are added or changed, no string is generated.
+*
+* @param
+* @return Standard_Integer
+*
+* @date 19/10/2026
+* @author  agent
+***********************************************************************/
+Standard_Integer McCadVoidCollision::GetExpLength()
+{
+    /// "(" + surfaces + ")&", the assisted surfaces are written in
+    /// brackets only if there are more than one.
+    Standard_Integer iLength = 3 + m_iFaceLength;
+    if (m_AstFaceNumList.size() > 1)
+    {
+        iLength += m_iAstFaceLength + 1;    // "(" and ")" replace the last " "
+    }
+    return iLength;
+}
+
+
+
+/** ********************************************************************
+* @brief Get the length of surface number written in the expression,
+*        the initial surface number is added as McCadVoidCell does.
+*
+* @param int iFaceNum
+*        Standard_Boolean bComplement   The surface is written with minus
+* @return Standard_Integer
+*
+* @date 19/10/2026
+* @author  agent
+***********************************************************************/
+Standard_Integer McCadVoidCollision::SurfNumLength(int iFaceNum, Standard_Boolean bComplement)
+{
+    int iInitSurfNum = McCadConvertConfig::GetInitSurfNum()-1;
+    iFaceNum > 0 ? iFaceNum += iInitSurfNum : iFaceNum -= iInitSurfNum;
+    if (bComplement)
+    {
+        iFaceNum *= -1;
+    }
+
+    Standard_Integer iLength = iFaceNum < 0 ? 2 : 1;    // Minus sign and the first digit
+    for (int iAbs = abs(iFaceNum); iAbs >= 10; iAbs /= 10)
+    {
+        iLength++;
+    }
+    return iLength;
+}
@@ -31,19 +31,29 @@ public:
     void SetColliedSolidNum(int iSolidNum);     /**< Set the number of collied solid */
     void AddColliedFace(int iFaceNum);          /**< Add the boundary surface numbers of collied solid */
     void AddColliedAstFace(int iAstFaceNum);    /**< Add the assisted surface numbers of collied solid */
+    void AddColliedFaceIndex(int index);        /**< Add the index of collied face in boundary face list of solid */
 
     Standard_Integer GetColliedSolidNum();      /**< Get the collied solid number */
     vector<int> GetFaceNumList();               /**< Get the face number of collied solid */
     vector<int> GetAstFaceNumList();            /**< Get the assisted surface number of collied solid */
+    vector<int> GetFaceIndexList();             /**< Get the indexes of collied faces of solid */
     void ChangeFaceNum(int index, int value);   /**< Change the surface number by giving index */
     void ChangeSolidNum(int iSolidNum );        /**< Change the collied solid number */
     void ChangeAstFaceNum(int index, int value);/**< Change the assisted surface number of collied solid */
 
+    Standard_Integer GetExpLength();            /**< Get the length of expression of collision */
+    /**< Get the length of surface number written in expression, the sense is reversed if bComplement */
+    static Standard_Integer SurfNumLength(int iFaceNum, Standard_Boolean bComplement);
+
 private:
 
     int m_iSolidNum;                    /**< Collied solid number */
     vector<int> m_FaceNumList;          /**< Collied boundary surface numbers */
     vector<int> m_AstFaceNumList;       /**< Collied assisted surface numbers */
+    vector<int> m_FaceIndexList;        /**< Indexes of collied faces, empty if the box is in solid */
+
+    Standard_Integer m_iFaceLength;     /**< Length of collied surface numbers with separators */
+    Standard_Integer m_iAstFaceLength;  /**< Length of assisted surface numbers with separators */
 };
 
 #endif // MCCADVOIDCOLLISION_HXX
@@ -3,6 +3,11 @@
 #include <assert.h>
 #include <BRepBndLib.hxx>
 #include <BRepPrimAPI_MakeBox.hxx>
+#include <Standard_Version.hxx>
+#include <omp.h>
+
+#include "McCadVoidKdTree.hxx"
+#include "McCadSolidBVH.hxx"
 
 #include "../Tools/McCadMathTool.hxx"
 #include "../Tools/McCadConvertConfig.hxx"
@@ -71,6 +76,31 @@ void McCadVoidGenerator::GenVoidCells()
     pVoid->SetBntBox(dXmin,dYmin,dZmin,dXmax,dYmax,dZmax);
     pData->m_pOutVoid = pVoid;
 
+    /* Split the boundary box adaptively, the planes are chosen from the boundaries
+       of solids and the empty space is not split */
+    if (McCadConvertConfig::AdaptiveVoidSplit())
+    {
+        vector<gp_Pnt> leaf_min_list, leaf_max_list;
+        McCadVoidKdTree theTree(pData);
+        theTree.Build(bnd_min_pnt, bnd_max_pnt, leaf_min_list, leaf_max_list);
+
+        for (unsigned int i = 0; i < leaf_min_list.size(); i++)
+        {
+            gp_Pnt min_pnt = leaf_min_list.at(i);
+            gp_Pnt max_pnt = leaf_max_list.at(i);
+
+            pData->m_listVoidCell->Append(BRepPrimAPI_MakeBox(min_pnt,max_pnt).Shape());
+
+            McCadVoidCell * pVoid = new McCadVoidCell(BRepPrimAPI_MakeBox(min_pnt,max_pnt).Solid());
+            pVoid->SetBntBox(min_pnt.X(),min_pnt.Y(),min_pnt.Z(),max_pnt.X(),max_pnt.Y(),max_pnt.Z());
+            pData->m_VoidCellList.push_back(pVoid);
+        }
+
+        m_pManager->PrintInfo(QString::fromLatin1("%1 void cells are generated").arg(leaf_min_list.size()).toStdString().c_str(),true);
+        m_pManager->SetPartProgressBar(100);
+        return;
+    }
+
     /* Split the boundar box into several parts */
     int iSplit = McCadConvertConfig::GetInitVoidBoxNum();
     for (int iX = 0 ; iX < iSplit ; iX++)
@@ -133,6 +163,20 @@ void McCadVoidGenerator::VoidSolidCollision()
 
     try
     {
+        /// Build the hierarchy of the boundary boxes of material solids once,
+        /// the void cells find the collided boxes without checking every solid.
+        vector<Bnd_Box> box_list;
+        for (unsigned int j = 0; j < pData->m_ConvexSolidList.size(); j++)
+        {
+            McCadConvexSolid  *pSolid = pData->m_ConvexSolidList.at(j);
+            assert(pSolid);
+            box_list.push_back(pSolid->GetBntBox());
+        }
+
+        McCadSolidBVH theBVH;
+        theBVH.Build(box_list);
+
+        vector<Standard_Integer> index_list;
         for (unsigned int i = 0; i < pData->m_VoidCellList.size(); i++)
         {
             McCadVoidCell *pVoid = pData->m_VoidCellList.at(i);
@@ -141,25 +185,14 @@ void McCadVoidGenerator::VoidSolidCollision()
             m_pManager->PrintInfo(QString::fromLatin1("Processing No. %1 void cell:").arg(i+1).toStdString().c_str(),true);
             m_pManager->SetPartProgressBar(int((i+1)*fs));            
 
-            for (unsigned int j = 0; j < pData->m_ConvexSolidList.size(); j++)
+            Bnd_Box bbox_void = pVoid->GetBntBox();
+            theBVH.Query(bbox_void, index_list);    // Detect the boundary boxes are collied or not
+
+            for (unsigned int j = 0; j < index_list.size(); j++)
             {
-                McCadConvexSolid  *pSolid = pData->m_ConvexSolidList.at(j);
-                assert(pSolid);
-
-                Bnd_Box bbox_solid = pSolid->GetBntBox();
-                Bnd_Box bbox_void = pVoid->GetBntBox();               
-
-                if(bbox_void.IsOut(bbox_solid))     // Detect the boundary boxes are collied or not
-                {
-                    continue;
-                }
-                else
-                {
-                    // Add the collided material solid's number into the void cell's list.
-                    pVoid->AddColliedSolidNum(j);
-                }
+                // Add the collided material solid's number into the void cell's list.
+                pVoid->AddColliedSolidNum(index_list[j]);
             }
-
         }
 
     }
@@ -175,13 +208,15 @@ void McCadVoidGenerator::VoidSolidCollision()
 
 
 /** ********************************************************************
-* @brief Calculate the collision between faces of solid and void cell
+* @brief Calculate the collision between faces of solid and void cell.
+*        The void cells are independent of each other, they are
+*        processed in parallel and only read the convex solids.
 *
 * @param const vector<McCadExtFace*> & theExtFaceList
 * @return void
 *
 * @date 31/8/2012
-* @modify  10/12/2013
+* @modify  19/10/2026
 * @author  Lei Lu
 ***********************************************************************/
 void McCadVoidGenerator::VoidFaceCollision()
@@ -191,26 +226,64 @@ void McCadVoidGenerator::VoidFaceCollision()
     m_pManager->SetPartProgressBar(0);
     m_pManager->PrintInfo("Check solid-face collision",true);
     int iSize = pData->m_VoidCellList.size();
-    float fs = 100.0/iSize;    
+    float fs = 100.0/iSize;
+    int iFinished = 0;
 
-    try
+    /// The boundary boxes of faces are generated when they are firstly used,
+    /// generate them here before the void cells read them in parallel.
+    for (unsigned int i = 0; i < pData->m_ConvexSolidList.size(); i++)
     {
-        for (unsigned int i = 0; i < pData->m_VoidCellList.size(); i++)
+        vector<McCadExtBndFace *> face_list = pData->m_ConvexSolidList.at(i)->GetSTLFaceList();
+        for (unsigned int j = 0; j < face_list.size(); j++)
         {
-            McCadVoidCell *pVoid = pData->m_VoidCellList.at(i);
-            assert(pVoid);
-            //cout<<"Void cell " << i+1 << " is collided with:";
-
-            m_pManager->SetPartProgressBar(int((i+1)*fs));
-
-            pVoid->CalColliedFaces(m_pManager->GetGeomData()); // Calculate the collision between the void cell and boundary surface.
-            m_pManager->PrintInfo(QString::fromLatin1("Processing No. %1 void cell:").arg(i+1).toStdString().c_str(),true);
+            face_list.at(j)->GetBndBox();
+            vector<McCadExtBndFace *> same_list = face_list.at(j)->GetSameFaces();
+            for (unsigned int k = 0; k < same_list.size(); k++)
+            {
+                same_list.at(k)->GetBndBox();
+            }
         }
-        //cout<<endl<<endl;
     }
-    catch(...)
+
+    /// The boolean operations and meshing of OCC before 7.2 are not safe to
+    /// run at the same time, the void cells are processed in turn.
+#if OCC_VERSION_HEX >= 0x070200
+    const bool bParallel = true;
+#else
+    const bool bParallel = false;
+#endif
+
+#pragma omp parallel for schedule(dynamic) if(bParallel)
+    for (int i = 0; i < iSize; i++)
     {
-        cout << "#McCadVoidCellManage_Void & Face Collision Error" << endl;
+        /// Only the calling thread sends the messages to the dialog
+        Standard_Boolean bMaster = Standard_True;
+#ifdef _OPENMP
+        bMaster = (omp_get_thread_num() == 0);
+#endif
+        McCadVoidCell *pVoid = pData->m_VoidCellList.at(i);
+        assert(pVoid);
+
+        try
+        {
+            pVoid->CalColliedFaces(pData, bMaster); // Calculate the collision between the void cell and boundary surface.
+        }
+        catch(...)
+        {
+            cout << "#McCadVoidCellManage_Void & Face Collision Error" << endl;
+        }
+
+        int iProgress = 0;
+#pragma omp critical(McCadVoidGenerator_Collision)
+        {
+            iFinished++;
+            iProgress = iFinished;
+        }
+        if(bMaster)
+        {
+            m_pManager->SetPartProgressBar(int(iProgress*fs));
+            m_pManager->PrintInfo(QString::fromLatin1("Processing No. %1 void cell:").arg(iProgress).toStdString().c_str(),true);
+        }
     }
 
     m_pManager->SetPartProgressBar(100);
@@ -219,58 +292,99 @@ void McCadVoidGenerator::VoidFaceCollision()
 
 /** ********************************************************************
 * @brief Split the void cell if the length of description is beyond the
-*        limitation.
+*        limitation. Each void cell is split in parallel into its own
+*        list, then the lists are merged in the order of void cells, so
+*        the void cells are numbered as they are split one by one.
 *
 * @param const vector<McCadExtFace*> & theExtFaceList
 * @return void
 *
 * @date 31/8/2012
-* @modify  10/12/2013
+* @modify  19/10/2026
 * @author  Lei Lu
 ***********************************************************************/
 void McCadVoidGenerator::SplitVoidCell()
 {
     m_pManager->SetPartProgressBar(0);
 
-    try
-    {
-        McCadGeomData * pData = m_pManager->GetGeomData();
-        vector <McCadVoidCell *> void_list; // Create a temporary void cell list to store the void cells after splitting.
+    McCadGeomData * pData = m_pManager->GetGeomData();
 
-        int iSize = pData->m_VoidCellList.size();
-        float fs = 100.0/iSize;        
-        int iStep = 1;
+    int iSize = pData->m_VoidCellList.size();
+    float fs = 100.0/iSize;        
+    int iFinished = 0;
 
-        for (unsigned int i = 0; i < pData->m_VoidCellList.size(); i++)
+    vector< vector<McCadVoidCell *> > split_list(iSize);   // The void cells generated by splitting each void cell
+    vector<char> split_flag(iSize, 0);                     // The void cell is split or not
+
+    /// The splitting uses the boolean operations, see VoidFaceCollision
+#if OCC_VERSION_HEX >= 0x070200
+    const bool bParallel = true;
+#else
+    const bool bParallel = false;
+#endif
+
+#pragma omp parallel for schedule(dynamic) if(bParallel)
+    for (int i = 0; i < iSize; i++)
+    {
+        /// Only the calling thread sends the messages to the dialog
+        Standard_Boolean bMaster = Standard_True;
+#ifdef _OPENMP
+        bMaster = (omp_get_thread_num() == 0);
+#endif
+        McCadVoidCell * pVoid = pData->m_VoidCellList.at(i);
+        assert(pVoid);
+        pVoid->SetSplitDepth(1);                            // Set the initial split depth.
+
+        try
         {
-            McCadVoidCell * pVoid = pData->m_VoidCellList.at(i);
-            assert(pVoid);
-            pVoid->SetSplitDepth(1);                            // Set the initial split depth.
-
-            //cout<<"Processing the "<<i+1<<" void cell:"<<endl;
-            m_pManager->PrintInfo(QString::fromLatin1("Processing the %1 void cell:").arg(iStep++).toStdString().c_str(),true);
-            if( pVoid->SplitVoidCell(void_list, m_pManager->GetGeomData()))
-            {                
-                pData->m_VoidCellList.erase(pData->m_VoidCellList.begin()+i); // Delete the original void cell
-                i--;                                            // Move the point to the former position
+            if( pVoid->SplitVoidCell(split_list[i], pData, bMaster))
+            {
+                split_flag[i] = 1;
             }
+        }
+        catch(...)
+        {
+            cout << "#McCadVoidCellManage_Void & Splitting Void Cell Error" << endl;
 
-            m_pManager->SetPartProgressBar(int((iStep)*fs));
+            /// The void cell is kept unsplit, drop the cells split before the error
+            for (unsigned int j = 0; j < split_list[i].size(); j++)
+            {
+                delete split_list[i].at(j);
+            }
+            split_list[i].clear();
+        }
 
-            //cout<<endl;
+        int iProgress = 0;
+#pragma omp critical(McCadVoidGenerator_Split)
+        {
+            iFinished++;
+            iProgress = iFinished;
         }
+        if(bMaster)
+        {
+            m_pManager->PrintInfo(QString::fromLatin1("Processing the %1 void cell:").arg(iProgress).toStdString().c_str(),true);
+            m_pManager->SetPartProgressBar(int(iProgress*fs));
+        }
+    }
 
-        for (unsigned int j = 0; j < void_list.size(); j++)
+    /// The void cells not split keep their order, the new void cells are added after them
+    vector <McCadVoidCell *> void_list;
+    for (int i = 0; i < iSize; i++)
+    {
+        if (!split_flag[i])
         {
-            pData->m_VoidCellList.push_back(void_list.at(j));          // Add the new void cell generated into void cell list.
+            void_list.push_back(pData->m_VoidCellList.at(i));
         }
-        void_list.clear();
     }
-    catch(...)
+    for (int i = 0; i < iSize; i++)
     {
-        cout << "#McCadVoidCellManage_Void & Splitting Void Cell Error" << endl;
+        for (unsigned int j = 0; j < split_list[i].size(); j++)
+        {
+            void_list.push_back(split_list[i].at(j));          // Add the new void cell generated into void cell list.
+        }
+        split_list[i].clear();
     }
-
+    pData->m_VoidCellList.swap(void_list);
 }
 
 
@@ -0,0 +1,298 @@
+#include "McCadVoidKdTree.hxx"
+
+#include <algorithm>
+#include <math.h>
+#include <assert.h>
+#include <Standard_Real.hxx>
+
+#include "McCadGeomData.hxx"
+#include "../Tools/McCadMathTool.hxx"
+#include "../Tools/McCadConvertConfig.hxx"
+
+McCadVoidKdTree::McCadVoidKdTree(McCadGeomData * pData)
+{
+    m_pData = pData;
+    m_fMaxWeight = McCadConvertConfig::GetMaxDiscLength();
+    m_iMaxDepth = McCadConvertConfig::GetVoidDecomposeDepth();
+
+    /// The boxes and weights of solids are read once for the whole subdivision
+    vector<McCadConvexSolid *> solid_list = m_pData->GetConvexSolid();
+    for (unsigned int i = 0; i < solid_list.size(); i++)
+    {
+        McCadConvexSolid * pSolid = solid_list.at(i);
+        assert(pSolid);
+        m_SolidBoxList.push_back(pSolid->GetBntBox());
+
+        Standard_Integer iFaceNum = 0;
+        vector<McCadExtBndFace *> face_list = pSolid->GetSTLFaceList();
+        for (unsigned int j = 0; j < face_list.size(); j++)
+        {
+            iFaceNum += 1 + face_list.at(j)->GetAstFaces().size();
+        }
+        m_WeightList.push_back(SolidWeight(iFaceNum));
+    }
+}
+
+McCadVoidKdTree::~McCadVoidKdTree()
+{
+    m_SolidBoxList.clear();
+    m_WeightList.clear();
+}
+
+
+
+/** ********************************************************************
+* @brief Estimate the length of the expression of collision with solid,
+*        each surface number takes about six characters with its sign
+*        and separator, the brackets and "&" take three.
+*
+* @param Standard_Integer iFaceNum     Number of collided surfaces
+* @return Standard_Real
+*
+* @date 19/10/2026
+* @author  agent
+*********************************************************************/
+Standard_Real McCadVoidKdTree::SolidWeight(Standard_Integer iFaceNum)
+{
+    return 3.0 + 6.0*iFaceNum;
+}
+
+
+
+/** ********************************************************************
+* @brief Split the boundary box of the model into the boxes of void cells
+*
+* @param const gp_Pnt & min_pnt, const gp_Pnt & max_pnt
+*        vector<gp_Pnt> & leaf_min_list    Min points of void boxes
+*        vector<gp_Pnt> & leaf_max_list    Max points of void boxes
+* @return void
+*
+* @date 19/10/2026
+* @author  agent
+*********************************************************************/
+void McCadVoidKdTree::Build(const gp_Pnt & min_pnt, const gp_Pnt & max_pnt,
+                            vector<gp_Pnt> & leaf_min_list, vector<gp_Pnt> & leaf_max_list)
+{
+    vector<Standard_Integer> solid_list;
+    for (unsigned int i = 0; i < m_SolidBoxList.size(); i++)
+    {
+        solid_list.push_back(i);
+    }
+    Split(min_pnt, max_pnt, solid_list, 1, leaf_min_list, leaf_max_list);
+}
+
+
+
+/** ********************************************************************
+* @brief Split the box if the solids in it give a long expression. The
+*        splitting plane separates the solids, if no plane separates
+*        them the box is split at the middle of the longest side.
+*
+* @param const gp_Pnt & min_pnt, const gp_Pnt & max_pnt
+*        const vector<Standard_Integer> & solid_list  Solids overlapping the box
+*        unsigned int iDepth
+*        vector<gp_Pnt> & leaf_min_list, vector<gp_Pnt> & leaf_max_list
+* @return void
+*
+* @date 19/10/2026
+* @author  agent
+*********************************************************************/
+void McCadVoidKdTree::Split(const gp_Pnt & min_pnt, const gp_Pnt & max_pnt,
+                            const vector<Standard_Integer> & solid_list, unsigned int iDepth,
+                            vector<gp_Pnt> & leaf_min_list, vector<gp_Pnt> & leaf_max_list)
+{
+    vector<Bnd_Box> box_list;
+    vector<Standard_Real> weight_list;
+    Standard_Real fWeight = 0.0;
+    for (unsigned int i = 0; i < solid_list.size(); i++)
+    {
+        box_list.push_back(m_SolidBoxList.at(solid_list[i]));
+        weight_list.push_back(m_WeightList.at(solid_list[i]));
+        fWeight += m_WeightList.at(solid_list[i]);
+    }
+
+    SplitAxis theAxis = XAxis;
+    Standard_Real fPos = 0.0;
+    Standard_Boolean bSplit = Standard_False;
+
+    if (fWeight > m_fMaxWeight && iDepth < m_iMaxDepth)
+    {
+        bSplit = ChooseSplitPlane(box_list, weight_list, min_pnt, max_pnt, theAxis, fPos);
+        if (!bSplit)
+        {
+            /// The solids can not be separated, split at the middle as SplitVoidCell does
+            Standard_Real xLength = max_pnt.X() - min_pnt.X();
+            Standard_Real yLength = max_pnt.Y() - min_pnt.Y();
+            Standard_Real zLength = max_pnt.Z() - min_pnt.Z();
+
+            Standard_Real fLow, fHigh;
+            if (xLength >= yLength && xLength >= zLength)
+            {
+                theAxis = XAxis; fLow = min_pnt.X(); fHigh = max_pnt.X();
+            }
+            else if (yLength >= zLength)
+            {
+                theAxis = YAxis; fLow = min_pnt.Y(); fHigh = max_pnt.Y();
+            }
+            else
+            {
+                theAxis = ZAxis; fLow = min_pnt.Z(); fHigh = max_pnt.Z();
+            }
+
+            Standard_Integer iMid = (fLow + fHigh)/2;
+            fPos = iMid;
+            bSplit = (fPos > fLow && fPos < fHigh);
+        }
+    }
+
+    if (!bSplit)
+    {
+        leaf_min_list.push_back(min_pnt);
+        leaf_max_list.push_back(max_pnt);
+        return;
+    }
+
+    gp_Pnt max_pntA(max_pnt), min_pntB(min_pnt);
+    if (theAxis == XAxis)
+    {
+        max_pntA.SetX(fPos);
+        min_pntB.SetX(fPos);
+    }
+    else if (theAxis == YAxis)
+    {
+        max_pntA.SetY(fPos);
+        min_pntB.SetY(fPos);
+    }
+    else
+    {
+        max_pntA.SetZ(fPos);
+        min_pntB.SetZ(fPos);
+    }
+
+    Bnd_Box bbox_A, bbox_B;
+    bbox_A.Update(min_pnt.X(), min_pnt.Y(), min_pnt.Z(), max_pntA.X(), max_pntA.Y(), max_pntA.Z());
+    bbox_B.Update(min_pntB.X(), min_pntB.Y(), min_pntB.Z(), max_pnt.X(), max_pnt.Y(), max_pnt.Z());
+
+    vector<Standard_Integer> solid_list_A, solid_list_B;
+    for (unsigned int i = 0; i < solid_list.size(); i++)
+    {
+        if (!bbox_A.IsOut(box_list.at(i)))
+        {
+            solid_list_A.push_back(solid_list[i]);
+        }
+        if (!bbox_B.IsOut(box_list.at(i)))
+        {
+            solid_list_B.push_back(solid_list[i]);
+        }
+    }
+
+    Split(min_pnt, max_pntA, solid_list_A, iDepth+1, leaf_min_list, leaf_max_list);
+    Split(min_pntB, max_pnt, solid_list_B, iDepth+1, leaf_min_list, leaf_max_list);
+}
+
+
+
+/** ********************************************************************
+* @brief Choose the splitting plane among the boundaries of the boxes.
+*        The boxes on the lower side weigh wL, the boxes on the upper
+*        side weigh wR, the straddling boxes are on both sides. The
+*        plane with the least max(wL,wR) is chosen, the plane near the
+*        middle is preferred for the same weight. The positions are
+*        integers as the void boxes.
+*
+* @param const vector<Bnd_Box> & box_list
+*        const vector<Standard_Real> & weight_list
+*        const gp_Pnt & min_pnt, const gp_Pnt & max_pnt   The box to split
+*        SplitAxis & theAxis, Standard_Real & fPos         The splitting plane
+* @return Standard_Boolean
+*
+* @date 19/10/2026
+* @author  agent
+*********************************************************************/
+Standard_Boolean McCadVoidKdTree::ChooseSplitPlane(const vector<Bnd_Box> & box_list,
+                                                   const vector<Standard_Real> & weight_list,
+                                                   const gp_Pnt & min_pnt, const gp_Pnt & max_pnt,
+                                                   SplitAxis & theAxis, Standard_Real & fPos)
+{
+    Standard_Real fTotal = 0.0;
+    for (unsigned int i = 0; i < weight_list.size(); i++)
+    {
+        fTotal += weight_list[i];
+    }
+
+    Standard_Boolean bFound = Standard_False;
+    Standard_Real fBestCost = fTotal;
+    Standard_Real fBestDist = 0.0;
+
+    for (Standard_Integer iAxis = 1; iAxis <= 3; iAxis++)
+    {
+        Standard_Real fLow = min_pnt.Coord(iAxis);
+        Standard_Real fHigh = max_pnt.Coord(iAxis);
+        Standard_Real fLength = fHigh - fLow;
+        if (fLength <= 1.0)
+        {
+            continue;
+        }
+
+        /// The lower and upper bounds sorted with the accumulated weights
+        vector< pair<Standard_Real,Standard_Real> > low_list, high_list;
+        vector<Standard_Real> candidate_list;
+        for (unsigned int i = 0; i < box_list.size(); i++)
+        {
+            Standard_Real fXmin, fYmin, fZmin, fXmax, fYmax, fZmax;
+            box_list[i].Get(fXmin, fYmin, fZmin, fXmax, fYmax, fZmax);
+            gp_Pnt box_min(fXmin, fYmin, fZmin), box_max(fXmax, fYmax, fZmax);
+
+            low_list.push_back(make_pair(box_min.Coord(iAxis), weight_list[i]));
+            high_list.push_back(make_pair(box_max.Coord(iAxis), weight_list[i]));
+            candidate_list.push_back(box_min.Coord(iAxis));
+            candidate_list.push_back(box_max.Coord(iAxis));
+        }
+        Standard_Integer iMid = (fLow + fHigh)/2;
+        candidate_list.push_back(iMid);
+
+        sort(low_list.begin(), low_list.end());
+        sort(high_list.begin(), high_list.end());
+
+        vector<Standard_Real> low_sum(low_list.size()+1, 0.0);        // Weight of first i lower bounds
+        vector<Standard_Real> high_sum(high_list.size()+1, 0.0);      // Weight of last i upper bounds
+        for (unsigned int i = 0; i < low_list.size(); i++)
+        {
+            low_sum[i+1] = low_sum[i] + low_list[i].second;
+        }
+        for (unsigned int i = high_list.size(); i > 0; i--)
+        {
+            high_sum[i-1] = high_sum[i] + high_list[i-1].second;
+        }
+
+        for (unsigned int i = 0; i < candidate_list.size(); i++)
+        {
+            Standard_Real fCandidate = candidate_list[i];
+            McCadMathTool::Integer(fCandidate);
+            if (fCandidate <= fLow || fCandidate >= fHigh)
+            {
+                continue;
+            }
+
+            /// Boxes start below the plane are on the lower side,
+            /// boxes end above the plane are on the upper side.
+            unsigned int iLow = lower_bound(low_list.begin(), low_list.end(),
+                                            make_pair(fCandidate, -RealLast())) - low_list.begin();
+            unsigned int iHigh = upper_bound(high_list.begin(), high_list.end(),
+                                             make_pair(fCandidate, RealLast())) - high_list.begin();
+            Standard_Real fCost = max(low_sum[iLow], high_sum[iHigh]);
+            Standard_Real fDist = fabs(fCandidate - (fLow + fHigh)/2)/fLength;
+
+            if (fCost < fBestCost || (bFound && fCost == fBestCost && fDist < fBestDist))
+            {
+                bFound = Standard_True;
+                fBestCost = fCost;
+                fBestDist = fDist;
+                theAxis = (SplitAxis)iAxis;
+                fPos = fCandidate;
+            }
+        }
+    }
+
+    return bFound;
+}
@@ -0,0 +1,70 @@
+#ifndef MCCADVOIDKDTREE_HXX
+#define MCCADVOIDKDTREE_HXX
+
+#include <vector>
+#include <Standard.hxx>
+#include <Bnd_Box.hxx>
+#include <gp_Pnt.hxx>
+
+#include "McCadVoidCell.hxx"
+
+using namespace std;
+
+class McCadGeomData;
+
+/** Adaptive subdivision of the void space. The boundary box of the model is
+    split recursively with axis aligned planes, the planes are chosen from the
+    boundaries of the convex solids in the box so that the solids are separated
+    with the least straddling. A box becomes a void cell when the estimated
+    expression length of the solids in it is within MaxCellExpressionLength,
+    so the empty space keeps large boxes and the dense space is refined. */
+class McCadVoidKdTree
+{
+public:
+
+    void* operator new(size_t,void* anAddress)
+    {
+      return anAddress;
+    }
+    void* operator new(size_t size)
+    {
+      return Standard::Allocate(size);
+    }
+    void  operator delete(void *anAddress)
+    {
+      if (anAddress) Standard::Free((Standard_Address&)anAddress);
+    }
+
+    McCadVoidKdTree(McCadGeomData * pData);
+    ~McCadVoidKdTree();
+
+public:
+
+    /**< Split the box and give the boxes of void cells */
+    void Build(const gp_Pnt & min_pnt, const gp_Pnt & max_pnt,
+               vector<gp_Pnt> & leaf_min_list, vector<gp_Pnt> & leaf_max_list);
+
+    /**< Choose the splitting plane separating the weighted boxes, false if no plane separates them */
+    static Standard_Boolean ChooseSplitPlane(const vector<Bnd_Box> & box_list,
+                                             const vector<Standard_Real> & weight_list,
+                                             const gp_Pnt & min_pnt, const gp_Pnt & max_pnt,
+                                             SplitAxis & theAxis, Standard_Real & fPos);
+    /**< Estimated expression length of the collision with the solid */
+    static Standard_Real SolidWeight(Standard_Integer iFaceNum);
+
+private:
+
+    McCadGeomData * m_pData;                /**< The geometry data */
+    vector<Bnd_Box> m_SolidBoxList;         /**< Boundary boxes of convex solids */
+    vector<Standard_Real> m_WeightList;     /**< Estimated expression length of convex solids */
+    Standard_Real m_fMaxWeight;             /**< The box is not split within this length */
+    unsigned int m_iMaxDepth;               /**< Max depth of the subdivision */
+
+private:
+
+    /**< Split the box recursively with the solids overlapping it */
+    void Split(const gp_Pnt & min_pnt, const gp_Pnt & max_pnt, const vector<Standard_Integer> & solid_list,
+               unsigned int iDepth, vector<gp_Pnt> & leaf_min_list, vector<gp_Pnt> & leaf_max_list);
+};
+
+#endif // MCCADVOIDKDTREE_HXX
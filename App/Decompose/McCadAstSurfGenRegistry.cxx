@@ -0,0 +1,331 @@
+#include "McCadAstSurfGenRegistry.hxx"
+
+#include <Standard_Version.hxx>
+
+#include "McCadDcompSolid.hxx"
+#include "McCadBndSurface.hxx"
+#include "McCadEdge.hxx"
+#include "McCadAstSurfPlane.hxx"
+#include "McCadSplitCylinders.hxx"
+#include "McCadSplitCylnPln.hxx"
+#include "McCadSplitConePln.hxx"
+#include "McCadSplitConeCyln.hxx"
+#include "McCadSplitConeCone.hxx"
+#include "McCadSplitSphereCurveSurf.hxx"
+
+#include "../Tools/McCadConvertConfig.hxx"
+
+vector<McCadAstSurfGenRegistry::GenEntry> McCadAstSurfGenRegistry::m_GenList;
+Standard_Boolean McCadAstSurfGenRegistry::m_bInit = Standard_False;
+
+static McCadAstSurfGenerator * CrtSplitCylinders(){ return new McCadSplitCylinders(); }
+static McCadAstSurfGenerator * CrtSplitCylnPln(){ return new McCadSplitCylnPln(); }
+static McCadAstSurfGenerator * CrtSplitConePln(){ return new McCadSplitConePln(); }
+static McCadAstSurfGenerator * CrtSplitConeCyln(){ return new McCadSplitConeCyln(); }
+static McCadAstSurfGenerator * CrtSplitConeCone(){ return new McCadSplitConeCone(); }
+static McCadAstSurfGenerator * CrtSplitSphereCurveSurf(){ return new McCadSplitSphereCurveSurf(); }
+
+McCadAstSurfGenRegistry::McCadAstSurfGenRegistry()
+{
+}
+
+
+
+/** ***************************************************************************
+* @brief  Register the generators of McCad. The cylinder generators are enabled
+*         as before, the cone and sphere generators can be enabled by user.
+* @param
+* @return void
+*
+* @date 19/10/2026
+* @author  agent
+******************************************************************************/
+void McCadAstSurfGenRegistry::Init()
+{
+    if (m_bInit)
+    {
+        return;
+    }
+    m_bInit = Standard_True;
+
+    Register("CylnCyln",  CrtSplitCylinders,       Standard_True);
+    Register("CylnPln",   CrtSplitCylnPln,         Standard_True);
+    Register("ConePln",   CrtSplitConePln,         Standard_False);
+    Register("ConeCyln",  CrtSplitConeCyln,        Standard_False);
+    Register("ConeCone",  CrtSplitConeCone,        Standard_False);
+    Register("SphereCurv",CrtSplitSphereCurveSurf, Standard_False);
+}
+
+
+
+/** ***************************************************************************
+* @brief  Register a generator. If a generator with same name is registered,
+*         replace it.
+* @param  TCollection_AsciiString theName    ( Name of generator )
+*         McCadAstSurfGenCreator theCreator  ( Function creating generator )
+*         Standard_Boolean bEnabled
+* @return void
+*
+* @date 19/10/2026
+* @author  agent
+******************************************************************************/
+void McCadAstSurfGenRegistry::Register(const TCollection_AsciiString &theName,
+                                       McCadAstSurfGenCreator theCreator,
+                                       Standard_Boolean bEnabled)
+{
+    Init();
+
+    for(unsigned int i = 0; i < m_GenList.size(); i++)
+    {
+        if(m_GenList.at(i).strName.IsEqual(theName))
+        {
+            m_GenList.at(i).pCreator = theCreator;
+            m_GenList.at(i).bEnabled = bEnabled;
+            return;
+        }
+    }
+
+    GenEntry entry;
+    entry.strName  = theName;
+    entry.pCreator = theCreator;
+    entry.bEnabled = bEnabled;
+    m_GenList.push_back(entry);
+}
+
+
+
+/** ***************************************************************************
+* @brief  Enable or disable the generator
+* @param  TCollection_AsciiString theName    ( Name of generator )
+*         Standard_Boolean bEnabled
+* @return Standard_Boolean ( The generator is registered or not )
+*
+* @date 19/10/2026
+* @author  agent
+******************************************************************************/
+Standard_Boolean McCadAstSurfGenRegistry::SetEnabled(const TCollection_AsciiString &theName,
+                                                     Standard_Boolean bEnabled)
+{
+    Init();
+
+    for(unsigned int i = 0; i < m_GenList.size(); i++)
+    {
+        if(m_GenList.at(i).strName.IsEqual(theName))
+        {
+            m_GenList.at(i).bEnabled = bEnabled;
+            return Standard_True;
+        }
+    }
+    return Standard_False;
+}
+
+
+
+/** ***************************************************************************
+* @brief  Enable all the registered generators
+* @param
+* @return void
+*
+* @date 19/10/2026
+* @author  agent
+******************************************************************************/
+void McCadAstSurfGenRegistry::EnableAll()
+{
+    Init();
+
+    for(unsigned int i = 0; i < m_GenList.size(); i++)
+    {
+        m_GenList.at(i).bEnabled = Standard_True;
+    }
+}
+
+
+
+/** ***************************************************************************
+* @brief  Enable the generators named in the configuration, the names are
+*         separated by ",". The generators not named are disabled, the
+*         unknown names are reported.
+* @param
+* @return void
+*
+* @date 19/10/2026
+* @author  agent
+******************************************************************************/
+void McCadAstSurfGenRegistry::LoadConfig()
+{
+    Init();
+
+    TCollection_AsciiString strGens = McCadConvertConfig::GetAstSurfGenerators();
+    for(unsigned int i = 0; i < m_GenList.size(); i++)
+    {
+        m_GenList.at(i).bEnabled = Standard_False;
+    }
+
+    for(Standard_Integer i = 1; !strGens.Token(",",i).IsEmpty(); i++)
+    {
+        TCollection_AsciiString strName = strGens.Token(",",i);
+        strName.LeftAdjust();
+        strName.RightAdjust();
+        if(!SetEnabled(strName,Standard_True))
+        {
+            cout<<"#Unknown assisted surface generator "<<strName.ToCString()<<endl;
+        }
+    }
+}
+
+
+
+/** ***************************************************************************
+* @brief  Run the enabled and applicable generators at the same time on the
+*         solid. Each generator writes its own assisted surface list and keeps
+*         the convexity and splitting edges it finds, the solid is only read
+*         while they run. Afterwards the generators commit their edges and
+*         the lists are merged in the order of registration, so the result
+*         does not depend on which generator finished first.
+* @param  McCadDcompSolid *& pSolid               ( Input solid )
+*         vector<McCadAstSurface*> & AstFaceList  ( Output assisted surfaces )
+* @return void
+*
+* @date 19/10/2026
+* @author  agent
+******************************************************************************/
+void McCadAstSurfGenRegistry::GenAssistSurfaces(McCadDcompSolid *& pSolid,
+                                                vector<McCadAstSurface*> & AstFaceList)
+{
+    Init();
+
+    vector<McCadAstSurfGenerator*> gen_list;
+    for(unsigned int i = 0; i < m_GenList.size(); i++)
+    {
+        if(!m_GenList.at(i).bEnabled)
+        {
+            continue;
+        }
+
+        McCadAstSurfGenerator *pGen = m_GenList.at(i).pCreator();
+        if(pGen->IsApplicable(pSolid))
+        {
+            gen_list.push_back(pGen);
+        }
+        else
+        {
+            delete pGen;
+            pGen = NULL;
+        }
+    }
+
+    if(gen_list.empty())
+    {
+        return;
+    }
+
+    /// The edges calculate their points when they are used at the first
+    /// time, calculate them here so the edges are not written in the loop.
+    PrepareEdges(pSolid->m_FaceList);
+    PrepareEdges(pSolid->m_SphereList);
+
+    /// The geometric algorithms of OCC before 7.2 are not safe to run at the
+    /// same time, the generators run in turn.
+#if OCC_VERSION_HEX >= 0x070200
+    const bool bParallel = true;
+#else
+    const bool bParallel = false;
+#endif
+
+    int iNbGen = gen_list.size();
+    vector< vector<McCadAstSurface*> > surf_lists(iNbGen);
+
+    #pragma omp parallel for schedule(dynamic,1) if(bParallel && iNbGen > 1)
+    for(int i = 0; i < iNbGen; i++)
+    {
+        try
+        {
+            gen_list.at(i)->GenSplitSurfaces(pSolid,surf_lists.at(i));
+        }
+        catch(...)
+        {
+            #pragma omp critical(McCadAstSurfGenRegistry_Print)
+            {
+                cout<<"#Assisted surface generator "<<i<<" failed"<<endl;
+            }
+        }
+    }
+
+    for(int i = 0; i < iNbGen; i++)
+    {
+        gen_list.at(i)->Commit();
+        AstFaceList.insert(AstFaceList.end(),surf_lists.at(i).begin(),surf_lists.at(i).end());
+
+        delete gen_list.at(i);
+        gen_list.at(i) = NULL;
+    }
+
+    if(AstFaceList.size() >= 2)
+    {
+        MergeSurfaces(AstFaceList);
+    }
+}
+
+
+
+/** ***************************************************************************
+* @brief  Remove the repeated assisted surfaces created by different generators,
+*         only the surfaces of same type are compared.
+* @param  vector<McCadAstSurface*> & theAstFaceList
+* @return void
+*
+* @date 19/10/2026
+* @author  agent
+******************************************************************************/
+void McCadAstSurfGenRegistry::MergeSurfaces(vector<McCadAstSurface*> & theAstFaceList)
+{
+    for(unsigned int i = 0; i < theAstFaceList.size(); i++ )
+    {
+        McCadAstSurface *pFirFace = theAstFaceList.at(i);
+        for(unsigned int j = i+1; j < theAstFaceList.size(); j++ )
+        {
+            McCadAstSurface *pSecFace = theAstFaceList.at(j);
+            if(pFirFace->GetSurfType() != pSecFace->GetSurfType())
+            {
+                continue;
+            }
+
+            if(pFirFace->IsSameSurface(pSecFace))
+            {
+                theAstFaceList.erase(theAstFaceList.begin()+j);
+                if(pFirFace->GetSurfType() == Plane)
+                {
+                    ((McCadAstSurfPlane*)pFirFace)->SetCombined(Standard_True);
+                }
+
+                delete pSecFace;
+                pSecFace = NULL;
+
+                j--;
+            }
+        }
+    }
+}
+
+
+
+/** ***************************************************************************
+* @brief  Calculate the points of the edges of boundary surfaces before the
+*         generators run, the generators only read the edges.
+* @param  vector<McCadBndSurface*> & theFaceList
+* @return void
+*
+* @date 19/10/2026
+* @author  agent
+******************************************************************************/
+void McCadAstSurfGenRegistry::PrepareEdges(vector<McCadBndSurface*> & theFaceList)
+{
+    for(unsigned int i = 0; i < theFaceList.size(); i++)
+    {
+        vector<McCadEdge*> edge_list = theFaceList.at(i)->GetEdgeList();
+        for(unsigned int j = 0; j < edge_list.size(); j++)
+        {
+            edge_list.at(j)->StartPoint();  // The points are calculated and kept
+        }
+    }
+}
@@ -0,0 +1,80 @@
+#ifndef MCCADASTSURFGENREGISTRY_HXX
+#define MCCADASTSURFGENREGISTRY_HXX
+
+#include <vector>
+#include <TCollection_AsciiString.hxx>
+
+#include "McCadAstSurfGenerator.hxx"
+#include "McCadAstSurface.hxx"
+
+class McCadDcompSolid;
+class McCadBndSurface;
+
+using namespace std;
+
+/**< The function creating an assisted splitting surface generator */
+typedef McCadAstSurfGenerator * (*McCadAstSurfGenCreator)();
+
+/** The registry of assisted splitting surface generators. The enabled
+    generators run in the order of registration on the boundary surfaces of
+    a solid, each one fills its own list, and the lists are merged with the
+    repeated surfaces removed. The generators run at the same time, each one
+    keeps what it finds and commits it to the solid after all finished. */
+class McCadAstSurfGenRegistry
+{
+public:
+
+    void* operator new(size_t,void* anAddress)
+    {
+        return anAddress;
+    }
+    void* operator new(size_t size)
+    {
+        return Standard::Allocate(size);
+    }
+    void  operator delete(void *anAddress)
+    {
+        if (anAddress) Standard::Free((Standard_Address&)anAddress);
+    }
+
+    McCadAstSurfGenRegistry();
+
+private:
+
+    struct GenEntry
+    {
+        TCollection_AsciiString strName;    /**< The name of generator */
+        McCadAstSurfGenCreator pCreator;    /**< The function creating the generator */
+        Standard_Boolean bEnabled;          /**< The generator is used or not */
+    };
+
+    static vector<GenEntry> m_GenList;      /**< The registered generators */
+    static Standard_Boolean m_bInit;        /**< The default generators are registered or not */
+
+    /**< Register the generators of McCad, only the cylinder ones are enabled */
+    static void Init();
+    /**< Merge the repeated assisted surfaces */
+    static void MergeSurfaces(vector<McCadAstSurface*> & theAstFaceList);
+    /**< Calculate the points of edges, the generators only read them */
+    static void PrepareEdges(vector<McCadBndSurface*> & theFaceList);
+
+public:
+
+    /**< Register a generator, the existed one with same name is replaced */
+    static void Register(const TCollection_AsciiString &theName,
+                         McCadAstSurfGenCreator theCreator,
+                         Standard_Boolean bEnabled = Standard_True);
+    /**< Enable or disable the generator, return false if it is not registered */
+    static Standard_Boolean SetEnabled(const TCollection_AsciiString &theName,
+                                       Standard_Boolean bEnabled);
+    /**< Enable all the registered generators */
+    static void EnableAll();
+    /**< Enable the generators named in the configuration, disable the others */
+    static void LoadConfig();
+
+    /**< Run the enabled generators and add the assisted surfaces into the list */
+    static void GenAssistSurfaces(McCadDcompSolid *& pSolid,
+                                  vector<McCadAstSurface*> & AstFaceList);
+};
+
+#endif // MCCADASTSURFGENREGISTRY_HXX
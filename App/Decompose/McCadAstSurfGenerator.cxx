@@ -0,0 +1,187 @@
+#include "McCadAstSurfGenerator.hxx"
+
+#include "McCadBndSurfCylinder.hxx"
+#include "McCadBndSurfCone.hxx"
+
+McCadAstSurfGenerator::McCadAstSurfGenerator()
+{
+}
+
+McCadAstSurfGenerator::~McCadAstSurfGenerator()
+{
+    m_ConvexityList.clear();
+    m_CylnCylnEdgeList.clear();
+    m_CylnPlnEdgeList.clear();
+    m_ConePlnEdgeList.clear();
+}
+
+
+
+/** ***************************************************************************
+* @brief  Write the recorded convexity of edges and the splitting edges to the
+*         edges and boundary surfaces of the solid, in the order they were
+*         recorded. It is called after all the generators of the solid
+*         finished, in the order of registration.
+* @param
+* @return void
+*
+* @date 19/10/2026
+* @author  agent
+******************************************************************************/
+void McCadAstSurfGenerator::Commit()
+{
+    for(unsigned int i = 0; i < m_ConvexityList.size(); i++)
+    {
+        m_ConvexityList.at(i).pEdge->SetConvexity(m_ConvexityList.at(i).eConvexity);
+    }
+
+    for(unsigned int i = 0; i < m_CylnCylnEdgeList.size(); i++)
+    {
+        m_CylnCylnEdgeList.at(i).pSurf->AddCylnCylnSplitEdge(m_CylnCylnEdgeList.at(i).pEdge);
+    }
+
+    for(unsigned int i = 0; i < m_CylnPlnEdgeList.size(); i++)
+    {
+        m_CylnPlnEdgeList.at(i).pSurf->AddCylnPlnSplitEdge(m_CylnPlnEdgeList.at(i).pEdge);
+    }
+
+    for(unsigned int i = 0; i < m_ConePlnEdgeList.size(); i++)
+    {
+        m_ConePlnEdgeList.at(i).pSurf->AddConePlnSplitEdge(m_ConePlnEdgeList.at(i).pEdge);
+    }
+
+    m_ConvexityList.clear();
+    m_CylnCylnEdgeList.clear();
+    m_CylnPlnEdgeList.clear();
+    m_ConePlnEdgeList.clear();
+}
+
+
+
+/** ***************************************************************************
+* @brief  Record the convexity of the edge, it is set by Commit
+* @param  McCadEdge *pEdge
+*         CONVEXITY eConvexity
+* @return void
+*
+* @date 19/10/2026
+* @author  agent
+******************************************************************************/
+void McCadAstSurfGenerator::MarkConvexity(McCadEdge *pEdge, CONVEXITY eConvexity)
+{
+    EdgeConvexity item;
+    item.pEdge = pEdge;
+    item.eConvexity = eConvexity;
+    m_ConvexityList.push_back(item);
+}
+
+
+
+/** ***************************************************************************
+* @brief  Record the edge of cylinder for the splitting surface between two
+*         cylinders, it is added to the cylinder by Commit
+* @param  McCadBndSurfCylinder *pSurf
+*         McCadEdge *pEdge
+* @return void
+*
+* @date 19/10/2026
+* @author  agent
+******************************************************************************/
+void McCadAstSurfGenerator::RecordCylnCylnSplitEdge(McCadBndSurfCylinder *pSurf,
+                                                    McCadEdge *pEdge)
+{
+    SplitEdge<McCadBndSurfCylinder> item;
+    item.pSurf = pSurf;
+    item.pEdge = pEdge;
+    m_CylnCylnEdgeList.push_back(item);
+}
+
+
+
+/** ***************************************************************************
+* @brief  Record the edge of cylinder for the splitting surface between
+*         cylinder and plane, it is added to the cylinder by Commit
+* @param  McCadBndSurfCylinder *pSurf
+*         McCadEdge *pEdge
+* @return void
+*
+* @date 19/10/2026
+* @author  agent
+******************************************************************************/
+void McCadAstSurfGenerator::RecordCylnPlnSplitEdge(McCadBndSurfCylinder *pSurf,
+                                                   McCadEdge *pEdge)
+{
+    SplitEdge<McCadBndSurfCylinder> item;
+    item.pSurf = pSurf;
+    item.pEdge = pEdge;
+    m_CylnPlnEdgeList.push_back(item);
+}
+
+
+
+/** ***************************************************************************
+* @brief  Record the edge of cone for the splitting surface between cone and
+*         plane, it is added to the cone by Commit
+* @param  McCadBndSurfCone *pSurf
+*         McCadEdge *pEdge
+* @return void
+*
+* @date 19/10/2026
+* @author  agent
+******************************************************************************/
+void McCadAstSurfGenerator::RecordConePlnSplitEdge(McCadBndSurfCone *pSurf,
+                                                   McCadEdge *pEdge)
+{
+    SplitEdge<McCadBndSurfCone> item;
+    item.pSurf = pSurf;
+    item.pEdge = pEdge;
+    m_ConePlnEdgeList.push_back(item);
+}
+
+
+
+/** ***************************************************************************
+* @brief  Get the edges of cylinder recorded by this generator for the
+*         splitting surfaces between cylinder and plane
+* @param  McCadBndSurfCylinder *pSurf
+* @return vector<McCadEdge*>
+*
+* @date 19/10/2026
+* @author  agent
+******************************************************************************/
+vector<McCadEdge*> McCadAstSurfGenerator::GetCylnPlnSplitEdges(McCadBndSurfCylinder *pSurf) const
+{
+    vector<McCadEdge*> edge_list;
+    for(unsigned int i = 0; i < m_CylnPlnEdgeList.size(); i++)
+    {
+        if(m_CylnPlnEdgeList.at(i).pSurf == pSurf)
+        {
+            edge_list.push_back(m_CylnPlnEdgeList.at(i).pEdge);
+        }
+    }
+    return edge_list;
+}
+
+
+
+/** ***************************************************************************
+* @brief  Get the edges of cone recorded by this generator for the splitting
+*         surfaces between cone and plane
+* @param  McCadBndSurfCone *pSurf
+* @return vector<McCadEdge*>
+*
+* @date 19/10/2026
+* @author  agent
+******************************************************************************/
+vector<McCadEdge*> McCadAstSurfGenerator::GetConePlnSplitEdges(McCadBndSurfCone *pSurf) const
+{
+    vector<McCadEdge*> edge_list;
+    for(unsigned int i = 0; i < m_ConePlnEdgeList.size(); i++)
+    {
+        if(m_ConePlnEdgeList.at(i).pSurf == pSurf)
+        {
+            edge_list.push_back(m_ConePlnEdgeList.at(i).pEdge);
+        }
+    }
+    return edge_list;
+}
@@ -0,0 +1,86 @@
+#ifndef MCCADASTSURFGENERATOR_HXX
+#define MCCADASTSURFGENERATOR_HXX
+
+#include <vector>
+#include <Standard.hxx>
+
+#include "McCadAstSurface.hxx"
+#include "McCadEdge.hxx"
+
+class McCadDcompSolid;
+class McCadBndSurfCylinder;
+class McCadBndSurfCone;
+
+using namespace std;
+
+/** The interface of assisted splitting surface generators. A generator reads
+    the boundary surface lists of the solid and puts the created assisted
+    surfaces into the given list. The convexity of edges and the splitting
+    edges found on the boundary surfaces are kept in the generator, they are
+    written to the solid by Commit, so the generators of one solid can run
+    at the same time. */
+class McCadAstSurfGenerator
+{
+public:
+
+    McCadAstSurfGenerator();
+    virtual ~McCadAstSurfGenerator();
+
+    void* operator new(size_t,void* anAddress)
+    {
+        return anAddress;
+    }
+    void* operator new(size_t size)
+    {
+        return Standard::Allocate(size);
+    }
+    void  operator delete(void *anAddress)
+    {
+        if (anAddress) Standard::Free((Standard_Address&)anAddress);
+    }
+
+    /**< The solid has the boundary surfaces this generator works on or not */
+    virtual Standard_Boolean IsApplicable(McCadDcompSolid *& pSolid) = 0;
+    /**< Generate the assisted splitting surfaces and add them into the list */
+    virtual void GenSplitSurfaces(McCadDcompSolid *& pSolid,
+                                  vector<McCadAstSurface*> & AstFaceList) = 0;
+
+    /**< Write the recorded convexity and splitting edges to the solid */
+    void Commit();
+
+protected:
+
+    /**< Record the convexity of the edge */
+    void MarkConvexity(McCadEdge *pEdge, CONVEXITY eConvexity);
+    /**< Record the edge for the splitting surface between two cylinders */
+    void RecordCylnCylnSplitEdge(McCadBndSurfCylinder *pSurf, McCadEdge *pEdge);
+    /**< Record the edge for the splitting surface between cylinder and plane */
+    void RecordCylnPlnSplitEdge(McCadBndSurfCylinder *pSurf, McCadEdge *pEdge);
+    /**< Record the edge for the splitting surface between cone and plane */
+    void RecordConePlnSplitEdge(McCadBndSurfCone *pSurf, McCadEdge *pEdge);
+    /**< Get the recorded edges of cylinder for the splitting surfaces with planes */
+    vector<McCadEdge*> GetCylnPlnSplitEdges(McCadBndSurfCylinder *pSurf) const;
+    /**< Get the recorded edges of cone for the splitting surfaces with planes */
+    vector<McCadEdge*> GetConePlnSplitEdges(McCadBndSurfCone *pSurf) const;
+
+private:
+
+    struct EdgeConvexity
+    {
+        McCadEdge *pEdge;           /**< The edge */
+        CONVEXITY eConvexity;       /**< The convexity to be set */
+    };
+
+    template<class T> struct SplitEdge
+    {
+        T *pSurf;                   /**< The boundary surface */
+        McCadEdge *pEdge;           /**< The splitting edge on the surface */
+    };
+
+    vector<EdgeConvexity> m_ConvexityList;                              /**< The recorded convexity of edges */
+    vector< SplitEdge<McCadBndSurfCylinder> > m_CylnCylnEdgeList;      /**< The recorded cylinder-cylinder splitting edges */
+    vector< SplitEdge<McCadBndSurfCylinder> > m_CylnPlnEdgeList;       /**< The recorded cylinder-plane splitting edges */
+    vector< SplitEdge<McCadBndSurfCone> > m_ConePlnEdgeList;           /**< The recorded cone-plane splitting edges */
+};
+
+#endif // MCCADASTSURFGENERATOR_HXX
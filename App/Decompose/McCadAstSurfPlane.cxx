@@ -1,6 +1,5 @@
 #include "McCadAstSurfPlane.hxx"
 
-#include <McCadGTOOL.hxx>
 #include <Handle_TColgp_HSequenceOfPnt.hxx>
 #include <TColgp_HSequenceOfPnt.hxx>
 
@@ -19,7 +18,7 @@
 #include <STEPControl_Writer.hxx>
 #include <BRepBuilderAPI_MakeEdge.hxx>
 
-#include "../McCadTool/McCadEvaluator.hxx"
+#include "../Tools/McCadEvaluator.hxx"
 
 McCadAstSurfPlane::McCadAstSurfPlane(const TopoDS_Face &theFace):McCadAstSurface(theFace)
 {
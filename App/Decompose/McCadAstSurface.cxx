@@ -1,6 +1,5 @@
 #include "McCadAstSurface.hxx"
 
-#include <McCadGTOOL.hxx>
 
 #include <Handle_TColgp_HSequenceOfPnt.hxx>
 
@@ -25,7 +24,7 @@
 #include <gp_Pln.hxx>
 #include <gp_Ax3.hxx>
 
-#include "../McCadTool/McCadMathTool.hxx"
+#include "../Tools/McCadMathTool.hxx"
 
 McCadAstSurface::McCadAstSurface(const TopoDS_Face &theFace):McCadSurface(theFace)
 {
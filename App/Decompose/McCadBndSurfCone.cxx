@@ -12,16 +12,25 @@
 #include <Extrema_ExtPS.hxx>
 
 #include <TColgp_HSequenceOfPnt.hxx>
+#include <Precision.hxx>
 
-#include "../McCadTool/McCadEvaluator.hxx"
-#include "../McCadTool/McCadGeomTool.hxx"
+#include "McCadQuadricIntersect.hxx"
+
+#include "../Tools/McCadEvaluator.hxx"
+#include "../Tools/McCadGeomTool.hxx"
+
+#define CONE_ON_SURF_TOL 1.0e-1     /**< The vertexes within it are treated as on the cone */
 
 McCadBndSurfCone::McCadBndSurfCone()
 {
+    m_VMin = 0.0;   // The V range is empty until the extended cone is generated
+    m_VMax = 0.0;
 }
 
 McCadBndSurfCone::McCadBndSurfCone(const TopoDS_Face &theFace):McCadBndSurface(theFace)
 {
+    m_VMin = 0.0;   // The V range is empty until the extended cone is generated
+    m_VMax = 0.0;
 }
 
 McCadBndSurfCone::~McCadBndSurfCone()
@@ -58,7 +67,7 @@ Standard_Boolean McCadBndSurfCone::TriangleCollision(McCadTriangle *& triangle,
     {
         // if the point is on the surface, do not calculate the position between them.
         gp_Pnt point = pnt_list->Value(i);
-        if (IsPntOnSurf(point,1.0e-1))
+        if (IsPntOnSurf(point,CONE_ON_SURF_TOL))
         {
             continue;
         }
@@ -111,7 +120,12 @@ Standard_Boolean McCadBndSurfCone::TriangleCollision(McCadTriangle *& triangle,
     /// the edges of triangle may collied with surface
     if (iPosPnt > 0 && iNegPnt == 0)
     {
-        eSide = POSITIVE;
+        bCollision = FurtherCollisionDetect(triangle,iPosPnt);
+        if (!bCollision)
+        {
+            eSide = POSITIVE;
+        }
+        return bCollision;
     }
     else if (iNegPnt > 0 && iPosPnt == 0)   // The triangle on negative side of face
     {
@@ -129,6 +143,63 @@ Standard_Boolean McCadBndSurfCone::TriangleCollision(McCadTriangle *& triangle,
 
 
 
+/** ***************************************************************************
+* @brief  When no vertex of triangle is inside the cone, the edges of triangle
+*         may still cross the cone. The edges are intersected with the cone
+*         analytically within the V range of the extended cone face. If an
+*         edge enters and leaves the cone over a length longer than the
+*         tolerance of points on surface, the triangle is collied with cone. If all three vertexes are outside and no edge
+*         crosses the cone, check the cone goes through the interior of
+*         triangle.
+* @param  McCadTriangle *& triangle
+*         Standard_Integer posPnt   How many vertexes are outside the cone
+* @return Standard_Boolean
+*
+* @date 19/10/2026
+* @author  agent
+******************************************************************************/
+Standard_Boolean McCadBndSurfCone::FurtherCollisionDetect(McCadTriangle *& triangle,
+                                                          Standard_Integer posPnt)
+{
+    Handle_TColgp_HSequenceOfPnt pnt_list = triangle->GetVexList();
+    Standard_Integer iNumVertex = pnt_list->Length();
+    gp_Cone gCone = m_AdpSurface.Cone();
+
+    Standard_Integer iNumVer = 0;
+    for (Standard_Integer i = 1; i <= iNumVertex; i++)
+    {
+        gp_Pnt pntStart = pnt_list->Value(i);
+        gp_Pnt pntEnd = pnt_list->Value(i % iNumVertex + 1);
+
+        Standard_Real param[2];
+        Standard_Integer iNbPnt = McCadQuadricIntersect::SegmentCone(pntStart, pntEnd, gCone,
+                                                                     m_VMin, m_VMax,
+                                                                     Precision::Confusion(), param);
+        iNumVer += iNbPnt;
+
+        // The vertexes within CONE_ON_SURF_TOL are treated as on the cone, so
+        // the part of edge inside the cone must be longer than it.
+        if (iNbPnt == 2 && (param[1]-param[0])*pntStart.Distance(pntEnd) > CONE_ON_SURF_TOL)
+        {
+            return Standard_True;
+        }
+    }
+
+    if (posPnt == 3 && iNumVertex == 3 && iNumVer == 0)
+    {
+        return McCadQuadricIntersect::ConeInTriangle(pnt_list->Value(1),
+                                                     pnt_list->Value(2),
+                                                     pnt_list->Value(3),
+                                                     gCone, m_VMin, m_VMax,
+                                                     Precision::Confusion());
+    }
+
+    return Standard_False;
+}
+
+
+
+
 /** ***************************************************************************
 * @brief  Generate a extended cone based on the analyzed parameters of cone
 * @param  Standard_Real length
@@ -177,6 +248,8 @@ void McCadBndSurfCone::GenExtCone(Standard_Real length)
     }
 
     m_coneSurf = BRepBuilderAPI_MakeFace(surface,UMin,UMax,VMin,VMax,1.e-7);
+    m_VMin = VMin;
+    m_VMax = VMax;
 
     BRepBndLib::Add(m_coneSurf, m_ConeBndBox);
     m_ConeBndBox.SetGap(0.0);
@@ -50,6 +50,9 @@ public:
 
 private:
 
+    /**< Detect the collision of triangle edges and cone analytically */
+    Standard_Boolean FurtherCollisionDetect(McCadTriangle *& triangle, Standard_Integer posPnt);
+
     gp_Dir m_Dir;                   /**< Direction of axis  */
     gp_Ax3 m_Axis;                  /**< Coordinate of cone */
     gp_Pnt m_Apex;                  /**< Top point of cone  */
@@ -57,6 +60,8 @@ private:
     Standard_Real m_Radian;         /**< The Radian of cone */
 
     Standard_Real m_ConeLength;     /**< The length of new created cone */
+    Standard_Real m_VMin;           /**< V range of the new created cone */
+    Standard_Real m_VMax;
 
     Standard_Boolean m_bHasAstSplitSurfaces;/**< If the cylinder has assisted splitting surface */
 
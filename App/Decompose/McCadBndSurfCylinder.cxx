@@ -32,27 +32,28 @@
 #include <TopExp_Explorer.hxx>
 #include <TopoDS.hxx>
 
-#include <IntTools_EdgeFace.hxx>
-#include <IntTools_SequenceOfCommonPrts.hxx>
-#include <IntTools_CommonPrt.hxx>
+#include <Precision.hxx>
 
-#include <McCadMessenger_Singleton.hxx>
 #include "McCadEdge.hxx"
+#include "McCadQuadricIntersect.hxx"
 #include <math.h>
-#include <McCadGTOOL.hxx>
 
-#include "../McCadTool/McCadMathTool.hxx"
-#include "../McCadTool/McCadGeomTool.hxx"
-#include "../McCadTool/McCadEvaluator.hxx"
+#include "../Tools/McCadMathTool.hxx"
+#include "../Tools/McCadGeomTool.hxx"
+#include "../Tools/McCadEvaluator.hxx"
 
 McCadBndSurfCylinder::McCadBndSurfCylinder()
 {
+    m_VMin = 0.0;
+    m_VMax = 0.0;
 }
 
 McCadBndSurfCylinder::McCadBndSurfCylinder(const TopoDS_Face &theFace):McCadBndSurface(theFace)
 {
     m_SurfType = Cylinder;                          // Set the surface type
     m_bHasAstSplitSurfaces = Standard_False;        // Set the cylinder has not splitting surface
+    m_VMin = 0.0;                                   // The V range is empty until the extended
+    m_VMax = 0.0;                                   // cylinder is generated
 }
 
 McCadBndSurfCylinder::~McCadBndSurfCylinder()
@@ -170,7 +171,7 @@ Standard_Boolean McCadBndSurfCylinder::TriangleCollision(McCadTriangle *& triang
 * @return Standard_Boolean      The cylinder and triangle have collision or not
 *
 * @date 13/05/2015
-* @modify 05/04/2016
+* @modify 19/10/2026 analytic segment-cylinder intersection replaces IntTools
 * @author Lei Lu
 *********************************************************************************/
 Standard_Boolean McCadBndSurfCylinder::FurtherCollisionDetect(McCadTriangle *& triangle,
@@ -179,26 +180,22 @@ Standard_Boolean McCadBndSurfCylinder::FurtherCollisionDetect(McCadTriangle *& t
 {
     Standard_Boolean bCollision = Standard_False; // The triangle is collied with face or not
 
+    Handle_TColgp_HSequenceOfPnt pnt_list = triangle->GetVexList();
+    gp_Cylinder gCyln = m_AdpSurface.Cylinder();
+
     int iNumVer = 0;
     // How many intersected pointed do the triangle and cylinder have.
-    for (TopExp_Explorer ex(*triangle, TopAbs_EDGE); ex.More(); ex.Next())
+    // The edges are intersected with cylinder analytically in its local frame,
+    // only the points on the generated cylinder face are counted.
+    for (Standard_Integer i = 1; i <= pnt_list->Length(); i++)
     {
-        TopoDS_Edge edge = TopoDS::Edge(ex.Current());
-        IntTools_EdgeFace efInt;
+        gp_Pnt pntStart = pnt_list->Value(i);
+        gp_Pnt pntEnd = pnt_list->Value(i % pnt_list->Length() + 1);
 
-        efInt.SetEdge(edge);
-        efInt.SetFace(m_cylSurf);
-
-        efInt.SetRange(0.0,1.0);
-        efInt.Perform();
-
-        IntTools_SequenceOfCommonPrts cprts;
-        cprts = efInt.CommonParts();
-        if(cprts.Length()!=0)
-        {
-            iNumVer += cprts.Length();
-        }
-    }  
+        Standard_Real param[2];
+        iNumVer += McCadQuadricIntersect::SegmentCylinder(pntStart, pntEnd, gCyln, m_VMin, m_VMax,
+                                                          Precision::Confusion(), param);
+    }
 
     //Judge the triangle is collied with cylinder or not
     Standard_Integer iNumVertex = triangle->GetVexList()->Length();
@@ -227,8 +224,18 @@ Standard_Boolean McCadBndSurfCylinder::FurtherCollisionDetect(McCadTriangle *& t
 
             return bCollision;
         }
+        else if(iNumVertex == 3)
+        {
+            // No edge crosses the cylinder, but the cylinder may still go
+            // through the interior of triangle
+            bCollision = McCadQuadricIntersect::CylinderInTriangle(pnt_list->Value(1),
+                                                                   pnt_list->Value(2),
+                                                                   pnt_list->Value(3),
+                                                                   gCyln, m_VMin, m_VMax,
+                                                                   Precision::Confusion());
+        }
         else
-        {           
+        {
             bCollision = BooleanCollisionDetect(triangle,eSide);
         }
     }
@@ -327,9 +334,7 @@ Standard_Boolean McCadBndSurfCylinder::BooleanCollisionDetect(McCadTriangle *& t
     }
     catch(...)
     {
-        McCadMessenger_Singleton* msgr = McCadMessenger_Singleton::Instance();
-        msgr->Message("_#_McCadBndSurfCylinder.cxx :: Section computering of triangle and surface is fail!!!",
-                      McCadMessenger_WarningMsg);
+        cout<<"_#_McCadBndSurfCylinder.cxx :: Section computering of triangle and surface is fail!!!"<<endl;
 
         eSide = POSITIVE;
         bCollision = Standard_False;
@@ -450,6 +455,8 @@ void McCadBndSurfCylinder::GenExtCylinder(Standard_Real length)
     VMax = VMid + ext_length;
 
     m_cylSurf = BRepBuilderAPI_MakeFace(surface,UMin,UMax,VMin,VMax,1.e-7);
+    m_VMin = VMin;
+    m_VMax = VMax;
 
     gp_Cylinder gCyl = m_AdpSurface.Cylinder();
     m_radius = gCyl.Radius();                   // Get the radius of cylinder
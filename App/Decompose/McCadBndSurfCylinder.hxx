@@ -56,6 +56,8 @@ private:
     Standard_Real m_radius;         /**< The radius of cylinder */
     TopoDS_Face m_cylSurf;          /**< Generated a close and extended cylinder surface */
     Standard_Real m_CylnLength;     /**< The length of cylinder generated */
+    Standard_Real m_VMin;           /**< V range of the generated cylinder */
+    Standard_Real m_VMax;
 
     /**< Detect the collision between cylinder and triangle with intersection operations*/
     Standard_Boolean FurtherCollisionDetect(McCadTriangle *& triangle,
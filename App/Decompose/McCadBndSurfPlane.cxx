@@ -1,6 +1,5 @@
 #include "McCadBndSurfPlane.hxx"
 
-#include <McCadGTOOL.hxx>
 #include <Handle_TColgp_HSequenceOfPnt.hxx>
 
 #include <gp_Pln.hxx>
@@ -17,8 +16,8 @@
 
 #include <Extrema_ExtPS.hxx>
 
-#include "../McCadTool/McCadGeomTool.hxx"
-#include "../McCadTool/McCadEvaluator.hxx"
+#include "../Tools/McCadGeomTool.hxx"
+#include "../Tools/McCadEvaluator.hxx"
 
 McCadBndSurfPlane::McCadBndSurfPlane()
 {
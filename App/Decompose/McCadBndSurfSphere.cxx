@@ -11,8 +11,8 @@
 #include <ElSLib.hxx>
 #include <Extrema_ExtPS.hxx>
 
-#include "../McCadTool/McCadEvaluator.hxx"
-#include "../McCadTool/McCadGeomTool.hxx"
+#include "../Tools/McCadEvaluator.hxx"
+#include "../Tools/McCadGeomTool.hxx"
 
 McCadBndSurfSphere::McCadBndSurfSphere()
 {
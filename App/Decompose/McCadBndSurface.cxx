@@ -1,6 +1,5 @@
 #include "McCadBndSurface.hxx"
 
-#include <McCadMessenger_Singleton.hxx>
 #include <TopExp_Explorer.hxx>
 #include <TopAbs_ShapeEnum.hxx>
 #include <TopoDS_Wire.hxx>
@@ -35,7 +34,7 @@
 #include "McCadEdgeEllipse.hxx"
 #include "McCadEdgeSpline.hxx"
 
-#include "../McCadTool/McCadMathTool.hxx"
+#include "../Tools/McCadMathTool.hxx"
 #include <assert.h>
 
 McCadBndSurface::McCadBndSurface()
@@ -182,9 +181,7 @@ Standard_Boolean McCadBndSurface::GenTriangles(Standard_Real aDeflection)
     }
     catch(...)
     {
-        McCadMessenger_Singleton *msgr = McCadMessenger_Singleton::Instance();
-        msgr->Message("McCadBndSurface::GenTriangles :: Error: Face meshing has errors",
-                      McCadMessenger_DefaultMsg);
+        cout<<"McCadBndSurface::GenTriangles :: Error: Face meshing has errors"<<endl;
         return Standard_False;
     }
 
@@ -0,0 +1,477 @@
+#include "McCadDcompCheckpoint.hxx"
+
+#include <stdio.h>
+#include <fstream>
+#include <sstream>
+#include <string>
+
+#include <QDir>
+#include <QString>
+
+#include <BinTools.hxx>
+#include <BRep_Builder.hxx>
+#include <BRepBndLib.hxx>
+#include <BRepGProp.hxx>
+#include <Bnd_Box.hxx>
+#include <GProp_GProps.hxx>
+#include <Standard_Failure.hxx>
+#include <TopoDS.hxx>
+#include <TopoDS_Compound.hxx>
+#include <TopoDS_Iterator.hxx>
+#include <TopExp_Explorer.hxx>
+#include <TopTools_HSequenceOfShape.hxx>
+
+#include "McCadSurfRegistry.hxx"
+#include "../Tools/McCadConvertConfig.hxx"
+
+McCadDcompCheckpoint::McCadDcompCheckpoint(McCadDcompGeomData * pGeoData)
+{
+    m_pGeoData = pGeoData;
+    m_strDir = McCadConvertConfig::GetCheckpointDir();
+    m_iInputNum = 0;
+    m_iFinished = 0;
+    m_iChunkNum = 0;
+    m_iPending = 0;
+    m_iSplitMark = 0;
+
+    if(!m_strDir.IsEmpty() && !QDir().mkpath(QString::fromLatin1(m_strDir.ToCString())))
+    {
+        cout<<"#Cannot create the checkpoint directory "<<m_strDir.ToCString()<<endl;
+        m_strDir = "";
+    }
+}
+
+McCadDcompCheckpoint::~McCadDcompCheckpoint()
+{
+    m_pGeoData = NULL;
+}
+
+
+
+/** ***************************************************************************
+* @brief  Read the progress file and the chunks of last run. If resuming is
+*         not required or the checkpoints do not match the input solids, an
+*         empty progress file is written, so the old chunks are not used.
+*         The checkpoints match if the number and the hash of the input
+*         solids are the same.
+* @param  Handle_TopTools_HSequenceOfShape & solid_list  ( The input solids )
+*         vector<Standard_Integer> & count_list  ( Statistics of last run )
+* @return Standard_Integer  ( Number of finished solids )
+*
+* @date 19/10/2026
+* @author  agent
+******************************************************************************/
+Standard_Integer McCadDcompCheckpoint::Resume(const Handle_TopTools_HSequenceOfShape & solid_list,
+                                              vector<Standard_Integer> & count_list)
+{
+    Standard_Integer iInputNum = solid_list->Length();
+    m_iInputNum = iInputNum;
+    count_list.clear();
+    if(m_strDir.IsEmpty())
+    {
+        return 0;
+    }
+    m_strInputHash = HashModel(solid_list);
+
+    Standard_Integer iInputNumLast = -1, iFinished = 0, iChunkNum = 0;
+    string strHashLast;
+    vector<Standard_Integer> count_last;
+
+    ifstream inFile(FilePath("progress.txt").ToCString());
+    if(McCadConvertConfig::ResumeDecompose() && inFile)
+    {
+        string strLine;
+        while(getline(inFile,strLine))
+        {
+            stringstream ss(strLine);
+            string strKey;
+            ss>>strKey;
+            if(strKey == "INPUTSOLIDS")
+            {
+                ss>>iInputNumLast;
+            }
+            else if(strKey == "INPUTHASH")
+            {
+                ss>>strHashLast;
+            }
+            else if(strKey == "FINISHED")
+            {
+                ss>>iFinished;
+            }
+            else if(strKey == "CHUNKS")
+            {
+                ss>>iChunkNum;
+            }
+            else if(strKey == "COUNTS")
+            {
+                Standard_Integer iCount;
+                while(ss>>iCount)
+                {
+                    count_last.push_back(iCount);
+                }
+            }
+        }
+    }
+    inFile.close();
+
+    /// All the chunks are read before any of them is used
+    vector< vector<TopoDS_Shape> > chunk_list;
+    vector<TCollection_AsciiString> cell_list;
+    Standard_Boolean bValid = (iInputNumLast == iInputNum && iFinished > 0
+                               && strHashLast == m_strInputHash.ToCString());
+    for(Standard_Integer i = 1; bValid && i <= iChunkNum; i++)
+    {
+        vector<TopoDS_Shape> part_list;
+        TCollection_AsciiString strCells;
+        if(!ReadChunk(i,part_list,strCells))
+        {
+            cout<<"#Checkpoint chunk "<<i<<" can not be read"<<endl;
+            bValid = Standard_False;
+            break;
+        }
+        chunk_list.push_back(part_list);
+        cell_list.push_back(strCells);
+    }
+
+    if(bValid)
+    {
+        for(unsigned int i = 0; i < chunk_list.size(); i++)
+        {
+            vector<TopoDS_Shape> &part_list = chunk_list.at(i);
+            m_pGeoData->AppendCheckpointData(part_list.at(0),part_list.at(1),part_list.at(2),
+                                             cell_list.at(i));
+            for(TopoDS_Iterator it(part_list.at(3)); it.More(); it.Next())
+            {
+                McCadSurfRegistry::AddSplitSurface(TopoDS::Face(it.Value()));
+            }
+        }
+
+        m_iFinished = iFinished;
+        m_iChunkNum = iChunkNum;
+        m_iSplitMark = McCadSurfRegistry::GetSplitSurfaces().size();
+        m_pGeoData->MarkCheckpoint();
+        count_list = count_last;
+
+        cout<<"-- Resume the decomposition after the "<<iFinished<<" solid"<<endl;
+        return iFinished;
+    }
+
+    if(McCadConvertConfig::ResumeDecompose())
+    {
+        cout<<"-- No checkpoint of the model is found, start the decomposition"<<endl;
+    }
+
+    WriteProgress(count_list);
+    return 0;
+}
+
+
+
+/** ***************************************************************************
+* @brief  The solid is finished, the checkpoint is written after the number
+*         of solids given by the checkpoint interval
+* @param  Standard_Integer iSolid  ( Index of the finished solid )
+*         vector<Standard_Integer> & count_list
+* @return void
+*
+* @date 19/10/2026
+* @author  agent
+******************************************************************************/
+void McCadDcompCheckpoint::Finish(Standard_Integer iSolid,
+                                  const vector<Standard_Integer> & count_list)
+{
+    if(m_strDir.IsEmpty())
+    {
+        return;
+    }
+
+    m_iFinished = iSolid;
+    m_iPending++;
+    if(m_iPending >= (Standard_Integer)McCadConvertConfig::GetCheckpointInterval())
+    {
+        Write(count_list);
+    }
+}
+
+
+
+/** ***************************************************************************
+* @brief  Write the results after last checkpoint into a new chunk, then the
+*         progress file. The chunk is a compound of the decomposed solids,
+*         error solids, symbolic solids and splitting surfaces.
+* @param  vector<Standard_Integer> & count_list
+* @return void
+*
+* @date 19/10/2026
+* @author  agent
+******************************************************************************/
+void McCadDcompCheckpoint::Write(const vector<Standard_Integer> & count_list)
+{
+    if(m_strDir.IsEmpty() || m_iPending == 0)
+    {
+        return;
+    }
+
+    TopoDS_Compound OutSolid, ErrSolid, SymbSolid, SplitSurf;
+    TCollection_AsciiString strCells;
+    m_pGeoData->GetCheckpointData(OutSolid,ErrSolid,SymbSolid,strCells);
+
+    BRep_Builder comp_builder;
+    comp_builder.MakeCompound(SplitSurf);
+    const vector<TopoDS_Face> &split_list = McCadSurfRegistry::GetSplitSurfaces();
+    for(unsigned int i = m_iSplitMark; i < split_list.size(); i++)
+    {
+        comp_builder.Add(SplitSurf, split_list.at(i));
+    }
+
+    TopoDS_Compound theChunk;
+    comp_builder.MakeCompound(theChunk);
+    comp_builder.Add(theChunk, OutSolid);
+    comp_builder.Add(theChunk, ErrSolid);
+    comp_builder.Add(theChunk, SymbSolid);
+    comp_builder.Add(theChunk, SplitSurf);
+
+    TCollection_AsciiString strChunk = "chunk_";
+    strChunk += TCollection_AsciiString(m_iChunkNum + 1);
+    TCollection_AsciiString chunkName = FilePath(strChunk + ".brep");
+    TCollection_AsciiString cellName = FilePath(strChunk + ".txt");
+
+    try
+    {
+        ofstream outFile((chunkName + ".tmp").ToCString(), ios::out | ios::binary);
+        BinTools::Write(theChunk, outFile);
+        outFile.close();
+        if(!outFile)
+        {
+            cout<<"#Cannot write the checkpoint "<<chunkName.ToCString()<<endl;
+            return;
+        }
+    }
+    catch(Standard_Failure)
+    {
+        Standard_Failure::Caught()->Print(cout); cout << endl;
+        return;
+    }
+
+    ofstream cellFile((cellName + ".tmp").ToCString(), ios::out | ios::binary);
+    cellFile<<strCells.ToCString();
+    cellFile.close();
+    if(!cellFile)
+    {
+        cout<<"#Cannot write the checkpoint "<<cellName.ToCString()<<endl;
+        return;
+    }
+
+    if(!Rename(chunkName + ".tmp", chunkName) || !Rename(cellName + ".tmp", cellName))
+    {
+        return;
+    }
+
+    /// The chunk is only used after the progress file records it
+    m_iChunkNum++;
+    if(!WriteProgress(count_list))
+    {
+        m_iChunkNum--;
+        return;
+    }
+
+    m_pGeoData->MarkCheckpoint();
+    m_iSplitMark = split_list.size();
+    m_iPending = 0;
+    cout<<"-- Checkpoint "<<m_iChunkNum<<" is written after the "<<m_iFinished<<" solid"<<endl;
+}
+
+
+
+/** ***************************************************************************
+* @brief  Hash the input solids. The shapes are loaded again in the resumed
+*         run, so the hash is made of the values which do not depend on the
+*         memory: the numbers of faces, edges and vertices, the volume, the
+*         centre of mass and the boundary box of each solid, in the order of
+*         the solids.
+* @param  Handle_TopTools_HSequenceOfShape & solid_list
+* @return TCollection_AsciiString  ( Hexadecimal FNV-1a hash )
+*
+* @date 19/10/2026
+* @author  agent
+******************************************************************************/
+TCollection_AsciiString McCadDcompCheckpoint::HashModel(const Handle_TopTools_HSequenceOfShape & solid_list)
+{
+    unsigned long long iHash = 14695981039346656037ULL;
+    for(Standard_Integer i = 1; i <= solid_list->Length(); i++)
+    {
+        const TopoDS_Shape &theSolid = solid_list->Value(i);
+
+        Standard_Integer iFace = 0, iEdge = 0, iVertex = 0;
+        for(TopExp_Explorer ex(theSolid,TopAbs_FACE); ex.More(); ex.Next()) iFace++;
+        for(TopExp_Explorer ex(theSolid,TopAbs_EDGE); ex.More(); ex.Next()) iEdge++;
+        for(TopExp_Explorer ex(theSolid,TopAbs_VERTEX); ex.More(); ex.Next()) iVertex++;
+
+        GProp_GProps GP;
+        BRepGProp::VolumeProperties(theSolid, GP);
+        gp_Pnt centre = GP.CentreOfMass();
+
+        Standard_Real xMin = 0, yMin = 0, zMin = 0, xMax = 0, yMax = 0, zMax = 0;
+        Bnd_Box bndBox;
+        BRepBndLib::Add(theSolid, bndBox);
+        if(!bndBox.IsVoid())
+        {
+            bndBox.Get(xMin, yMin, zMin, xMax, yMax, zMax);
+        }
+
+        /// The values are rounded, the last digits may differ after reading
+        char strValue[512];
+        sprintf(strValue,"%d %d %d %.6e %.6e %.6e %.6e %.6e %.6e %.6e %.6e %.6e %.6e;",
+                iFace, iEdge, iVertex, GP.Mass(), centre.X(), centre.Y(), centre.Z(),
+                xMin, yMin, zMin, xMax, yMax, zMax);
+        for(const char *p = strValue; *p != '\0'; p++)
+        {
+            iHash ^= (unsigned char)(*p);
+            iHash *= 1099511628211ULL;
+        }
+    }
+
+    char strHash[32];
+    sprintf(strHash,"%016llx",iHash);
+    return TCollection_AsciiString(strHash);
+}
+
+
+
+/** ***************************************************************************
+* @brief  Write the progress file
+* @param  vector<Standard_Integer> & count_list
+* @return Standard_Boolean
+*
+* @date 19/10/2026
+* @author  agent
+******************************************************************************/
+Standard_Boolean McCadDcompCheckpoint::WriteProgress(const vector<Standard_Integer> & count_list)
+{
+    TCollection_AsciiString progName = FilePath("progress.txt");
+
+    ofstream outFile((progName + ".tmp").ToCString());
+    outFile<<"INPUTSOLIDS "<<m_iInputNum<<endl;
+    outFile<<"INPUTHASH "<<m_strInputHash.ToCString()<<endl;
+    outFile<<"FINISHED "<<m_iFinished<<endl;
+    outFile<<"CHUNKS "<<m_iChunkNum<<endl;
+    outFile<<"COUNTS";
+    for(unsigned int i = 0; i < count_list.size(); i++)
+    {
+        outFile<<" "<<count_list.at(i);
+    }
+    outFile<<endl;
+    outFile.close();
+
+    if(!outFile)
+    {
+        cout<<"#Cannot write the checkpoint "<<progName.ToCString()<<endl;
+        return Standard_False;
+    }
+    return Rename(progName + ".tmp", progName);
+}
+
+
+
+/** ***************************************************************************
+* @brief  Read the chunk, the parts are the decomposed solids, error solids,
+*         symbolic solids and splitting surfaces
+* @param  Standard_Integer iChunk
+*         vector<TopoDS_Shape> & part_list
+*         TCollection_AsciiString & theCells
+* @return Standard_Boolean
+*
+* @date 19/10/2026
+* @author  agent
+******************************************************************************/
+Standard_Boolean McCadDcompCheckpoint::ReadChunk(Standard_Integer iChunk,
+                                                 vector<TopoDS_Shape> & part_list,
+                                                 TCollection_AsciiString & theCells)
+{
+    TCollection_AsciiString strChunk = "chunk_";
+    strChunk += TCollection_AsciiString(iChunk);
+
+    TopoDS_Shape theChunk;
+    try
+    {
+        ifstream inFile(FilePath(strChunk + ".brep").ToCString(), ios::in | ios::binary);
+        if(!inFile)
+        {
+            return Standard_False;
+        }
+        BinTools::Read(theChunk, inFile);
+    }
+    catch(Standard_Failure)
+    {
+        Standard_Failure::Caught()->Print(cout); cout << endl;
+        return Standard_False;
+    }
+
+    part_list.clear();
+    for(TopoDS_Iterator it(theChunk); it.More(); it.Next())
+    {
+        part_list.push_back(it.Value());
+    }
+    if(part_list.size() != 4)
+    {
+        return Standard_False;
+    }
+
+    ifstream cellFile(FilePath(strChunk + ".txt").ToCString(), ios::in | ios::binary);
+    if(!cellFile)
+    {
+        return Standard_False;
+    }
+    stringstream ss;
+    ss<<cellFile.rdbuf();
+    theCells = TCollection_AsciiString(ss.str().c_str());
+    return Standard_True;
+}
+
+
+
+/** ***************************************************************************
+* @brief  Path of the file in run directory
+* @param  TCollection_AsciiString & theName
+* @return TCollection_AsciiString
+*
+* @date 19/10/2026
+* @author  agent
+******************************************************************************/
+TCollection_AsciiString McCadDcompCheckpoint::FilePath(const TCollection_AsciiString & theName) const
+{
+    TCollection_AsciiString strPath = m_strDir;
+    strPath += "/";
+    strPath += theName;
+    return strPath;
+}
+
+
+
+/** ***************************************************************************
+* @brief  Replace the file with the temporary file. The rename does not replace
+*         an existing file on some systems, then the old file is removed first.
+* @param  TCollection_AsciiString & theTmpFile
+*         TCollection_AsciiString & theFile
+* @return Standard_Boolean
+*
+* @date 19/10/2026
+* @author  agent
+******************************************************************************/
+Standard_Boolean McCadDcompCheckpoint::Rename(const TCollection_AsciiString & theTmpFile,
+                                              const TCollection_AsciiString & theFile)
+{
+    if(rename(theTmpFile.ToCString(), theFile.ToCString()) == 0)
+    {
+        return Standard_True;
+    }
+
+    remove(theFile.ToCString());
+    if(rename(theTmpFile.ToCString(), theFile.ToCString()) == 0)
+    {
+        return Standard_True;
+    }
+
+    cout<<"#Cannot rename the checkpoint "<<theTmpFile.ToCString()<<endl;
+    return Standard_False;
+}
@@ -0,0 +1,80 @@
+#ifndef MCCADDCOMPCHECKPOINT_HXX
+#define MCCADDCOMPCHECKPOINT_HXX
+
+#include <vector>
+#include <Standard.hxx>
+#include <TCollection_AsciiString.hxx>
+#include <TopoDS_Shape.hxx>
+#include <Handle_TopTools_HSequenceOfShape.hxx>
+
+#include "McCadDcompGeomData.hxx"
+
+using namespace std;
+
+/** Checkpoints of the decomposition. After every few input solids the new
+    decomposed solids, error solids, symbolic cells and used splitting surfaces
+    are written into a chunk file of binary BRep in the run directory, then the
+    progress file records the finished solids and the chunks. Each file is
+    written into a temporary file and renamed, an interrupted writing keeps the
+    last checkpoint. The resumed run reads the chunks in order and restores the
+    surface registry, so the output is the same as an uninterrupted run. The
+    progress file keeps a hash of the input solids, the checkpoints of another
+    model with the same number of solids are not used. */
+class McCadDcompCheckpoint
+{
+public:
+
+    void* operator new(size_t,void* anAddress)
+    {
+        return anAddress;
+    }
+    void* operator new(size_t size)
+    {
+        return Standard::Allocate(size);
+    }
+    void  operator delete(void *anAddress)
+    {
+        if (anAddress) Standard::Free((Standard_Address&)anAddress);
+    }
+
+    McCadDcompCheckpoint(McCadDcompGeomData * pGeoData);
+    ~McCadDcompCheckpoint();
+
+public:
+
+    /**< Read the checkpoints of last run, return the number of finished solids */
+    Standard_Integer Resume(const Handle_TopTools_HSequenceOfShape & solid_list,
+                            vector<Standard_Integer> & count_list);
+    /**< The solid is finished, write a checkpoint if enough solids are finished */
+    void Finish(Standard_Integer iSolid, const vector<Standard_Integer> & count_list);
+    /**< Write the results after last checkpoint */
+    void Write(const vector<Standard_Integer> & count_list);
+
+private:
+
+    McCadDcompGeomData * m_pGeoData;        /**< The geometry data of decomposition */
+    TCollection_AsciiString m_strDir;       /**< Run directory, empty if checkpoint is off */
+    Standard_Integer m_iInputNum;           /**< Number of input solids */
+    TCollection_AsciiString m_strInputHash; /**< Hash of the input solids */
+    Standard_Integer m_iFinished;           /**< Number of finished solids */
+    Standard_Integer m_iChunkNum;           /**< Number of written chunks */
+    Standard_Integer m_iPending;            /**< Finished solids not in checkpoints */
+    Standard_Integer m_iSplitMark;          /**< Splitting surfaces written in checkpoints */
+
+private:
+
+    /**< Hash of the topology, volume and position of the input solids */
+    static TCollection_AsciiString HashModel(const Handle_TopTools_HSequenceOfShape & solid_list);
+    /**< Path of the file in run directory */
+    TCollection_AsciiString FilePath(const TCollection_AsciiString & theName) const;
+    /**< Write the progress file */
+    Standard_Boolean WriteProgress(const vector<Standard_Integer> & count_list);
+    /**< Read the results and splitting surfaces of the chunk */
+    Standard_Boolean ReadChunk(Standard_Integer iChunk, vector<TopoDS_Shape> & part_list,
+                               TCollection_AsciiString & theCells);
+    /**< Replace the file with the temporary file */
+    static Standard_Boolean Rename(const TCollection_AsciiString & theTmpFile,
+                                   const TCollection_AsciiString & theFile);
+};
+
+#endif // MCCADDCOMPCHECKPOINT_HXX
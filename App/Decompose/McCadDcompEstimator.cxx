@@ -0,0 +1,433 @@
+#include "McCadDcompEstimator.hxx"
+
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <stdlib.h>
+
+#include <BRep_Tool.hxx>
+#include <BRepTools.hxx>
+#include <BRepBuilderAPI_Copy.hxx>
+#include <BRepAdaptor_Surface.hxx>
+#include <BRepMesh_IncrementalMesh.hxx>
+#include <Poly_Triangulation.hxx>
+#include <TopLoc_Location.hxx>
+#include <TopoDS.hxx>
+#include <TopExp_Explorer.hxx>
+#include <TopTools_HSequenceOfShape.hxx>
+
+#include "McCadDecompose.hxx"
+#include "McCadSplitCostModel.hxx"
+#include "../Tools/McCadConvertConfig.hxx"
+#include "../Tools/McCadMathTool.hxx"
+
+Standard_Boolean McCadDcompEstimator::m_bLoaded = Standard_False;
+
+/// The weights before any record is fitted. Each split removes about two
+/// concave edges, a concave curved face needs its own split. Each split
+/// judges the faces of the solid and meshes the split solids again.
+Standard_Real McCadDcompEstimator::m_fSplitWeight[McCadDcompEstimator::NbFeature] = {0.0, 0.5, 1.0};
+Standard_Real McCadDcompEstimator::m_fTimeWeight[McCadDcompEstimator::NbFeature] = {0.1, 1.0e-2, 1.0e-4};
+
+McCadDcompEstimator::McCadDcompEstimator(Handle_TopTools_HSequenceOfShape & solid_list)
+{
+    m_SolidList = solid_list;
+}
+
+McCadDcompEstimator::~McCadDcompEstimator()
+{
+    m_CostList.clear();
+}
+
+
+
+/** ***************************************************************************
+* @brief  Count the features of the input solids and predict the cost, then
+*         sort the solids by the predicted runtime
+* @param
+* @return void
+*
+* @date 19/10/2026
+* @author  agent
+******************************************************************************/
+void McCadDcompEstimator::Perform()
+{
+    if(!m_bLoaded)
+    {
+        Load();
+    }
+
+    m_CostList.clear();
+    for(int i = 1; i <= m_SolidList->Length(); i++)
+    {
+        if(m_SolidList->Value(i).ShapeType() != TopAbs_SOLID)
+        {
+            continue;
+        }
+
+        TopoDS_Solid theSolid = TopoDS::Solid(m_SolidList->Value(i));
+
+        SolidCost theCost;
+        theCost.iSolid = i;
+        GenFeatures(theSolid,theCost);
+        Predict(theCost);
+        m_CostList.push_back(theCost);
+    }
+
+    /// The most expensive solid is the first, the input order is kept for same cost
+    for(unsigned int i = 1; i < m_CostList.size(); i++)
+    {
+        for(unsigned int j = i; j > 0 && m_CostList.at(j-1).fTime < m_CostList.at(j).fTime; j--)
+        {
+            swap(m_CostList.at(j-1),m_CostList.at(j));
+        }
+    }
+}
+
+
+
+/** ***************************************************************************
+* @brief  Count the faces of each surface type, the concave edges and faces,
+*         and the triangles of meshing at the decomposition deflection. A
+*         copy of the solid is meshed and cleaned, the solid is not changed.
+* @param  TopoDS_Solid & theSolid
+*         SolidCost & theCost
+* @return void
+*
+* @date 19/10/2026
+* @author  agent
+******************************************************************************/
+void McCadDcompEstimator::GenFeatures(TopoDS_Solid & theSolid, SolidCost & theCost)
+{
+    theCost.iFaceNum = 0;
+    theCost.iPlaneNum = 0;
+    theCost.iCylinderNum = 0;
+    theCost.iConeNum = 0;
+    theCost.iSphereNum = 0;
+    theCost.iTorusNum = 0;
+    theCost.iOtherNum = 0;
+    theCost.iConcaveCurvNum = 0;
+    theCost.iTriangleNum = 0;
+    theCost.fSplitNum = 0.0;
+    theCost.fTime = 0.0;
+
+    for(TopExp_Explorer exF(theSolid,TopAbs_FACE); exF.More(); exF.Next())
+    {
+        TopoDS_Face face = TopoDS::Face(exF.Current());
+        BRepAdaptor_Surface BS(face, Standard_True);
+
+        theCost.iFaceNum++;
+        switch(BS.GetType())
+        {
+            case GeomAbs_Plane:
+                theCost.iPlaneNum++;
+                break;
+            case GeomAbs_Cylinder:
+                theCost.iCylinderNum++;
+                break;
+            case GeomAbs_Cone:
+                theCost.iConeNum++;
+                break;
+            case GeomAbs_Sphere:
+                theCost.iSphereNum++;
+                break;
+            case GeomAbs_Torus:
+                theCost.iTorusNum++;
+                break;
+            default:
+                theCost.iOtherNum++;
+                break;
+        }
+
+        if(BS.GetType() != GeomAbs_Plane && face.Orientation() != TopAbs_FORWARD)
+        {
+            theCost.iConcaveCurvNum++;
+        }
+    }
+
+    theCost.iConcaveEdgeNum = McCadSplitCostModel::CountConcaveEdges(theSolid);
+    theCost.fDeflection = McCadDecompose::CalMeshDeflection(theSolid);
+
+    /// The copy is meshed, the triangulation of the caller's solid is kept
+    TopoDS_Shape theCopy;
+    try
+    {
+        BRepBuilderAPI_Copy copier(theSolid);
+        theCopy = copier.Shape();
+        BRepMesh_IncrementalMesh(theCopy, theCost.fDeflection);
+        for(TopExp_Explorer exF(theCopy,TopAbs_FACE); exF.More(); exF.Next())
+        {
+            TopLoc_Location loc;
+            Handle(Poly_Triangulation) mesh = BRep_Tool::Triangulation(TopoDS::Face(exF.Current()),loc);
+            if(!mesh.IsNull())
+            {
+                theCost.iTriangleNum += mesh->NbTriangles();
+            }
+        }
+    }
+    catch(...)
+    {
+        cout<<"#McCadDcompEstimator::GenFeatures: Solid meshing has errors"<<endl;
+    }
+    if(!theCopy.IsNull())
+    {
+        BRepTools::Clean(theCopy);
+    }
+}
+
+
+
+/** ***************************************************************************
+* @brief  Features of the split number model
+* @param  SolidCost & theCost
+*         Standard_Real theFeature[]
+* @return void
+*
+* @date 19/10/2026
+* @author  agent
+******************************************************************************/
+void McCadDcompEstimator::GetSplitFeatures(const SolidCost & theCost,
+                                           Standard_Real theFeature[NbFeature])
+{
+    theFeature[0] = 1.0;
+    theFeature[1] = theCost.iConcaveEdgeNum;
+    theFeature[2] = theCost.iConcaveCurvNum;
+}
+
+
+
+/** ***************************************************************************
+* @brief  Features of the runtime model. Every split judges the faces of the
+*         solid, and every split solid is meshed again.
+* @param  SolidCost & theCost
+*         Standard_Real fSplitNum
+*         Standard_Real theFeature[]
+* @return void
+*
+* @date 19/10/2026
+* @author  agent
+******************************************************************************/
+void McCadDcompEstimator::GetTimeFeatures(const SolidCost & theCost, Standard_Real fSplitNum,
+                                          Standard_Real theFeature[NbFeature])
+{
+    theFeature[0] = 1.0;
+    theFeature[1] = fSplitNum*theCost.iFaceNum;
+    theFeature[2] = (fSplitNum + 1.0)*theCost.iTriangleNum;
+}
+
+
+
+/** ***************************************************************************
+* @brief  Predict the split number and runtime of the solid
+* @param  SolidCost & theCost
+* @return void
+*
+* @date 19/10/2026
+* @author  agent
+******************************************************************************/
+void McCadDcompEstimator::Predict(SolidCost & theCost)
+{
+    Standard_Real feature[NbFeature];
+
+    GetSplitFeatures(theCost,feature);
+    theCost.fSplitNum = 0.0;
+    for(int i = 0; i < NbFeature; i++)
+    {
+        theCost.fSplitNum += m_fSplitWeight[i]*feature[i];
+    }
+    theCost.fSplitNum = Max(theCost.fSplitNum, 0.0);
+
+    GetTimeFeatures(theCost,theCost.fSplitNum,feature);
+    theCost.fTime = 0.0;
+    for(int i = 0; i < NbFeature; i++)
+    {
+        theCost.fTime += m_fTimeWeight[i]*feature[i];
+    }
+    theCost.fTime = Max(theCost.fTime, 0.0);
+}
+
+
+
+/** ***************************************************************************
+* @brief  Append the features of the decomposed solid, the number of splits
+*         and the runtime into the record file
+* @param  SolidCost & theCost
+*         Standard_Integer iSplitNum
+*         Standard_Real fTime
+* @return void
+*
+* @date 19/10/2026
+* @author  agent
+******************************************************************************/
+void McCadDcompEstimator::Record(const SolidCost & theCost, Standard_Integer iSplitNum,
+                                 Standard_Real fTime)
+{
+    TCollection_AsciiString strFile = McCadConvertConfig::GetEstimateFile();
+    if(strFile.IsEmpty())
+    {
+        return;
+    }
+
+    ofstream outFile(strFile.ToCString(), ios::app);
+    if(!outFile)
+    {
+        cout<<"#Cannot open the estimate record file "<<strFile.ToCString()<<endl;
+        return;
+    }
+
+    outFile<<theCost.iFaceNum<<","<<theCost.iConcaveEdgeNum<<","<<theCost.iConcaveCurvNum<<","
+           <<theCost.iTriangleNum<<","<<iSplitNum<<","<<fTime<<endl;
+}
+
+
+
+/** ***************************************************************************
+* @brief  Read the records and fit the split number model and the runtime
+*         model. The default weights are kept if there are not enough records.
+* @param
+* @return void
+*
+* @date 19/10/2026
+* @author  agent
+******************************************************************************/
+void McCadDcompEstimator::Load()
+{
+    m_bLoaded = Standard_True;
+
+    TCollection_AsciiString strFile = McCadConvertConfig::GetEstimateFile();
+    if(strFile.IsEmpty())
+    {
+        return;
+    }
+
+    ifstream inFile(strFile.ToCString());
+    if(!inFile)
+    {
+        return;
+    }
+
+    vector< vector<Standard_Real> > split_rows, time_rows;
+    vector<Standard_Real> split_values, time_values;
+
+    string strLine;
+    while(getline(inFile,strLine))
+    {
+        Standard_Real value[6];
+        stringstream ss(strLine);
+        string strValue;
+        int iValue = 0;
+        while(iValue < 6 && getline(ss,strValue,','))
+        {
+            value[iValue++] = atof(strValue.c_str());
+        }
+        if(iValue < 6)
+        {
+            continue;
+        }
+
+        SolidCost theCost;
+        theCost.iFaceNum = (Standard_Integer)value[0];
+        theCost.iConcaveEdgeNum = (Standard_Integer)value[1];
+        theCost.iConcaveCurvNum = (Standard_Integer)value[2];
+        theCost.iTriangleNum = (Standard_Integer)value[3];
+
+        Standard_Real feature[NbFeature];
+        GetSplitFeatures(theCost,feature);
+        split_rows.push_back(vector<Standard_Real>(feature,feature+NbFeature));
+        split_values.push_back(value[4]);
+
+        GetTimeFeatures(theCost,value[4],feature);
+        time_rows.push_back(vector<Standard_Real>(feature,feature+NbFeature));
+        time_values.push_back(value[5]);
+    }
+
+    vector<Standard_Real> split_weight, time_weight;
+    if(McCadMathTool::FitLeastSquares(split_rows,split_values,split_weight)
+       && McCadMathTool::FitLeastSquares(time_rows,time_values,time_weight))
+    {
+        for(int i = 0; i < NbFeature; i++)
+        {
+            m_fSplitWeight[i] = split_weight.at(i);
+            m_fTimeWeight[i] = time_weight.at(i);
+        }
+        cout<<"# Decomposition cost model is fitted with "<<split_rows.size()<<" records"<<endl;
+    }
+}
+
+
+
+/** ***************************************************************************
+* @brief  Write the table as comma separated values
+* @param  TCollection_AsciiString & theFileName
+* @return Standard_Boolean
+*
+* @date 19/10/2026
+* @author  agent
+******************************************************************************/
+Standard_Boolean McCadDcompEstimator::WriteCSV(const TCollection_AsciiString & theFileName)
+{
+    ofstream outFile(theFileName.ToCString());
+    if(!outFile)
+    {
+        cout<<"#Cannot open the file "<<theFileName.ToCString()<<endl;
+        return Standard_False;
+    }
+
+    outFile<<"solid,faces,planes,cylinders,cones,spheres,tori,others,"
+           <<"concave_edges,concave_curved_faces,deflection,triangles,"
+           <<"predicted_splits,predicted_seconds"<<endl;
+
+    for(unsigned int i = 0; i < m_CostList.size(); i++)
+    {
+        const SolidCost &theCost = m_CostList.at(i);
+        outFile<<theCost.iSolid<<","<<theCost.iFaceNum<<","<<theCost.iPlaneNum<<","
+               <<theCost.iCylinderNum<<","<<theCost.iConeNum<<","<<theCost.iSphereNum<<","
+               <<theCost.iTorusNum<<","<<theCost.iOtherNum<<","<<theCost.iConcaveEdgeNum<<","
+               <<theCost.iConcaveCurvNum<<","<<theCost.fDeflection<<","<<theCost.iTriangleNum<<","
+               <<theCost.fSplitNum<<","<<theCost.fTime<<endl;
+    }
+    return Standard_True;
+}
+
+
+
+/** ***************************************************************************
+* @brief  Write the table as a json array, one object for each solid
+* @param  TCollection_AsciiString & theFileName
+* @return Standard_Boolean
+*
+* @date 19/10/2026
+* @author  agent
+******************************************************************************/
+Standard_Boolean McCadDcompEstimator::WriteJSON(const TCollection_AsciiString & theFileName)
+{
+    ofstream outFile(theFileName.ToCString());
+    if(!outFile)
+    {
+        cout<<"#Cannot open the file "<<theFileName.ToCString()<<endl;
+        return Standard_False;
+    }
+
+    outFile<<"["<<endl;
+    for(unsigned int i = 0; i < m_CostList.size(); i++)
+    {
+        const SolidCost &theCost = m_CostList.at(i);
+        outFile<<"  {\"solid\": "<<theCost.iSolid
+               <<", \"faces\": "<<theCost.iFaceNum
+               <<", \"surface_types\": {\"plane\": "<<theCost.iPlaneNum
+               <<", \"cylinder\": "<<theCost.iCylinderNum
+               <<", \"cone\": "<<theCost.iConeNum
+               <<", \"sphere\": "<<theCost.iSphereNum
+               <<", \"torus\": "<<theCost.iTorusNum
+               <<", \"other\": "<<theCost.iOtherNum<<"}"
+               <<", \"concave_edges\": "<<theCost.iConcaveEdgeNum
+               <<", \"concave_curved_faces\": "<<theCost.iConcaveCurvNum
+               <<", \"deflection\": "<<theCost.fDeflection
+               <<", \"triangles\": "<<theCost.iTriangleNum
+               <<", \"predicted_splits\": "<<theCost.fSplitNum
+               <<", \"predicted_seconds\": "<<theCost.fTime<<"}";
+        outFile<<(i+1 < m_CostList.size() ? "," : "")<<endl;
+    }
+    outFile<<"]"<<endl;
+    return Standard_True;
+}
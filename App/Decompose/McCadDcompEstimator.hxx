@@ -0,0 +1,95 @@
+#ifndef MCCADDCOMPESTIMATOR_HXX
+#define MCCADDCOMPESTIMATOR_HXX
+
+#include <vector>
+#include <Standard.hxx>
+#include <TopoDS_Solid.hxx>
+#include <Handle_TopTools_HSequenceOfShape.hxx>
+#include <TCollection_AsciiString.hxx>
+
+using namespace std;
+
+/** Estimate the decomposition cost of the input solids without decomposing
+    them. The features of each solid are counted from its topology and the
+    meshing at the decomposition deflection, the split number and runtime are
+    predicted by linear models. The models are fitted from the records of
+    earlier decompositions if the record file is given. The table is sorted
+    by the predicted runtime, the most expensive solid is the first. */
+class McCadDcompEstimator
+{
+public:
+
+    void* operator new(size_t,void* anAddress)
+    {
+        return anAddress;
+    }
+    void* operator new(size_t size)
+    {
+        return Standard::Allocate(size);
+    }
+    void  operator delete(void *anAddress)
+    {
+        if (anAddress) Standard::Free((Standard_Address&)anAddress);
+    }
+
+    /** The features and predicted cost of one solid */
+    struct SolidCost
+    {
+        Standard_Integer iSolid;            /**< Index in the input solid list */
+        Standard_Integer iFaceNum;          /**< Number of faces */
+        Standard_Integer iPlaneNum;         /**< Number of planar faces */
+        Standard_Integer iCylinderNum;      /**< Number of cylindrical faces */
+        Standard_Integer iConeNum;          /**< Number of conical faces */
+        Standard_Integer iSphereNum;        /**< Number of spherical faces */
+        Standard_Integer iTorusNum;         /**< Number of toroidal faces */
+        Standard_Integer iOtherNum;         /**< Number of faces of other types */
+        Standard_Integer iConcaveEdgeNum;   /**< Number of concave edges */
+        Standard_Integer iConcaveCurvNum;   /**< Number of concave curved faces */
+        Standard_Integer iTriangleNum;      /**< Number of triangles at the deflection */
+        Standard_Real fDeflection;          /**< Deflection of meshing */
+        Standard_Real fSplitNum;            /**< Predicted number of splits */
+        Standard_Real fTime;                /**< Predicted runtime in seconds */
+    };
+
+    McCadDcompEstimator(Handle_TopTools_HSequenceOfShape & solid_list);
+    ~McCadDcompEstimator();
+
+public:
+
+    /**< Count the features and predict the cost of the solids */
+    void Perform();
+    /**< Write the table as comma separated values */
+    Standard_Boolean WriteCSV(const TCollection_AsciiString & theFileName);
+    /**< Write the table as a json array */
+    Standard_Boolean WriteJSON(const TCollection_AsciiString & theFileName);
+
+    /**< Count the features of the solid */
+    static void GenFeatures(TopoDS_Solid & theSolid, SolidCost & theCost);
+    /**< Append the features and the measured cost into the record file */
+    static void Record(const SolidCost & theCost, Standard_Integer iSplitNum, Standard_Real fTime);
+
+private:
+
+    enum { NbFeature = 3 };
+
+    Handle_TopTools_HSequenceOfShape m_SolidList;   /**< The input solids */
+    vector<SolidCost> m_CostList;                   /**< Cost of the solids, sorted by runtime */
+
+    static Standard_Boolean m_bLoaded;                      /**< The record file has been read or not */
+    static Standard_Real m_fSplitWeight[NbFeature];         /**< Weights of split number model */
+    static Standard_Real m_fTimeWeight[NbFeature];          /**< Weights of runtime model */
+
+private:
+
+    /**< Read the record file and fit the models */
+    static void Load();
+    /**< Predict the split number and runtime */
+    static void Predict(SolidCost & theCost);
+    /**< Features of the split number model */
+    static void GetSplitFeatures(const SolidCost & theCost, Standard_Real theFeature[NbFeature]);
+    /**< Features of the runtime model with the split number */
+    static void GetTimeFeatures(const SolidCost & theCost, Standard_Real fSplitNum,
+                                Standard_Real theFeature[NbFeature]);
+};
+
+#endif // MCCADDCOMPESTIMATOR_HXX
@@ -4,15 +4,24 @@
 #include <TopoDS.hxx>
 
 #include <BRep_Builder.hxx>
+#include <TopoDS_Iterator.hxx>
+
+#include <fstream>
 
 #include "McCadDcompSolid.hxx"
 
-#include "../McCadTool/McCadGeneTool.hxx"
+#include "../Tools/McCadGeneTool.hxx"
 
 McCadDcompGeomData::McCadDcompGeomData()
 {
     m_OutCompSolidList = new TopTools_HSequenceOfShape;
     m_ErrCompSolidList = new TopTools_HSequenceOfShape;
+    m_SymbSolidList = new TopTools_HSequenceOfShape;
+
+    m_iOutMark = 0;
+    m_iErrMark = 0;
+    m_iSymbMark = 0;
+    m_iCellMark = 0;
 }
 
 
@@ -48,6 +57,7 @@ McCadDcompGeomData::~McCadDcompGeomData()
         }
     }
     m_ErrCompSolidList->Clear();
+    m_SymbSolidList->Clear();
 }
 
 
@@ -156,6 +166,38 @@ void McCadDcompGeomData::AddDecompSolid(vector<McCadDcompSolid *> *& pSolidList)
 
 
 
+/** ***************************************************************************
+* @brief  Add the solid decomposed by sign vectors and its cell expressions.
+*         The solids of the cells are added as the compound solid of the
+*         decomposed model, so the conversion gets the solid as the others.
+* @param  TopoDS_Solid & theSolid
+*         Handle_TopTools_HSequenceOfShape & cell_list  ( Solids of the cells )
+*         TCollection_AsciiString & theCells
+* @return void
+*
+* @date 19/10/2026
+* @author  agent
+******************************************************************************/
+void McCadDcompGeomData::AddSymbolicSolid(const TopoDS_Solid & theSolid,
+                                          const Handle_TopTools_HSequenceOfShape & cell_list,
+                                          const TCollection_AsciiString & theCells)
+{
+    TopoDS_Compound comp_solid;
+    BRep_Builder comp_builder;
+    comp_builder.MakeCompound(comp_solid);
+    for(Standard_Integer i = 1; i <= cell_list->Length(); i++)
+    {
+        comp_builder.Add(comp_solid, cell_list->Value(i));
+    }
+    m_OutCompSolidList->Append(comp_solid);
+
+    m_SymbSolidList->Append(theSolid);
+    m_strSymbCells += theCells;
+}
+
+
+
+
 /** ***************************************************************************
 * @brief  Get the stroed input solid for decomposition
 * @param  Handle_TopTools_HSequenceOfShape
@@ -173,6 +215,24 @@ Handle_TopTools_HSequenceOfShape McCadDcompGeomData::GetInputSolidList() const
 
 
 
+/** ***************************************************************************
+* @brief  Get the decomposed solids, each input solid gives one compound in
+*         the same order as the saved model, the convertor reads them without
+*         saving and loading the step file.
+* @param
+* @return Handle_TopTools_HSequenceOfShape
+*
+* @date 19/10/2026
+* @author  agent
+******************************************************************************/
+Handle_TopTools_HSequenceOfShape McCadDcompGeomData::GetDecompSolidList() const
+{
+    return m_OutCompSolidList;
+}
+
+
+
+
 /** ***************************************************************************
 * @brief  Combine solids as a compound solid for saving
 * @param
@@ -211,15 +271,14 @@ Handle_TopTools_HSequenceOfShape McCadDcompGeomData::CombineSolids()
 * @return void
 *
 * @date 01/06/2015
-* @modify
+* @modify 19/10/2026
 * @author  Lei Lu
 ******************************************************************************/
 void McCadDcompGeomData::SaveSolids(TCollection_AsciiString theFileName, Standard_Integer iCombine)
 {
     cout<<"-- Saving the decomposed model."<<endl;
 
-    TCollection_AsciiString vorName = "Decomposed_";
-    TCollection_AsciiString outName = vorName + theFileName;
+    TCollection_AsciiString outName = McCadGeneTool::PrefixFileName("Decomposed_", theFileName);
     Standard_CString output_filename = outName.ToCString();
 
     if(iCombine == 1)
@@ -254,10 +313,27 @@ void McCadDcompGeomData::SaveSolids(TCollection_AsciiString theFileName, Standar
     }
 
     cout<<endl<<endl;
+    SaveErrorSolids(theFileName);
+}
+
+
+
+
+/** ***************************************************************************
+* @brief  Save the error solids and the solids decomposed by sign vectors with
+*         their cells. The decomposition in memory writes them as well, the
+*         decomposed model is passed to the conversion directly.
+* @param  TCollection_AsciiString theFileName
+* @return void
+*
+* @date 19/10/2026
+* @author  agent
+******************************************************************************/
+void McCadDcompGeomData::SaveErrorSolids(TCollection_AsciiString theFileName)
+{
     cout<<"-- Saving the error solids."<<endl;
 
-    TCollection_AsciiString vorNameErr = "Error_";
-    TCollection_AsciiString errName = vorNameErr + theFileName;
+    TCollection_AsciiString errName = McCadGeneTool::PrefixFileName("Error_", theFileName);
     Standard_CString error_filename = errName.ToCString();
 
     Handle_TopTools_HSequenceOfShape OutErrSolid = new TopTools_HSequenceOfShape;
@@ -275,9 +351,119 @@ void McCadDcompGeomData::SaveSolids(TCollection_AsciiString theFileName, Standar
 
     McCadGeneTool::WriteFile(error_filename, OutErrSolid);
     cout<<endl<<endl;
+
+    if(m_SymbSolidList->IsEmpty())
+    {
+        return;
+    }
+
+    /// The solids decomposed by sign vectors and their cells
+    cout<<"-- Saving the solids decomposed by sign vectors."<<endl;
+
+    TCollection_AsciiString symbName = McCadGeneTool::PrefixFileName("Symbolic_", theFileName);
+    McCadGeneTool::WriteFile(symbName, m_SymbSolidList);
+
+    TCollection_AsciiString cellName = symbName + ".txt";
+    ofstream theStream(cellName.ToCString());
+    if(!theStream)
+    {
+        cout<<"#Can not open the file "<<cellName.ToCString()<<endl;
+        return;
+    }
+    theStream<<m_strSymbCells.ToCString();
+    theStream.close();
+    cout<<endl<<endl;
+}
+
+
+
+
+/** ***************************************************************************
+* @brief  Collect the results added after the last checkpoint. The compound
+*         solids keep their order, appending them after the results of the
+*         earlier checkpoints gives the same lists as an uninterrupted run.
+* @param  TopoDS_Compound & theOutSolid, & theErrSolid, & theSymbSolid
+*         TCollection_AsciiString & theSymbCells
+* @return void
+*
+* @date 19/10/2026
+* @author  agent
+******************************************************************************/
+void McCadDcompGeomData::GetCheckpointData(TopoDS_Compound & theOutSolid,
+                                           TopoDS_Compound & theErrSolid,
+                                           TopoDS_Compound & theSymbSolid,
+                                           TCollection_AsciiString & theSymbCells)
+{
+    BRep_Builder comp_builder;
+    comp_builder.MakeCompound(theOutSolid);
+    comp_builder.MakeCompound(theErrSolid);
+    comp_builder.MakeCompound(theSymbSolid);
+
+    for(Standard_Integer i = m_iOutMark + 1; i <= m_OutCompSolidList->Length(); i++)
+    {
+        comp_builder.Add(theOutSolid, m_OutCompSolidList->Value(i));
+    }
+    for(Standard_Integer i = m_iErrMark + 1; i <= m_ErrCompSolidList->Length(); i++)
+    {
+        comp_builder.Add(theErrSolid, m_ErrCompSolidList->Value(i));
+    }
+    for(Standard_Integer i = m_iSymbMark + 1; i <= m_SymbSolidList->Length(); i++)
+    {
+        comp_builder.Add(theSymbSolid, m_SymbSolidList->Value(i));
+    }
+
+    theSymbCells = "";
+    if(m_strSymbCells.Length() > m_iCellMark)
+    {
+        theSymbCells = m_strSymbCells.SubString(m_iCellMark + 1, m_strSymbCells.Length());
+    }
 }
 
 
 
+/** ***************************************************************************
+* @brief  Append the results read from a checkpoint
+* @param  TopoDS_Shape & theOutSolid, & theErrSolid, & theSymbSolid
+*         TCollection_AsciiString & theSymbCells
+* @return void
+*
+* @date 19/10/2026
+* @author  agent
+******************************************************************************/
+void McCadDcompGeomData::AppendCheckpointData(const TopoDS_Shape & theOutSolid,
+                                              const TopoDS_Shape & theErrSolid,
+                                              const TopoDS_Shape & theSymbSolid,
+                                              const TCollection_AsciiString & theSymbCells)
+{
+    for(TopoDS_Iterator it(theOutSolid); it.More(); it.Next())
+    {
+        m_OutCompSolidList->Append(it.Value());
+    }
+    for(TopoDS_Iterator it(theErrSolid); it.More(); it.Next())
+    {
+        m_ErrCompSolidList->Append(it.Value());
+    }
+    for(TopoDS_Iterator it(theSymbSolid); it.More(); it.Next())
+    {
+        m_SymbSolidList->Append(it.Value());
+    }
+    m_strSymbCells += theSymbCells;
+}
 
 
+
+/** ***************************************************************************
+* @brief  All the results have been written into the checkpoints
+* @param
+* @return void
+*
+* @date 19/10/2026
+* @author  agent
+******************************************************************************/
+void McCadDcompGeomData::MarkCheckpoint()
+{
+    m_iOutMark = m_OutCompSolidList->Length();
+    m_iErrMark = m_ErrCompSolidList->Length();
+    m_iSymbMark = m_SymbSolidList->Length();
+    m_iCellMark = m_strSymbCells.Length();
+}
@@ -37,17 +37,37 @@ public:
 
     void InputSolids( Handle_TopTools_HSequenceOfShape & solid_list );  /**< Input and store the solids */
     Handle_TopTools_HSequenceOfShape GetInputSolidList() const;         /**< Get the input solid list */
+    Handle_TopTools_HSequenceOfShape GetDecompSolidList() const;        /**< Get the decomposed compound solids */
 
     void AddErrorSolid(vector<McCadDcompSolid*> *& pSolidList);     /**< Add the error solid */
     void AddDecompSolid(vector<McCadDcompSolid*> *& pSolidList);    /**< Add the compound solid */
+    void AddSymbolicSolid(const TopoDS_Solid & theSolid,
+                          const Handle_TopTools_HSequenceOfShape & cell_list,
+                          const TCollection_AsciiString & theCells);  /**< Add the solid decomposed by sign vectors */
 
     void SaveSolids(TCollection_AsciiString theFileName, Standard_Integer iCombine);      /**< Save the decomposed solids and error solids */
+    void SaveErrorSolids(TCollection_AsciiString theFileName);          /**< Save the error solids and symbolic solids */
+
+    void GetCheckpointData(TopoDS_Compound & theOutSolid, TopoDS_Compound & theErrSolid,
+                           TopoDS_Compound & theSymbSolid,
+                           TCollection_AsciiString & theSymbCells);  /**< The results added after last checkpoint */
+    void AppendCheckpointData(const TopoDS_Shape & theOutSolid, const TopoDS_Shape & theErrSolid,
+                              const TopoDS_Shape & theSymbSolid,
+                              const TCollection_AsciiString & theSymbCells);   /**< Append the results of checkpoint */
+    void MarkCheckpoint();                                              /**< The results are all in checkpoints */
 
 private:
 
     Handle_TopTools_HSequenceOfShape m_InputSolidList;      /**< loaded solid list */
     Handle_TopTools_HSequenceOfShape m_OutCompSolidList;    /**< The output compound solid */
     Handle_TopTools_HSequenceOfShape m_ErrCompSolidList;    /**< The output compound solid */
+    Handle_TopTools_HSequenceOfShape m_SymbSolidList;       /**< The solids decomposed by sign vectors */
+    TCollection_AsciiString m_strSymbCells;                 /**< Surface cards and cells of the symbolic solids */
+
+    Standard_Integer m_iOutMark;                            /**< Output solids written in checkpoints */
+    Standard_Integer m_iErrMark;                            /**< Error solids written in checkpoints */
+    Standard_Integer m_iSymbMark;                           /**< Symbolic solids written in checkpoints */
+    Standard_Integer m_iCellMark;                           /**< Length of cells written in checkpoints */
 
 private:
     Handle_TopTools_HSequenceOfShape CombineSolids();       /**< Combine the solid into a independent solid */
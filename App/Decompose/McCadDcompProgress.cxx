@@ -0,0 +1,219 @@
+#include "McCadDcompProgress.hxx"
+
+#include <QMutexLocker>
+#include <TopExp_Explorer.hxx>
+
+QMutex McCadDcompProgress::m_Mutex;
+Standard_Integer McCadDcompProgress::m_iSolidNum = 0;
+Standard_Integer McCadDcompProgress::m_iFinished = 0;
+Standard_Integer McCadDcompProgress::m_iLevel = 0;
+Standard_Integer McCadDcompProgress::m_iPieceNum = 0;
+Standard_Boolean McCadDcompProgress::m_bCancel = Standard_False;
+Standard_Boolean McCadDcompProgress::m_bRunning = Standard_False;
+vector<TopoDS_Shape> McCadDcompProgress::m_PieceList;
+
+McCadDcompProgress::McCadDcompProgress()
+{
+}
+
+
+
+/** ***************************************************************************
+* @brief  Clear the status and the cancellation before a new run, it is called
+*         before the thread starts, so an early cancellation is not lost.
+* @param
+* @return void
+*
+* @date 19/10/2026
+* @author  agent
+******************************************************************************/
+void McCadDcompProgress::Reset()
+{
+    QMutexLocker locker(&m_Mutex);
+    m_iSolidNum = 0;
+    m_iFinished = 0;
+    m_iLevel = 0;
+    m_iPieceNum = 0;
+    m_bCancel = Standard_False;
+    m_PieceList.clear();
+}
+
+
+
+/** ***************************************************************************
+* @brief  Start a run of decomposition or conversion. The progress, the surface
+*         registry and the settings are static, the run is refused when
+*         another one is active, otherwise the status is cleared.
+* @param
+* @return Standard_Boolean   The run can start or not
+*
+* @date 19/10/2026
+* @author  agent
+******************************************************************************/
+Standard_Boolean McCadDcompProgress::Acquire()
+{
+    {
+        QMutexLocker locker(&m_Mutex);
+        if(m_bRunning)
+        {
+            return Standard_False;
+        }
+        m_bRunning = Standard_True;
+    }
+
+    Reset();
+    return Standard_True;
+}
+
+
+
+/** ***************************************************************************
+* @brief  The run is finished, another decomposition or conversion can start
+* @param
+* @return void
+*
+* @date 19/10/2026
+* @author  agent
+******************************************************************************/
+void McCadDcompProgress::Release()
+{
+    QMutexLocker locker(&m_Mutex);
+    m_bRunning = Standard_False;
+}
+
+
+
+/** ***************************************************************************
+* @brief  Start the decomposition of the input solids
+* @param  Standard_Integer iSolidNum     Number of input solids
+*         Standard_Integer iFinished     Solids finished in the checkpoints
+* @return void
+*
+* @date 19/10/2026
+* @author  agent
+******************************************************************************/
+void McCadDcompProgress::Start(Standard_Integer iSolidNum, Standard_Integer iFinished)
+{
+    QMutexLocker locker(&m_Mutex);
+    m_iSolidNum = iSolidNum;
+    m_iFinished = iFinished;
+    m_iLevel = 0;
+    m_iPieceNum = 0;
+}
+
+
+
+/** ***************************************************************************
+* @brief  Record the level of the solid being decomposed
+* @param  Standard_Integer iLevel
+* @return void
+*
+* @date 19/10/2026
+* @author  agent
+******************************************************************************/
+void McCadDcompProgress::SetLevel(Standard_Integer iLevel)
+{
+    QMutexLocker locker(&m_Mutex);
+    m_iLevel = iLevel;
+}
+
+
+
+/** ***************************************************************************
+* @brief  The input solid is finished, its decomposed solids wait for the gui
+* @param  TopoDS_Shape & thePieces   Compound of decomposed solids, it is null
+*                                    if the solid gives no decomposed solids
+* @return void
+*
+* @date 19/10/2026
+* @author  agent
+******************************************************************************/
+void McCadDcompProgress::FinishSolid(const TopoDS_Shape & thePieces)
+{
+    QMutexLocker locker(&m_Mutex);
+    m_iFinished++;
+    m_iLevel = 0;
+
+    if(thePieces.IsNull())
+    {
+        return;
+    }
+
+    for(TopExp_Explorer ex(thePieces,TopAbs_SOLID); ex.More(); ex.Next())
+    {
+        m_iPieceNum++;
+    }
+    m_PieceList.push_back(thePieces);
+}
+
+
+
+/** ***************************************************************************
+* @brief  Cancel the decomposition, it stops in the next splitting
+* @param
+* @return void
+*
+* @date 19/10/2026
+* @author  agent
+******************************************************************************/
+void McCadDcompProgress::Cancel()
+{
+    QMutexLocker locker(&m_Mutex);
+    m_bCancel = Standard_True;
+}
+
+
+
+/** ***************************************************************************
+* @brief  The decomposition is cancelled or not
+* @param
+* @return Standard_Boolean
+*
+* @date 19/10/2026
+* @author  agent
+******************************************************************************/
+Standard_Boolean McCadDcompProgress::IsCancelled()
+{
+    QMutexLocker locker(&m_Mutex);
+    return m_bCancel;
+}
+
+
+
+/** ***************************************************************************
+* @brief  Get the status of decomposition
+* @param  Standard_Integer & iSolidNum   Number of input solids
+*         Standard_Integer & iFinished   Number of finished solids
+*         Standard_Integer & iLevel      Level of current solid
+*         Standard_Integer & iPieceNum   Number of decomposed solids
+* @return void
+*
+* @date 19/10/2026
+* @author  agent
+******************************************************************************/
+void McCadDcompProgress::GetStatus(Standard_Integer & iSolidNum, Standard_Integer & iFinished,
+                                   Standard_Integer & iLevel, Standard_Integer & iPieceNum)
+{
+    QMutexLocker locker(&m_Mutex);
+    iSolidNum = m_iSolidNum;
+    iFinished = m_iFinished;
+    iLevel = m_iLevel;
+    iPieceNum = m_iPieceNum;
+}
+
+
+
+/** ***************************************************************************
+* @brief  Take the decomposed solids which are added since last call
+* @param  vector<TopoDS_Shape> & piece_list
+* @return void
+*
+* @date 19/10/2026
+* @author  agent
+******************************************************************************/
+void McCadDcompProgress::TakePieces(vector<TopoDS_Shape> & piece_list)
+{
+    QMutexLocker locker(&m_Mutex);
+    piece_list.insert(piece_list.end(), m_PieceList.begin(), m_PieceList.end());
+    m_PieceList.clear();
+}
@@ -0,0 +1,74 @@
+#ifndef MCCADDCOMPPROGRESS_HXX
+#define MCCADDCOMPPROGRESS_HXX
+
+#include <vector>
+#include <QMutex>
+#include <Standard.hxx>
+#include <TopoDS_Shape.hxx>
+
+using namespace std;
+
+/** The progress of the decomposition running in a background thread. The
+    decomposition reports the finished solids, the current level and the
+    decomposed solids, the gui thread reads the status with a timer and takes
+    the new decomposed solids into the document. The decomposition stops in the
+    next splitting when it is cancelled, the unfinished input solid is dropped.
+    The status and the settings are shared, only one decomposition or
+    conversion runs at a time. */
+class McCadDcompProgress
+{
+public:
+
+    void* operator new(size_t,void* anAddress)
+    {
+        return anAddress;
+    }
+    void* operator new(size_t size)
+    {
+        return Standard::Allocate(size);
+    }
+    void  operator delete(void *anAddress)
+    {
+        if (anAddress) Standard::Free((Standard_Address&)anAddress);
+    }
+
+    McCadDcompProgress();
+
+private:
+
+    static QMutex m_Mutex;                          /**< Lock of the status between the threads */
+    static Standard_Integer m_iSolidNum;            /**< Number of input solids */
+    static Standard_Integer m_iFinished;            /**< Number of finished input solids */
+    static Standard_Integer m_iLevel;               /**< Decomposition level of current solid */
+    static Standard_Integer m_iPieceNum;            /**< Number of decomposed solids */
+    static Standard_Boolean m_bCancel;              /**< The decomposition is cancelled */
+    static Standard_Boolean m_bRunning;             /**< A decomposition or conversion is running */
+    static vector<TopoDS_Shape> m_PieceList;        /**< Decomposed solids not taken by the gui */
+
+public:
+
+    /**< Clear the status and the cancellation before a new run */
+    static void Reset();
+    /**< Start a run and clear the status, false if another run is active */
+    static Standard_Boolean Acquire();
+    /**< The run is finished, another run can start */
+    static void Release();
+    /**< Start the decomposition of the solids, some are finished in checkpoints */
+    static void Start(Standard_Integer iSolidNum, Standard_Integer iFinished);
+    /**< The level of the solid being decomposed */
+    static void SetLevel(Standard_Integer iLevel);
+    /**< The input solid is finished, add its decomposed solids */
+    static void FinishSolid(const TopoDS_Shape & thePieces);
+    /**< Cancel the decomposition */
+    static void Cancel();
+    /**< The decomposition is cancelled or not */
+    static Standard_Boolean IsCancelled();
+
+    /**< Get the status of decomposition */
+    static void GetStatus(Standard_Integer & iSolidNum, Standard_Integer & iFinished,
+                          Standard_Integer & iLevel, Standard_Integer & iPieceNum);
+    /**< Take the decomposed solids added since last call */
+    static void TakePieces(vector<TopoDS_Shape> & piece_list);
+};
+
+#endif // MCCADDCOMPPROGRESS_HXX
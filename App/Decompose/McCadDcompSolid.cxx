@@ -11,6 +11,7 @@
 #include "McCadDcompSolid.hxx"
 
 #include <assert.h>
+#include <Standard_Version.hxx>
 
 #include <BRepTools.hxx>
 #include <BRep_Tool.hxx>
@@ -25,6 +26,7 @@
 #include <BRepBuilderAPI_MakeEdge.hxx>
 #include <BRepGProp.hxx>
 #include <BRepBuilderAPI_Sewing.hxx>
+#include <BRepBuilderAPI_Copy.hxx>
 
 #include <ShapeAnalysis_CheckSmallFace.hxx>
 #include <STEPControl_Writer.hxx>
@@ -45,16 +47,21 @@
 #include <GProp_GProps.hxx>
 #include <GeomAdaptor_Curve.hxx>
 
-#include "../McCadTool/McCadFuseSurface.hxx"
-#include "../McCadTool/McCadMathTool.hxx"
-#include "../McCadTool/McCadBooleanOpt.hxx"
-#include "../McCadTool/McCadGeomTool.hxx"
+#include "../Tools/McCadFuseSurface.hxx"
+#include "../Tools/McCadMathTool.hxx"
+#include "../Tools/McCadBooleanOpt.hxx"
+#include "../Tools/McCadGeomTool.hxx"
+#include "../Tools/McCadConvertConfig.hxx"
 
 #include "McCadBndSurfCylinder.hxx"
 #include "McCadBndSurfPlane.hxx"
 #include "McCadAstSurfPlane.hxx"
-#include "McCadSplitCylinders.hxx"
-#include "McCadSplitCylnPln.hxx"
+#include "McCadAstSurfGenRegistry.hxx"
+#include "McCadSplitCostModel.hxx"
+#include "McCadPlanarBSP.hxx"
+#include "McCadSurfRegistry.hxx"
+#include "McCadSignVectorDcomp.hxx"
+#include "McCadDcompProgress.hxx"
 #include "McCadBndSurfCone.hxx"
 
 #include "McCadEdgeLine.hxx"
@@ -72,6 +79,8 @@ McCadDcompSolid::McCadDcompSolid(const TopoDS_Solid &theSolid):TopoDS_Solid(theS
 {
     m_Solid = theSolid;
     m_HasSplitSurf = Standard_False;                  // Has splitting surface or not
+    m_bFastConvex = Standard_False;                   // Found convex without meshing or not
+    m_bPocketCell = Standard_False;                   // Kept as convex hull minus pockets or not
 
     m_pSelSplitSurf = new McCadSelSplitSurf();
 
@@ -139,15 +148,73 @@ void McCadDcompSolid::Free()
 * @return Void
 *
 * @date 13/07/2015
-* @modify 13/07/2015
+* @modify 19/10/2026
 * @author  Lei Lu
 ******************************************************************************/
 Standard_Boolean McCadDcompSolid::Decompose(vector<McCadDcompSolid *> *& pDcompSolidList,
                                             vector<McCadDcompSolid *> *& pErrorSolidList,
                                             Standard_Integer & iLevel, int iSolid)
 {
+    /// Stop splitting when it is cancelled, the caller drops the unfinished solid
+    if(McCadDcompProgress::IsCancelled())
+    {
+        McCadDcompSolid *pSolid = this;
+        pErrorSolidList->push_back(pSolid);
+        return Standard_False;
+    }
+
     iLevel++;
     Standard_Integer iRecLevel = iLevel;
+    McCadDcompProgress::SetLevel(iLevel);
+
+    /// The convex solid need not be meshed and judged, output it directly
+    if(IsConvexSolid())
+    {
+        m_bFastConvex = Standard_True;
+        cout<<"Level  "<<iLevel<<" - "<<iSolid<<" solid is convex solid (fast check)"<<endl;
+        RepairLeaf();
+        McCadDcompSolid *pSolid = this;
+        pDcompSolidList->push_back(pSolid);
+        return Standard_False;
+    }
+
+    /// The solid with only convex pockets is one cell, the pockets are the complement terms
+    if(McCadConvertConfig::HullMinusPockets() && IsHullMinusPockets())
+    {
+        m_bPocketCell = Standard_True;
+        cout<<"Level  "<<iLevel<<" - "<<iSolid<<" solid is convex hull minus pockets"<<endl;
+        RepairLeaf();
+        McCadDcompSolid *pSolid = this;
+        pDcompSolidList->push_back(pSolid);
+        return Standard_False;
+    }
+
+    /// The solid bounded only by planes is decomposed by BSP tree without boolean operations
+    if(McCadConvertConfig::UsePlanarBSP() && McCadPlanarBSP::IsPlanarSolid(m_Solid))
+    {
+        McCadPlanarBSP *pBSP = new McCadPlanarBSP(m_Solid);
+        Handle_TopTools_HSequenceOfShape solid_list = new TopTools_HSequenceOfShape();
+        Standard_Boolean bDone = pBSP->Perform();
+        if(bDone)
+        {
+            pBSP->GetResultSolids(solid_list);
+        }
+        delete pBSP;
+        pBSP = NULL;
+
+        if(bDone)
+        {
+            cout<<"Level  "<<iLevel<<" - "<<iSolid<<" planar solid is decomposed into "
+                <<solid_list->Length()<<" solids by BSP"<<endl;
+            for(int i = 1; i <= solid_list->Length(); i++ )
+            {
+                McCadDcompSolid *pSolid = new McCadDcompSolid(TopoDS::Solid(solid_list->Value(i)));
+                pSolid->SetDeflection(m_fDeflection);
+                pDcompSolidList->push_back(pSolid);
+            }
+            return Standard_True;
+        }
+    }
 
     GenSurfaceList();                   /// Generate the boundary surface list
     JudgeDecomposeSurface();            /// Judge which surfaces are decompose surfaces
@@ -181,16 +248,32 @@ Standard_Boolean McCadDcompSolid::Decompose(vector<McCadDcompSolid *> *& pDcompS
     /// If the solid has splitting surfaces, then perform decomposition
     if (m_HasSplitSurf)
     {
-        McCadSurface* pSplitSurf = SelectSplitSurface(iSelSurf);
-        assert(pSplitSurf);
+        Handle_TopTools_HSequenceOfShape solid_list = new TopTools_HSequenceOfShape();
+        Standard_Boolean bSplit = Standard_False;
 
-        if(NULL == pSplitSurf)
+        /// Try several candidates in parallel and keep the cheapest split
+        if (McCadConvertConfig::GetSplitSpeculateNum() > 1)
         {
-            return Standard_False;
+            bSplit = SpeculateSplitSolid(solid_list);
         }
+        else
+        {
+            McCadSurface* pSplitSurf = SelectSplitSurface(iSelSurf);
+            assert(pSplitSurf);
 
-        Handle_TopTools_HSequenceOfShape solid_list = new TopTools_HSequenceOfShape();
-        if (!SplitSolid(pSplitSurf,solid_list))
+            if(NULL == pSplitSurf)
+            {
+                return Standard_False;
+            }
+
+            bSplit = SplitSolid(pSplitSurf,solid_list);
+            if(bSplit)
+            {
+                McCadSurfRegistry::AddSplitSurface(*pSplitSurf);
+            }
+        }
+
+        if (!bSplit)
         {
             //pSolidList->push_back(this);
             McCadDcompSolid *pErrSolid = this;
@@ -223,6 +306,7 @@ Standard_Boolean McCadDcompSolid::Decompose(vector<McCadDcompSolid *> *& pDcompS
     else
     {
         cout<<"Level  "<<iLevel<<" - "<<iSolid<<" solid is convex solid"<<endl;
+        RepairLeaf();
         McCadDcompSolid *pSolid = this;
         pDcompSolidList->push_back(pSolid);
         return Standard_False;
@@ -234,6 +318,246 @@ Standard_Boolean McCadDcompSolid::Decompose(vector<McCadDcompSolid *> *& pDcompS
 
 
 
+/** ***************************************************************************
+* @brief  Check the solid is convex before meshing. The solid is convex if it
+*         has one shell, the faces have no internal loops, the curved faces
+*         are convex and none of the edges is concave. The seam edges of the
+*         periodic surfaces are skipped.
+* @param
+* @return Standard_Boolean
+*
+* @date 19/10/2026
+* @author  agent
+******************************************************************************/
+Standard_Boolean McCadDcompSolid::IsConvexSolid()
+{
+    Standard_Integer iShell = 0;
+    for (TopExp_Explorer exS(m_Solid,TopAbs_SHELL); exS.More(); exS.Next())
+    {
+        iShell++;
+    }
+    if (iShell != 1)
+    {
+        return Standard_False;
+    }
+
+    for (TopExp_Explorer exF(m_Solid,TopAbs_FACE); exF.More(); exF.Next())
+    {
+        TopoDS_Face face = TopoDS::Face(exF.Current());
+
+        BRepAdaptor_Surface BS(face, Standard_True);
+        GeomAbs_SurfaceType surfType = BS.GetType();
+
+        /// The concave curved surfaces need to be split
+        if (surfType == GeomAbs_Cylinder || surfType == GeomAbs_Cone || surfType == GeomAbs_Sphere)
+        {
+            if (face.Orientation() != TopAbs_FORWARD)
+            {
+                return Standard_False;
+            }
+        }
+        else if (surfType != GeomAbs_Plane)
+        {
+            return Standard_False;
+        }
+
+        /// The face of convex solid has only outer wire
+        Standard_Integer iWire = 0;
+        for (TopExp_Explorer exW(face,TopAbs_WIRE); exW.More(); exW.Next())
+        {
+            iWire++;
+        }
+        if (iWire > 1)
+        {
+            return Standard_False;
+        }
+    }
+
+    TopTools_IndexedDataMapOfShapeListOfShape mapEdgeFace;
+    TopExp::MapShapesAndAncestors(m_Solid,TopAbs_EDGE,TopAbs_FACE,mapEdgeFace);
+
+    for (int iKey = 1; iKey <= mapEdgeFace.Extent(); iKey++)
+    {
+        TopoDS_Edge edge = TopoDS::Edge(mapEdgeFace.FindKey(iKey));
+        if (BRep_Tool::Degenerated(edge))
+        {
+            continue;
+        }
+
+        const TopTools_ListOfShape &listFace = mapEdgeFace.FindFromIndex(iKey);
+        TopTools_ListIteratorOfListOfShape iterFace(listFace);
+        if (listFace.Extent() < 1)
+        {
+            return Standard_False;
+        }
+
+        TopoDS_Face FaceA = TopoDS::Face(iterFace.Value());
+        if (BRep_Tool::IsClosed(edge,FaceA))
+        {
+            continue;   // Seam edge of the periodic surface
+        }
+        if (listFace.Extent() != 2)
+        {
+            return Standard_False;
+        }
+
+        iterFace.Next();
+        TopoDS_Face FaceB = TopoDS::Face(iterFace.Value());
+        if (IsConcaveEdge(edge,FaceA,FaceB))
+        {
+            return Standard_False;
+        }
+    }
+
+    return Standard_True;
+}
+
+
+
+/** ***************************************************************************
+* @brief  The solid was found convex by the fast check
+* @param
+* @return Standard_Boolean
+*
+* @date 19/10/2026
+* @author  agent
+******************************************************************************/
+Standard_Boolean McCadDcompSolid::IsFastConvex() const
+{
+    return m_bFastConvex;
+}
+
+
+
+/** ***************************************************************************
+* @brief  The solid was kept as its convex hull minus convex pockets
+* @param
+* @return Standard_Boolean
+*
+* @date 19/10/2026
+* @author  agent
+******************************************************************************/
+Standard_Boolean McCadDcompSolid::IsPocketCell() const
+{
+    return m_bPocketCell;
+}
+
+
+
+/** ***************************************************************************
+* @brief  Take the attributes of the two solids merged into this solid. The
+*         finer deflection is used for meshing, the solid is fast convex if
+*         both solids were, and it is a pocket cell if either solid was.
+* @param  const McCadDcompSolid &theSolidA, const McCadDcompSolid &theSolidB
+* @return void
+*
+* @date 19/10/2026
+* @author  agent
+******************************************************************************/
+void McCadDcompSolid::InheritFrom(const McCadDcompSolid &theSolidA,
+                                  const McCadDcompSolid &theSolidB)
+{
+    m_fDeflection = Min(theSolidA.m_fDeflection, theSolidB.m_fDeflection);
+    m_bFastConvex = theSolidA.m_bFastConvex && theSolidB.m_bFastConvex;
+    m_bPocketCell = theSolidA.m_bPocketCell || theSolidB.m_bPocketCell;
+}
+
+
+
+/** ***************************************************************************
+* @brief  A plate with drilled holes is the convex hull bounded by the forward
+*         faces minus the pockets inside the reversed cylinders, cones and
+*         spheres. The complement of each pocket is the outer half-space of
+*         its surface, so the solid is one cell if it is the intersection of
+*         the half-spaces of all its faces. The pocket faces must be closed
+*         around the axis, the partial faces need assisted surfaces of the
+*         convertor which are built for convex solids only. The sign vectors
+*         of sample points check that the solid is exactly one such cell.
+* @param
+* @return Standard_Boolean
+*
+* @date 19/10/2026
+* @author  agent
+******************************************************************************/
+Standard_Boolean McCadDcompSolid::IsHullMinusPockets()
+{
+    Standard_Integer iShell = 0;
+    for (TopExp_Explorer exS(m_Solid,TopAbs_SHELL); exS.More(); exS.Next())
+    {
+        iShell++;
+    }
+    if (iShell != 1 || !McCadSignVectorDcomp::IsAnalyticSolid(m_Solid))
+    {
+        return Standard_False;
+    }
+
+    Standard_Integer iPocketFace = 0;
+    for (TopExp_Explorer exF(m_Solid,TopAbs_FACE); exF.More(); exF.Next())
+    {
+        TopoDS_Face face = TopoDS::Face(exF.Current());
+        BRepAdaptor_Surface BS(face, Standard_True);
+        if (BS.GetType() == GeomAbs_Plane || face.Orientation() == TopAbs_FORWARD)
+        {
+            continue;
+        }
+
+        /// The sphere pocket is closed, the cylinder and cone need a seam edge
+        if (BS.GetType() != GeomAbs_Sphere)
+        {
+            Standard_Boolean bClosed = Standard_False;
+            for (TopExp_Explorer exE(face,TopAbs_EDGE); exE.More(); exE.Next())
+            {
+                if (BRep_Tool::IsClosed(TopoDS::Edge(exE.Current()),face))
+                {
+                    bClosed = Standard_True;
+                    break;
+                }
+            }
+            if (!bClosed)
+            {
+                return Standard_False;
+            }
+        }
+        iPocketFace++;
+    }
+
+    if (iPocketFace == 0)
+    {
+        return Standard_False;
+    }
+
+    McCadSignVectorDcomp *pSignVector = new McCadSignVectorDcomp(m_Solid);
+    Standard_Boolean bOneCell = pSignVector->GenSignVectors() && pSignVector->IsSingleCell();
+    delete pSignVector;
+    pSignVector = NULL;
+
+    return bOneCell;
+}
+
+
+
+/** ***************************************************************************
+* @brief  The split solids are only checked on the faces created by splitting,
+*         the full check and repair are done when the solid is a final convex
+*         solid.
+* @param
+* @return void
+*
+* @date 19/10/2026
+* @author  agent
+******************************************************************************/
+void McCadDcompSolid::RepairLeaf()
+{
+    TopoDS_Solid theSolid = m_Solid;
+    if(McCadBooleanOpt::RepairSolid(theSolid))
+    {
+        m_Solid = theSolid;
+        TopoDS_Solid::operator=(theSolid);
+    }
+}
+
+
+
 /** ***************************************************************************
 * @brief  Generate the surface list of solid and categorize the surfaces
 *         according to the different surfaces types.
@@ -577,23 +901,9 @@ void McCadDcompSolid::GenAssistSurfaces()
 {
     McCadDcompSolid *pSolid = this;
 
-    ///< Find the assistant surface for seprating connected cylinders
-    if(m_CylinderList.size() >= 2 )
-    {
-        McCadSplitCylinders * split_cylinders = new McCadSplitCylinders();
-        split_cylinders->GenSplitSurfaces(pSolid);
-        delete split_cylinders;
-        split_cylinders = NULL;
-    }
-
-    ///< Find the assistant surface for seprating the connected cylinder and plane
-    if(!m_CylinderList.empty() && !m_PlaneList.empty())
-    {
-        McCadSplitCylnPln *split_CylnPln = new McCadSplitCylnPln();
-        split_CylnPln->GenSplitSurfaces(pSolid);
-        delete split_CylnPln;
-        split_CylnPln = NULL;
-    }
+    ///< The registered generators run at the same time, the created surfaces
+    ///< are merged into the assisted surface list in the order of registration
+    McCadAstSurfGenRegistry::GenAssistSurfaces(pSolid,m_AstFaceList);
 
 //    if(!m_AstFaceList.empty())
 //    {
@@ -768,24 +1078,116 @@ McCadSurface * McCadDcompSolid::SelectSplitSurface(Standard_Integer iSel)
     ///< Select the splitting surfaces to generate the selected splitting surfaces list
     m_pSelSplitSurf->GenSplitSurfList(m_SplitFaceList,m_SelSplitFaceList);
 
+    ///< Rank the splitting surfaces with the cost model fitted on recorded runs
+    McCadSplitCostModel::RankSurfaces(m_SelSplitFaceList);
+
     if (!m_SelSplitFaceList.empty())
     {
         pSelectSurf = m_SelSplitFaceList.at(0);
+        //cout<<"Through  "<<pSelectSurf->GetThroughConcaveEdges()<<"  "<<pSelectSurf->GetSplitSurfNum()<<endl;
+    }
 
+    assert(pSelectSurf);
+    return pSelectSurf;
+}
 
-                STEPControl_Writer wrt;
-                wrt.Transfer(*pSelectSurf, STEPControl_AsIs);
-                wrt.Write("torus.stp");
 
 
 
+/** ***************************************************************************
+* @brief  Split the solid with the first candidates of the sorted splitting
+*         surfaces at the same time. The remaining work of each split is
+*         estimated by the cost model, the cheapest valid split is kept and
+*         the candidates are recorded for fitting the cost model.
+* @param  Handle_TopTools_HSequenceOfShape &solid_list ( The split solids )
+* @return Standard_Boolean
+*
+* @date 19/10/2026
+* @author  agent
+******************************************************************************/
+Standard_Boolean McCadDcompSolid::SpeculateSplitSolid(Handle_TopTools_HSequenceOfShape &solid_list)
+{
+    m_pSelSplitSurf->MergeSplitSurfaces(m_SplitFaceList);
+    m_pSelSplitSurf->GenSplitSurfList(m_SplitFaceList,m_SelSplitFaceList);
 
+    if (m_SelSplitFaceList.empty())
+    {
+        return Standard_False;
+    }
 
-        //cout<<"Through  "<<pSelectSurf->GetThroughConcaveEdges()<<"  "<<pSelectSurf->GetSplitSurfNum()<<endl;
+    int iNbCand = McCadConvertConfig::GetSplitSpeculateNum();
+    if (iNbCand > (int)m_SelSplitFaceList.size())
+    {
+        iNbCand = m_SelSplitFaceList.size();
     }
 
-    assert(pSelectSurf);
-    return pSelectSurf;
+    /// Each candidate is split on its own copy of the solid, the boolean
+    /// operations of the threads do not modify the shared topology of m_Solid.
+    /// The copies are made before the parallel loop, the copy reads m_Solid.
+    vector<Handle_TopTools_HSequenceOfShape> cand_lists;
+    vector<TopoDS_Solid> copy_list;
+    vector<Standard_Real> cost_list(iNbCand,McCadSplitCostModel::InvalidCost());
+    for(int i = 0; i < iNbCand; i++)
+    {
+        cand_lists.push_back(new TopTools_HSequenceOfShape());
+        BRepBuilderAPI_Copy copier(m_Solid);
+        copy_list.push_back(TopoDS::Solid(copier.Shape()));
+    }
+
+    /// The boolean operations of OCC before 7.2 are not safe to run at the
+    /// same time even on different shapes, the candidates are split in turn.
+#if OCC_VERSION_HEX >= 0x070200
+    const bool bParallel = true;
+#else
+    const bool bParallel = false;
+#endif
+
+    #pragma omp parallel for schedule(dynamic,1) if(bParallel)
+    for(int i = 0; i < iNbCand; i++)
+    {
+        McCadSurface *pSurf = m_SelSplitFaceList.at(i);
+        Standard_Boolean bValid = Standard_False;
+        try
+        {
+            bValid = SplitSolid(copy_list.at(i),pSurf,cand_lists.at(i));
+        }
+        catch(...)
+        {
+            bValid = Standard_False;
+        }
+        cost_list.at(i) = McCadSplitCostModel::ScoreSplit(cand_lists.at(i),bValid);
+    }
+
+    /// The first candidate wins the ties, it is the choice of the heuristic sorting
+    int iBest = -1;
+    for(int i = 0; i < iNbCand; i++)
+    {
+        if (cost_list.at(i) >= McCadSplitCostModel::InvalidCost())
+        {
+            continue;
+        }
+
+        McCadSurface *pSurf = m_SelSplitFaceList.at(i);
+        McCadSplitCostModel::Record(pSurf,cost_list.at(i));
+
+        if (iBest < 0 || cost_list.at(i) < cost_list.at(iBest))
+        {
+            iBest = i;
+        }
+    }
+
+    if (iBest < 0)
+    {
+        return Standard_False;
+    }
+
+    solid_list->Append(cand_lists.at(iBest));
+    McCadSurfRegistry::AddSplitSurface(*m_SelSplitFaceList.at(iBest));
+    if (iBest > 0)
+    {
+        cout<<"# The "<<iBest+1<<" candidate of "<<iNbCand<<" splitting surfaces is selected"<<endl;
+    }
+    return Standard_True;
 }
 
 
@@ -846,50 +1248,60 @@ void McCadDcompSolid::CalEdgeConvexity()
         iterFace.Next();
         TopoDS_Face FaceB = TopoDS::Face(iterFace.Value());
 
-        /// Get the first vertex of edge
-//        TopoDS_Vertex vtxStart = TopExp::FirstVertex(edge,0);
-//        gp_Pnt pntStart = BRep_Tool::Pnt(vtxStart);
-//        TopoDS_Vertex vtxEnd = TopExp::LastVertex(edge,0);
-//        gp_Pnt pntEnd = BRep_Tool::Pnt(vtxEnd);
+        /** The edge is concave */
+        if(IsConcaveEdge(edge,FaceA,FaceB))
+        {
+            edge.Convex(1);
+        }
+    }
+}
 
-        Standard_Real fStart, fEnd;
-        Handle(Geom_Curve) theCurve = BRep_Tool::Curve(edge, fStart, fEnd);
 
-        gp_Pnt pntStart;
-        gp_Vec vec;
-        theCurve->D0(fStart,pntStart);
-        theCurve->D1(fStart,pntStart,vec);
-        gp_Dir dir(vec);
 
-        /// Get the normals of each surface
-        gp_Dir normalA = McCadGeomTool::NormalOnFace(FaceA,pntStart);
-        gp_Dir normalB = McCadGeomTool::NormalOnFace(FaceB,pntStart);
+/** ***************************************************************************
+* @brief Judge the edge shared by two faces is concave or not
+* @param TopoDS_Edge &theEdge
+*        TopoDS_Face &theFaceA
+*        TopoDS_Face &theFaceB
+* @return Standard_Boolean
+*
+* @date 06/06/2016
+* @modify 19/10/2026
+* @author  Lei Lu
+******************************************************************************/
+Standard_Boolean McCadDcompSolid::IsConcaveEdge(const TopoDS_Edge &theEdge,
+                                                const TopoDS_Face &theFaceA,
+                                                const TopoDS_Face &theFaceB)
+{
+    Standard_Real fStart, fEnd;
+    Handle(Geom_Curve) theCurve = BRep_Tool::Curve(theEdge, fStart, fEnd);
 
-        BRepAdaptor_Curve baCrv;
-        baCrv.Initialize(edge);
+    gp_Pnt pntStart;
+    gp_Vec vec;
+    theCurve->D0(fStart,pntStart);
+    theCurve->D1(fStart,pntStart,vec);
+    gp_Dir dir(vec);
 
-       // Standard_Real fStartB, fEndB;
-       // Handle(Geom_Curve) theCurve = BRep_Tool::Curve(edge, fStartB, fEndB);
+    /// Get the normals of each surface
+    gp_Dir normalA = McCadGeomTool::NormalOnFace(theFaceA,pntStart);
+    gp_Dir normalB = McCadGeomTool::NormalOnFace(theFaceB,pntStart);
 
-        Standard_Real angle = normalA.AngleWithRef(normalB,dir);
+    Standard_Real angle = normalA.AngleWithRef(normalB,dir);
 
-        if(Abs(angle) < 1.0e-4 )
-        {
-           angle = 0;
-        }
+    if(Abs(angle) < 1.0e-4 )
+    {
+       angle = 0;
+    }
 
-        /** The edge is concave */
-        if( angle < 0 && edge.Orientation() == TopAbs_REVERSED)
-        {
-            //wrt.Transfer(edge, STEPControl_AsIs);            
-            edge.Convex(1);
-        }
-        else if(edge.Orientation() == TopAbs_FORWARD && angle > 0)
-        {
-            //wrt.Transfer(edge, STEPControl_AsIs);           
-            edge.Convex(1);
-        }
+    if( angle < 0 && theEdge.Orientation() == TopAbs_REVERSED)
+    {
+        return Standard_True;
     }
+    else if(theEdge.Orientation() == TopAbs_FORWARD && angle > 0)
+    {
+        return Standard_True;
+    }
+    return Standard_False;
 }
 
 
@@ -1136,12 +1548,34 @@ Standard_Boolean McCadDcompSolid::CheckBndSurfaces()
 * @return Void
 *
 * @date 13/07/2015
-* @modify 13/07/2015
+* @modify 19/10/2026
 * @author  Lei Lu
 ******************************************************************************/
 Standard_Boolean McCadDcompSolid::SplitSolid(McCadSurface *& pSplitSurf,Handle_TopTools_HSequenceOfShape &solid_list )
 {
-    McCadBooleanOpt *BoolOpt = new McCadBooleanOpt(m_Solid, *pSplitSurf);
+    return SplitSolid(m_Solid,pSplitSurf,solid_list);
+}
+
+
+
+/** ***************************************************************************
+* @brief  Split the given solid with the splitting surface. The speculative
+*         splitting passes a copy of the solid to each thread, the boolean
+*         operation does not share the topology with the other threads.
+* @param  const TopoDS_Solid &theSolid  The solid to be split
+*         McCadSurface *& pSplitSurf  Splitting surface
+*         Handle_TopTools_HSequenceOfShape &solid_list The solid list after splitting
+* @return Standard_Boolean
+*
+* @date 19/10/2026
+* @author  agent
+******************************************************************************/
+Standard_Boolean McCadDcompSolid::SplitSolid(const TopoDS_Solid &theSolid,
+                                             McCadSurface *& pSplitSurf,
+                                             Handle_TopTools_HSequenceOfShape &solid_list)
+{
+    McCadBooleanOpt *BoolOpt = new McCadBooleanOpt(theSolid, *pSplitSurf);
+    BoolOpt->SetLazyRepair(Standard_True);    // The split solids are only checked on new faces
     Standard_Boolean result;
     //McCadBooleanOpt BoolOpt(m_Solid, pSplitSurf->GetTopoFace());
     if (BoolOpt->Perform())
@@ -1153,6 +1587,17 @@ Standard_Boolean McCadDcompSolid::SplitSolid(McCadSurface *& pSplitSurf,Handle_T
         result = Standard_False;
     }
 
+    /// The repair of the solid was deferred, heal it and split again. The
+    /// healed solid is a local copy, the candidates may be split in parallel.
+    TopoDS_Solid theHealedSolid = theSolid;
+    if (!result && McCadBooleanOpt::RepairSolid(theHealedSolid))
+    {
+        delete BoolOpt;
+        BoolOpt = new McCadBooleanOpt(theHealedSolid, *pSplitSurf);
+        BoolOpt->SetLazyRepair(Standard_True);
+        result = BoolOpt->Perform();
+    }
+
     BoolOpt->GetResultSolids(solid_list);
 
     delete BoolOpt;
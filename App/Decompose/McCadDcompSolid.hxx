@@ -2,6 +2,8 @@
 #define MCCADDCOMPSOLID_HXX
 
 #include <TopoDS_Solid.hxx>
+#include <TopoDS_Edge.hxx>
+#include <TopoDS_Face.hxx>
 #include <Handle_TopTools_HSequenceOfShape.hxx>
 #include "McCadSurface.hxx"
 #include "McCadDcompGeomData.hxx"
@@ -44,6 +46,20 @@ public:
     /**< Check the boundry surfacs. if it contains splines and tours */
     Standard_Boolean CheckBndSurfaces();
 
+    /**< The solid was found convex by the fast check and not meshed */
+    Standard_Boolean IsFastConvex() const;
+    /**< Check the solid is convex with its topology and edge convexities only */
+    Standard_Boolean IsConvexSolid();
+    /**< The solid is kept as one cell of its convex hull minus convex pockets */
+    Standard_Boolean IsPocketCell() const;
+    /**< Take the deflection and the flags of the two solids merged into this one */
+    void InheritFrom(const McCadDcompSolid &theSolidA, const McCadDcompSolid &theSolidB);
+
+    /**< The edge shared by two faces is concave or not */
+    static Standard_Boolean IsConcaveEdge(const TopoDS_Edge &theEdge,
+                                          const TopoDS_Face &theFaceA,
+                                          const TopoDS_Face &theFaceB);
+
 private:
 
     /**< Delete the allocated surface lists */
@@ -67,11 +83,21 @@ private:
     /**< Judge the assisted surfaces are splitting surfaces or not */
     void JudgeAssistedDecomposeSurfaces();
 
+    /**< Check and repair the final convex solid */
+    void RepairLeaf();
+    /**< The concavity of solid comes only from the through pockets of quadrics */
+    Standard_Boolean IsHullMinusPockets();
     /**< Generate the surfaces list of solid */
     void GenSurfaceList();
     /**< Load the boolean operation, decompose the solid with splitting surfaces */
     Standard_Boolean SplitSolid(McCadSurface *& pSplitSurf,
                     Handle_TopTools_HSequenceOfShape &solid_list);
+    /**< Split the given copy of the solid, the candidates are split in parallel on own copies */
+    Standard_Boolean SplitSolid(const TopoDS_Solid &theSolid,
+                    McCadSurface *& pSplitSurf,
+                    Handle_TopTools_HSequenceOfShape &solid_list);
+    /**< Split the solid with the best candidates in parallel and keep the cheapest result */
+    Standard_Boolean SpeculateSplitSolid(Handle_TopTools_HSequenceOfShape &solid_list);
     /**< Judge each boundary face through how many concave edges */
     void JudgeThroughConcaveEdges(vector<McCadBndSurface*> & theFaceList);
     /**< Judge each assisted face through how many concave edges */
@@ -96,6 +122,8 @@ private:
     Standard_Real m_fDeflection;                            /**< The deflection for surface meshing */
     McCadSelSplitSurf *m_pSelSplitSurf;                     /**< Select the split surface */
     Standard_Real m_fBoxSqLength;                           /**< The length of squared diagonal of boundary box */
+    Standard_Boolean m_bFastConvex;                         /**< The solid passed the convex check without meshing */
+    Standard_Boolean m_bPocketCell;                         /**< The solid is convex hull minus convex pockets */
 
 
 public:
@@ -106,6 +134,7 @@ public:
     friend class McCadSplitConeCyln;
     friend class McCadSplitConeCone;
     friend class McCadSplitSphereCurveSurf;
+    friend class McCadAstSurfGenRegistry;
 
 };
 
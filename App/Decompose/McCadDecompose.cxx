@@ -1,5 +1,6 @@
 #include "McCadDecompose.hxx"
 #include <assert.h>
+#include <time.h>
 
 #include <TopTools_HSequenceOfShape.hxx>
 #include <TopExp_Explorer.hxx>
@@ -14,15 +15,36 @@
 #include <ShapeFix_Solid.hxx>
 
 #include "McCadRepair.hxx"
+#include "McCadMergeConvexSolid.hxx"
+#include "McCadSurfRegistry.hxx"
+#include "McCadSignVectorDcomp.hxx"
+#include "McCadDcompEstimator.hxx"
+#include "McCadDcompCheckpoint.hxx"
+#include "McCadDcompProgress.hxx"
+#include "McCadAstSurfGenRegistry.hxx"
 
 #include <TopoDS_Compound.hxx>
 #include <BRep_Builder.hxx>
 
-#include "../McCadTool/McCadMathTool.hxx"
+#include "../Tools/McCadMathTool.hxx"
+#include "../Tools/McCadGeneTool.hxx"
+#include "../Tools/McCadConvertConfig.hxx"
 
 McCadDecompose::McCadDecompose()
 {
     m_pGeoData = new McCadDcompGeomData();
+
+    m_iFastConvexNum = 0;
+    m_iMergedCellNum = 0;
+    m_iMergedSurfNum = 0;
+    m_iSymbolicNum = 0;
+    m_iPocketCellNum = 0;
+    m_iSymbSurfNum = 0;
+    m_iSymbCellNum = 0;
+    m_iSymbTimedNum = 0;
+    m_iSplitTimedNum = 0;
+    m_fSymbTime = 0.0;
+    m_fSplitTime = 0.0;
 }
 
 McCadDecompose::~McCadDecompose()
@@ -43,12 +65,53 @@ McCadDecompose::~McCadDecompose()
 ******************************************************************************/
 void  McCadDecompose::Perform()
 {
+    /// Dry run, only the cost of decomposition is estimated
+    if(McCadConvertConfig::EstimateOnly())
+    {
+        Estimate();
+        return;
+    }
+
     Decompose();
     SaveDecomposedSolids(m_fileName);
 }
 
 
 
+/** ***************************************************************************
+* @brief  Perform the decomposition for the conversion in the same run, the
+*         decomposed solids are kept in memory with the meshes of their faces
+*         and the step file of them is not written. The error solids and the
+*         solids decomposed by sign vectors are still saved for checking.
+* @param
+* @return void
+*
+* @date 19/10/2026
+* @author  agent
+******************************************************************************/
+void McCadDecompose::PerformInMemory()
+{
+    Decompose();
+    m_pGeoData->SaveErrorSolids(m_fileName);
+}
+
+
+
+/** ***************************************************************************
+* @brief  Get the decomposed solids, one compound for each input solid
+* @param
+* @return Handle_TopTools_HSequenceOfShape
+*
+* @date 19/10/2026
+* @author  agent
+******************************************************************************/
+Handle_TopTools_HSequenceOfShape McCadDecompose::GetDecomposedSolids() const
+{
+    return m_pGeoData->GetDecompSolidList();
+}
+
+
+
 /** ***************************************************************************
 * @brief  Load the models, if the model is compound solid, separate it firstly
 * @param  Handle_TopTools_HSequenceOfShape & solid_list
@@ -83,7 +146,7 @@ void McCadDecompose::InputData(Handle_TopTools_HSequenceOfShape & solid_list,
 * @return Void
 *
 * @date 13/05/2015
-* @modify 13/10/2015
+* @modify 19/10/2026
 * @author  Lei Lu
 ******************************************************************************/
 void McCadDecompose::Decompose()
@@ -95,61 +158,340 @@ void McCadDecompose::Decompose()
     cout<<"*******************************************************************"<<endl;
     cout<<endl;
 
-    Standard_Integer iSolidNum = 0 ;
+    m_iFastConvexNum = 0;
+    m_iMergedCellNum = 0;
+    m_iMergedSurfNum = 0;
+    m_iSymbolicNum = 0;
+    m_iPocketCellNum = 0;
+    m_iSymbSurfNum = 0;
+    m_iSymbCellNum = 0;
+    m_iSymbTimedNum = 0;
+    m_iSplitTimedNum = 0;
+    m_fSymbTime = 0.0;
+    m_fSplitTime = 0.0;
 
     Handle_TopTools_HSequenceOfShape InputSolidList = m_pGeoData->GetInputSolidList();    
 
+    /// The assisted surface generators chosen in the configuration
+    McCadAstSurfGenRegistry::LoadConfig();
+
+    /// The boundary surfaces of all the input solids are in the model already
+    McCadSurfRegistry::Clear();
     for(int i = 1; i <= InputSolidList->Length(); i ++)
     {
-        iSolidNum++;
-        cout<<"-- Decomposing the "<<iSolidNum<<" solid"<<endl;
-        Standard_Integer iLevel = 0;
+        McCadSurfRegistry::AddSolid(InputSolidList->Value(i));
+    }
 
-        TopoDS_Shape theShape = InputSolidList->Value(i);
+    /// Continue from the solids finished in the checkpoints of last run
+    McCadDcompCheckpoint *pCheckpoint = new McCadDcompCheckpoint(m_pGeoData);
+    vector<Standard_Integer> count_list;
+    Standard_Integer iFinished = pCheckpoint->Resume(InputSolidList,count_list);
+    if(iFinished > 0)
+    {
+        SetCounts(count_list);
+    }
+    McCadDcompProgress::Start(InputSolidList->Length(),iFinished);
 
-        /** Repair the geometry of solid */
-        TopoDS_Shape newShape = McCadRepair::RemoveSmallFaces(theShape); // Remove the small faces in solid
-        TopoDS_Solid tmpSolid = TopoDS::Solid(newShape);
-        TopoDS_Solid newSolid = McCadRepair::RepairSolid(tmpSolid);      // Repair the solid
+    Handle_TopTools_HSequenceOfShape OutSolidList = m_pGeoData->GetDecompSolidList();
+    for(int i = iFinished + 1; i <= InputSolidList->Length(); i ++)
+    {
+        /// Stop after the finished solids, they are kept in the checkpoint
+        if(McCadDcompProgress::IsCancelled())
+        {
+            cout<<"-- The decomposition is cancelled after "<<i-1<<" solids"<<endl;
+            break;
+        }
 
-        // Set the deflection for solid meshing
-        Standard_Real deflection = CalMeshDeflection(newSolid);
+        Standard_Integer iOutNum = OutSolidList->Length();
+        DecomposeSolid(InputSolidList->Value(i), i);
+
+        /// The solid cancelled in splitting is dropped, it is redone when resuming
+        if(McCadDcompProgress::IsCancelled())
+        {
+            cout<<"-- The decomposition is cancelled after "<<i-1<<" solids"<<endl;
+            break;
+        }
+
+        TopoDS_Shape thePieces;
+        if(OutSolidList->Length() > iOutNum)
+        {
+            thePieces = OutSolidList->Value(OutSolidList->Length());
+        }
+        McCadDcompProgress::FinishSolid(thePieces);
+
+        GetCounts(count_list);
+        pCheckpoint->Finish(i,count_list);
+    }
+
+    GetCounts(count_list);
+    pCheckpoint->Write(count_list);
+    delete pCheckpoint;
+    pCheckpoint = NULL;
+
+    cout<<"-- "<<m_iFastConvexNum<<" convex solids are found by the fast check"<<endl;
+    cout<<"-- "<<m_iSymbolicNum<<" solids are decomposed by sign vectors"<<endl;
+    if(m_iSymbTimedNum > 0 && m_iSplitTimedNum > 0)
+    {
+        /// The time per solid of the two paths, the sign vectors only take
+        /// the analytic solids, so the ratio is a rough speedup
+        Standard_Real fSymbTime = m_fSymbTime/m_iSymbTimedNum;
+        Standard_Real fSplitTime = m_fSplitTime/m_iSplitTimedNum;
+        cout<<"-- Sign vectors take "<<fSymbTime<<" s per solid, splitting takes "
+            <<fSplitTime<<" s per solid";
+        if(fSymbTime > 0.0)
+        {
+            cout<<", the speedup is "<<fSplitTime/fSymbTime;
+        }
+        cout<<endl;
+    }
+    cout<<"-- "<<m_iPocketCellNum<<" solids are kept as convex hull minus pockets"<<endl;
+    cout<<"-- "<<m_iMergedCellNum<<" cells and "<<m_iMergedSurfNum
+        <<" surfaces are removed by merging adjacent convex solids"<<endl;
+    cout<<"-- "<<McCadSurfRegistry::GetReuseNum()<<" of "<<McCadSurfRegistry::GetSplitNum()
+        <<" splitting surfaces reuse the surfaces of model, "
+        <<McCadSurfRegistry::GetReuseNum()<<" surface cards are saved and "
+        <<McCadSurfRegistry::GetSplitNum() - McCadSurfRegistry::GetReuseNum()
+        <<" are added by splitting"<<endl;
+
+    /// The registry belongs to this run, the next run registers its own model
+    McCadSurfRegistry::Clear();
+}
+
+
+
+/** ***************************************************************************
+* @brief  Repair and decompose one input solid, add the decomposed solids and
+*         error solids into the geometry data
+* @param  TopoDS_Shape theShape
+*         Standard_Integer iSolidNum  ( Index of the input solid )
+* @return void
+*
+* @date 19/10/2026
+* @author  agent
+******************************************************************************/
+void McCadDecompose::DecomposeSolid(TopoDS_Shape theShape, Standard_Integer iSolidNum)
+{
+    cout<<"-- Decomposing the "<<iSolidNum<<" solid"<<endl;
+    Standard_Integer iLevel = 0;
+
+    /** Repair the geometry of solid */
+    TopoDS_Shape newShape = McCadRepair::RemoveSmallFaces(theShape); // Remove the small faces in solid
+    TopoDS_Solid tmpSolid = TopoDS::Solid(newShape);
+    TopoDS_Solid newSolid = McCadRepair::RepairSolid(tmpSolid);      // Repair the solid
+
+    // Set the deflection for solid meshing
+    Standard_Real deflection = CalMeshDeflection(newSolid);
 
 //      TopOpeBRepTool_PurgeInternalEdges fuseEdge(newSolid,true);
 //      fuseEdge.Perform();
 //      TopoDS_Solid solid = TopoDS::Solid(fuseEdge.Shape());
 
-        Handle(ShapeFix_Solid) genericFix = new ShapeFix_Solid;
+    Handle(ShapeFix_Solid) genericFix = new ShapeFix_Solid;
 
-        genericFix->Init(newSolid);
-        genericFix->Perform();
-        TopoDS_Solid theSolid =TopoDS::Solid(genericFix->Solid());
+    genericFix->Init(newSolid);
+    genericFix->Perform();
+    TopoDS_Solid theSolid =TopoDS::Solid(genericFix->Solid());
 
-        //Handle_TopTools_HSequenceOfShape resultSolidList = new TopTools_HSequenceOfShape();
+    //Handle_TopTools_HSequenceOfShape resultSolidList = new TopTools_HSequenceOfShape();
 
-        McCadDcompSolid *pMcCadSolid = new McCadDcompSolid(theSolid);
+    /// Decompose the analytic solid by sign vectors without boolean operations
+    if(McCadConvertConfig::SymbolicDecompose() && McCadSignVectorDcomp::IsAnalyticSolid(theSolid))
+    {
+        clock_t symbStart = clock();
+        McCadSignVectorDcomp *pSymbolic = new McCadSignVectorDcomp(theSolid);
+        Standard_Boolean bDone = pSymbolic->Perform();
+        if(bDone)
+        {
+            cout<<"-- "<<pSymbolic->GetCellNum()<<" cells are generated by sign vectors"<<endl;
+            Handle_TopTools_HSequenceOfShape cell_list = new TopTools_HSequenceOfShape();
+            pSymbolic->GetCellSolids(cell_list);
+            m_pGeoData->AddSymbolicSolid(theSolid, cell_list,
+                                         pSymbolic->GetCellExpressions(iSolidNum,m_iSymbSurfNum,m_iSymbCellNum));
+            m_iSymbSurfNum += pSymbolic->GetSurfNum();
+            m_iSymbCellNum += pSymbolic->GetCellNum();
+            m_iSymbolicNum++;
+            m_iSymbTimedNum++;
+            m_fSymbTime += (double)(clock()-symbStart)/CLOCKS_PER_SEC;
+        }
+        delete pSymbolic;
+        pSymbolic = NULL;
 
-        if(!pMcCadSolid->CheckBndSurfaces())
+        if(bDone)
         {
-           continue;
+            return;
         }
+    }
+
+    McCadDcompSolid *pMcCadSolid = new McCadDcompSolid(theSolid);
 
-        pMcCadSolid->SetDeflection(deflection);                 // Set the deflection
+    if(!pMcCadSolid->CheckBndSurfaces())
+    {
+       return;
+    }
 
-        vector<McCadDcompSolid* > *pOutputSolidList = new vector<McCadDcompSolid*>();// The output solid list */
-        vector<McCadDcompSolid* > *pErrorSolidList  = new vector<McCadDcompSolid*>();// The output solid list */
-        if (pMcCadSolid->Decompose(pOutputSolidList,pErrorSolidList,iLevel,1))        // Decompose solid
+    pMcCadSolid->SetDeflection(deflection);                 // Set the deflection
+
+    /// Measure the decomposition for fitting the cost estimator
+    Standard_Boolean bRecord = !McCadConvertConfig::GetEstimateFile().IsEmpty();
+    McCadDcompEstimator::SolidCost theCost;
+    if(bRecord)
+    {
+        McCadDcompEstimator::GenFeatures(theSolid,theCost);
+    }
+    clock_t start = clock();
+
+    vector<McCadDcompSolid* > *pOutputSolidList = new vector<McCadDcompSolid*>();// The output solid list */
+    vector<McCadDcompSolid* > *pErrorSolidList  = new vector<McCadDcompSolid*>();// The output solid list */
+    if (pMcCadSolid->Decompose(pOutputSolidList,pErrorSolidList,iLevel,1))        // Decompose solid
+    {
+        delete pMcCadSolid;
+        pMcCadSolid = NULL;
+    }
+
+    /// The cancelled solid is not finished, its pieces are not output
+    if(McCadDcompProgress::IsCancelled())
+    {
+        DeleteList(pOutputSolidList);
+        DeleteList(pErrorSolidList);
+        return;
+    }
+
+    m_iSplitTimedNum++;
+    m_fSplitTime += (double)(clock()-start)/CLOCKS_PER_SEC;
+
+    if(bRecord)
+    {
+        Standard_Real fTime = (double)(clock()-start)/CLOCKS_PER_SEC;
+        Standard_Integer iSplitNum = pOutputSolidList->size() + pErrorSolidList->size() - 1;
+        McCadDcompEstimator::Record(theCost, iSplitNum > 0 ? iSplitNum : 0, fTime);
+    }
+
+    /// Merge the adjacent solids of which the union is still convex
+    if(McCadConvertConfig::MergeConvexSolids())
+    {
+        McCadMergeConvexSolid *pMerge = new McCadMergeConvexSolid(pOutputSolidList);
+        pMerge->Perform();
+        m_iMergedCellNum += pMerge->GetCellReduction();
+        m_iMergedSurfNum += pMerge->GetSurfReduction();
+        delete pMerge;
+        pMerge = NULL;
+    }
+
+    for(unsigned int j = 0; j < pOutputSolidList->size(); j++)
+    {
+        if(pOutputSolidList->at(j)->IsFastConvex())
         {
-            delete pMcCadSolid;
-            pMcCadSolid = NULL;
+            m_iFastConvexNum++;
         }
+        if(pOutputSolidList->at(j)->IsPocketCell())
+        {
+            m_iPocketCellNum++;
+        }
+    }
+
+    m_pGeoData->AddDecompSolid(pOutputSolidList);   // Combine the solids and create a compund solid
+    m_pGeoData->AddErrorSolid(pErrorSolidList);     // Save the error solids
+
+    DeleteList(pOutputSolidList);   // Delete the output list and the solids inside
+    DeleteList(pErrorSolidList);    // Delete the error list and solids inside
+}
+
+
+
+/** ***************************************************************************
+* @brief  Get the statistics of decomposition for the checkpoint
+* @param  vector<Standard_Integer> & count_list
+* @return void
+*
+* @date 19/10/2026
+* @author  agent
+******************************************************************************/
+void McCadDecompose::GetCounts(vector<Standard_Integer> & count_list) const
+{
+    count_list.clear();
+    count_list.push_back(m_iFastConvexNum);
+    count_list.push_back(m_iMergedCellNum);
+    count_list.push_back(m_iMergedSurfNum);
+    count_list.push_back(m_iSymbolicNum);
+    count_list.push_back(m_iPocketCellNum);
+    count_list.push_back(m_iSymbSurfNum);
+    count_list.push_back(m_iSymbCellNum);
+}
+
 
-        m_pGeoData->AddDecompSolid(pOutputSolidList);   // Combine the solids and create a compund solid
-        m_pGeoData->AddErrorSolid(pErrorSolidList);     // Save the error solids
 
-        DeleteList(pOutputSolidList);   // Delete the output list and the solids inside
-        DeleteList(pErrorSolidList);    // Delete the error list and solids inside
+/** ***************************************************************************
+* @brief  Restore the statistics of decomposition from the checkpoint
+* @param  vector<Standard_Integer> & count_list
+* @return void
+*
+* @date 19/10/2026
+* @author  agent
+******************************************************************************/
+void McCadDecompose::SetCounts(const vector<Standard_Integer> & count_list)
+{
+    if(count_list.size() < 5)
+    {
+        return;
+    }
+    m_iFastConvexNum = count_list.at(0);
+    m_iMergedCellNum = count_list.at(1);
+    m_iMergedSurfNum = count_list.at(2);
+    m_iSymbolicNum   = count_list.at(3);
+    m_iPocketCellNum = count_list.at(4);
+
+    /// The numbering of the sign vector cells goes on after the resumed ones
+    if(count_list.size() >= 7)
+    {
+        m_iSymbSurfNum = count_list.at(5);
+        m_iSymbCellNum = count_list.at(6);
+    }
+}
+
+
+
+
+/** ***************************************************************************
+* @brief  Estimate the decomposition cost of the input solids and write the
+*         table sorted by the predicted runtime, the solids are not decomposed
+* @param
+* @return void
+*
+* @date 19/10/2026
+* @author  agent
+******************************************************************************/
+void McCadDecompose::Estimate()
+{
+    cout<<"*******************************************************************"<<endl;
+    cout<<"****          Estimate the cost of decomposition               ****"<<endl;
+    cout<<endl;
+    cout<<"*******************************************************************"<<endl;
+    cout<<endl;
+
+    Handle_TopTools_HSequenceOfShape InputSolidList = m_pGeoData->GetInputSolidList();
+
+    McCadDcompEstimator *pEstimator = new McCadDcompEstimator(InputSolidList);
+    pEstimator->Perform();
+
+    /// Remove the extension of the model file
+    TCollection_AsciiString vorName = "Estimate_";
+    TCollection_AsciiString outName = McCadGeneTool::PrefixFileName(vorName, m_fileName);
+    Standard_Integer iDot = outName.SearchFromEnd(".");
+    if(iDot > outName.SearchFromEnd(vorName) + vorName.Length() - 1)
+    {
+        outName.Trunc(iDot-1);
     }
+
+    TCollection_AsciiString csvName = outName + ".csv";
+    TCollection_AsciiString jsonName = outName + ".json";
+    if(pEstimator->WriteCSV(csvName) && pEstimator->WriteJSON(jsonName))
+    {
+        cout<<"-- The estimated cost is written into "<<csvName.ToCString()
+            <<" and "<<jsonName.ToCString()<<endl;
+    }
+
+    delete pEstimator;
+    pEstimator = NULL;
 }
 
 
@@ -33,10 +33,14 @@ public:
     void InputData(Handle_TopTools_HSequenceOfShape & solid_list,
                    TCollection_AsciiString theFileName);            /**< Load the step file */
     void Perform();                                                 /**< Perform the decomposition and saving */
+    void PerformInMemory();                                         /**< Perform the decomposition without saving */
+    Handle_TopTools_HSequenceOfShape GetDecomposedSolids() const;   /**< The decomposed solids for conversion */
 
     void SetFileName( TCollection_AsciiString theFileName);         /**< File name for saving */
     void SetCombine(Standard_Integer iCombSymb);                    /**< Combine the decomposed solids or not */
 
+    static Standard_Real CalMeshDeflection(TopoDS_Solid &theSolid);     /**< Calculate the deflection of surface meshing*/
+
 private:
 
     Standard_Real m_fDeflection;            /**< The deflection for surface meshing */
@@ -44,11 +48,26 @@ private:
     TCollection_AsciiString m_fileName;     /**< File name for saving */
     Standard_Integer m_iCombSymb;           /**< Combine the decomposed solids or not */
 
+    Standard_Integer m_iFastConvexNum;      /**< Convex solids output without meshing */
+    Standard_Integer m_iMergedCellNum;      /**< Solids removed by merging adjacent convex solids */
+    Standard_Integer m_iMergedSurfNum;      /**< Surfaces removed by merging adjacent convex solids */
+    Standard_Integer m_iSymbolicNum;        /**< Solids decomposed by sign vectors */
+    Standard_Integer m_iPocketCellNum;      /**< Solids kept as convex hull minus pockets */
+    Standard_Integer m_iSymbSurfNum;        /**< Surfaces written for the sign vector cells */
+    Standard_Integer m_iSymbCellNum;        /**< Cells written for the sign vector cells */
+    Standard_Integer m_iSymbTimedNum;       /**< Solids decomposed by sign vectors in this run */
+    Standard_Integer m_iSplitTimedNum;      /**< Solids decomposed by splitting in this run */
+    Standard_Real m_fSymbTime;              /**< Time of the sign vector decomposition in this run */
+    Standard_Real m_fSplitTime;             /**< Time of the splitting decomposition in this run */
+
 private:
 
-    Standard_Real CalMeshDeflection(TopoDS_Solid &theSolid);            /**< Calculate the deflection of surface meshing*/
     void SaveDecomposedSolids(TCollection_AsciiString theFileName);     /**< Save the decomposed solids */
     void Decompose();                                                   /**< Start decomposition */
+    void DecomposeSolid(TopoDS_Shape theShape, Standard_Integer iSolidNum); /**< Decompose one input solid */
+    void GetCounts(vector<Standard_Integer> & count_list) const;         /**< Statistics saved in checkpoint */
+    void SetCounts(const vector<Standard_Integer> & count_list);        /**< Restore the statistics */
+    void Estimate();                                                    /**< Estimate the cost without decomposition */
     void DeleteList(vector<McCadDcompSolid*> *& pSolidList);            /**< Delete the solid list and solids*/
 
 };
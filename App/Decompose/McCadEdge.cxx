@@ -1,5 +1,5 @@
 #include "McCadEdge.hxx"
-#include "../McCadTool/McCadGeomTool.hxx"
+#include "../Tools/McCadGeomTool.hxx"
 
 #include <BRep_Tool.hxx>
 #include <Geom_Curve.hxx>
@@ -0,0 +1,314 @@
+#include "McCadMergeConvexSolid.hxx"
+
+#include <BRepAlgoAPI_Fuse.hxx>
+#include <BRepBndLib.hxx>
+#include <BRepGProp.hxx>
+#include <GProp_GProps.hxx>
+
+#include <TopoDS.hxx>
+#include <TopExp_Explorer.hxx>
+
+#include <Standard_Version.hxx>
+#if OCC_VERSION_HEX >= 0x060700
+#include <ShapeUpgrade_UnifySameDomain.hxx>
+#endif
+
+#include "../Tools/McCadGeomTool.hxx"
+#include "../Convertor/McCadGeomSurfHash.hxx"
+
+McCadMergeConvexSolid::McCadMergeConvexSolid(vector<McCadDcompSolid*> *& pSolidList)
+{
+    m_pSolidList = pSolidList;
+    m_iCellReduction = 0;
+    m_iSurfReduction = 0;
+}
+
+McCadMergeConvexSolid::~McCadMergeConvexSolid()
+{
+    m_BoxList.clear();
+}
+
+
+
+/** ***************************************************************************
+* @brief  Merge the adjacent solids greedily. When two solids are merged, the
+*         merged solid replaces the first one and is compared with the other
+*         solids again. It takes the deflection and the flags of the two
+*         solids.
+* @param
+* @return void
+*
+* @date 19/10/2026
+* @author  agent
+******************************************************************************/
+void McCadMergeConvexSolid::Perform()
+{
+    if(m_pSolidList->size() < 2)
+    {
+        return;
+    }
+
+    Standard_Integer iSolidNum = m_pSolidList->size();
+    Standard_Integer iSurfNum = CountSurfaces();
+
+    m_BoxList.clear();
+    for(unsigned int i = 0; i < m_pSolidList->size(); i++)
+    {
+        Bnd_Box bndBox;
+        BRepBndLib::Add(*(m_pSolidList->at(i)), bndBox);
+        bndBox.SetGap(1.0e-3);
+        m_BoxList.push_back(bndBox);
+    }
+
+    for(unsigned int i = 0; i < m_pSolidList->size(); i++)
+    {
+        for(unsigned int j = i+1; j < m_pSolidList->size(); j++)
+        {
+            if(!IsAdjacent(i,j))
+            {
+                continue;
+            }
+
+            McCadDcompSolid *pSolidA = m_pSolidList->at(i);
+            McCadDcompSolid *pSolidB = m_pSolidList->at(j);
+
+            TopoDS_Solid theSolid;
+            if(!FuseSolids(*pSolidA,*pSolidB,theSolid))
+            {
+                continue;
+            }
+
+            McCadDcompSolid *pSolid = new McCadDcompSolid(theSolid);
+            pSolid->InheritFrom(*pSolidA,*pSolidB);
+            m_pSolidList->at(i) = pSolid;
+            m_pSolidList->erase(m_pSolidList->begin()+j);
+            m_BoxList.at(i).Add(m_BoxList.at(j));
+            m_BoxList.erase(m_BoxList.begin()+j);
+
+            delete pSolidA;
+            pSolidA = NULL;
+            delete pSolidB;
+            pSolidB = NULL;
+
+            j = i;      // Compare the merged solid with the other solids again
+        }
+    }
+
+    m_iCellReduction = iSolidNum - m_pSolidList->size();
+    if(m_iCellReduction > 0)
+    {
+        m_iSurfReduction = iSurfNum - CountSurfaces();
+        cout<<"-- "<<m_iCellReduction<<" adjacent convex solids are merged, "
+            <<m_iSurfReduction<<" surfaces are removed"<<endl;
+    }
+}
+
+
+
+/** ***************************************************************************
+* @brief  Two solids are adjacent if their boxes touch and they have faces on
+*         the same surface with opposite orientations, the boxes of the faces
+*         also touch.
+* @param  unsigned int iSolidA, unsigned int iSolidB  ( Index in solid list )
+* @return Standard_Boolean
+*
+* @date 19/10/2026
+* @author  agent
+******************************************************************************/
+Standard_Boolean McCadMergeConvexSolid::IsAdjacent(unsigned int iSolidA, unsigned int iSolidB)
+{
+    if(m_BoxList.at(iSolidA).IsOut(m_BoxList.at(iSolidB)))
+    {
+        return Standard_False;
+    }
+
+    McCadDcompSolid *pSolidA = m_pSolidList->at(iSolidA);
+    McCadDcompSolid *pSolidB = m_pSolidList->at(iSolidB);
+
+    for(TopExp_Explorer exA(*pSolidA,TopAbs_FACE); exA.More(); exA.Next())
+    {
+        TopoDS_Face faceA = TopoDS::Face(exA.Current());
+
+        Bnd_Box boxA;
+        BRepBndLib::Add(faceA, boxA);
+        boxA.SetGap(1.0e-3);
+        if(boxA.IsOut(m_BoxList.at(iSolidB)))
+        {
+            continue;
+        }
+
+        for(TopExp_Explorer exB(*pSolidB,TopAbs_FACE); exB.More(); exB.Next())
+        {
+            TopoDS_Face faceB = TopoDS::Face(exB.Current());
+
+            Bnd_Box boxB;
+            BRepBndLib::Add(faceB, boxB);
+            if(boxA.IsOut(boxB))
+            {
+                continue;
+            }
+
+            TopoDS_Face faceRevB = TopoDS::Face(faceB.Reversed());
+            if(McCadGeomTool::IsSameSurfaces(faceA,faceRevB))
+            {
+                return Standard_True;
+            }
+        }
+    }
+
+    return Standard_False;
+}
+
+
+
+/** ***************************************************************************
+* @brief  Fuse the two solids. The fused solid is accepted if it is one solid,
+*         its volume is the sum of the two solids, and it passes the convex
+*         check on the merged boundary.
+* @param  TopoDS_Solid &theSolidA, TopoDS_Solid &theSolidB
+*         TopoDS_Solid &theSolid   ( The fused solid )
+* @return Standard_Boolean
+*
+* @date 19/10/2026
+* @author  agent
+******************************************************************************/
+Standard_Boolean McCadMergeConvexSolid::FuseSolids(const TopoDS_Solid &theSolidA,
+                                                   const TopoDS_Solid &theSolidB,
+                                                   TopoDS_Solid &theSolid)
+{
+    TopoDS_Shape theShape;
+    try
+    {
+        BRepAlgoAPI_Fuse Fuser(theSolidA,theSolidB);
+        if(!Fuser.IsDone())
+        {
+            return Standard_False;
+        }
+        theShape = Fuser.Shape();
+
+#if OCC_VERSION_HEX >= 0x060700
+        /// Remove the edges between the faces on same surface
+        ShapeUpgrade_UnifySameDomain unify(theShape,Standard_True,Standard_True,Standard_False);
+        unify.Build();
+        theShape = unify.Shape();
+#endif
+    }
+    catch(Standard_Failure)
+    {
+        Standard_Failure::Caught()->Print(cout); cout << endl;
+        return Standard_False;
+    }
+
+    Standard_Integer iSolid = 0;
+    for(TopExp_Explorer exS(theShape,TopAbs_SOLID); exS.More(); exS.Next())
+    {
+        theSolid = TopoDS::Solid(exS.Current());
+        iSolid++;
+    }
+    if(iSolid != 1)
+    {
+        return Standard_False;
+    }
+
+    GProp_GProps GPsolidA, GPsolidB, GPsolid;
+    BRepGProp::VolumeProperties(theSolidA, GPsolidA);
+    BRepGProp::VolumeProperties(theSolidB, GPsolidB);
+    BRepGProp::VolumeProperties(theSolid, GPsolid);
+
+    Standard_Real fVolume = GPsolidA.Mass() + GPsolidB.Mass();
+    if(Abs(GPsolid.Mass() - fVolume) > 1.0e-6*fVolume)
+    {
+        return Standard_False;
+    }
+
+    McCadDcompSolid *pSolid = new McCadDcompSolid(theSolid);
+    Standard_Boolean bConvex = pSolid->IsConvexSolid();
+    delete pSolid;
+    pSolid = NULL;
+
+    return bConvex;
+}
+
+
+
+/** ***************************************************************************
+* @brief  Count the different surfaces of the solids, the faces on the same
+*         surface with either orientation are one surface. The faces are
+*         indexed by the quantised surface coefficients, each face is only
+*         compared with the surfaces in the neighbour buckets.
+* @param
+* @return Standard_Integer
+*
+* @date 19/10/2026
+* @author  agent
+******************************************************************************/
+Standard_Integer McCadMergeConvexSolid::CountSurfaces()
+{
+    vector<TopoDS_Face> surf_list;
+    McCadGeomSurfHash surf_hash;
+    vector<Standard_Integer> index_list;
+
+    for(unsigned int i = 0; i < m_pSolidList->size(); i++)
+    {
+        McCadDcompSolid *pSolid = m_pSolidList->at(i);
+        for(TopExp_Explorer exF(*pSolid,TopAbs_FACE); exF.More(); exF.Next())
+        {
+            TopoDS_Face face = TopoDS::Face(exF.Current());
+            TopoDS_Face faceRev = TopoDS::Face(face.Reversed());
+
+            /// The surfaces not supported by the hash have no candidate, and
+            /// IsSameSurfaces does not find them same with any surface either
+            surf_hash.GetCandidates(face,index_list);
+
+            Standard_Boolean bFound = Standard_False;
+            for(unsigned int j = 0; j < index_list.size(); j++)
+            {
+                const TopoDS_Face &theSurf = surf_list.at(index_list.at(j));
+                if(McCadGeomTool::IsSameSurfaces(theSurf,face)
+                   || McCadGeomTool::IsSameSurfaces(theSurf,faceRev))
+                {
+                    bFound = Standard_True;
+                    break;
+                }
+            }
+
+            if(!bFound)
+            {
+                surf_hash.Add(face,surf_list.size());
+                surf_list.push_back(face);
+            }
+        }
+    }
+
+    return surf_list.size();
+}
+
+
+
+/** ***************************************************************************
+* @brief  Number of solids removed by merging
+* @param
+* @return Standard_Integer
+*
+* @date 19/10/2026
+* @author  agent
+******************************************************************************/
+Standard_Integer McCadMergeConvexSolid::GetCellReduction() const
+{
+    return m_iCellReduction;
+}
+
+
+
+/** ***************************************************************************
+* @brief  Number of surfaces removed by merging
+* @param
+* @return Standard_Integer
+*
+* @date 19/10/2026
+* @author  agent
+******************************************************************************/
+Standard_Integer McCadMergeConvexSolid::GetSurfReduction() const
+{
+    return m_iSurfReduction;
+}
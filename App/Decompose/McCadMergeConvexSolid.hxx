@@ -0,0 +1,67 @@
+#ifndef MCCADMERGECONVEXSOLID_HXX
+#define MCCADMERGECONVEXSOLID_HXX
+
+#include <vector>
+#include <Standard.hxx>
+#include <TopoDS_Solid.hxx>
+#include <TopoDS_Face.hxx>
+#include <Bnd_Box.hxx>
+
+#include "McCadDcompSolid.hxx"
+
+using namespace std;
+
+/** Merge the adjacent convex solids decomposed from one input solid. The
+    decomposition often splits a convex part with a surface which turns out
+    to be unnecessary, two solids sharing a face are fused if the fused solid
+    is still convex. The merging is greedy, each merged solid is tried again
+    with the remaining solids. */
+class McCadMergeConvexSolid
+{
+public:
+
+    void* operator new(size_t,void* anAddress)
+    {
+        return anAddress;
+    }
+    void* operator new(size_t size)
+    {
+        return Standard::Allocate(size);
+    }
+    void  operator delete(void *anAddress)
+    {
+        if (anAddress) Standard::Free((Standard_Address&)anAddress);
+    }
+
+    McCadMergeConvexSolid(vector<McCadDcompSolid*> *& pSolidList);
+    ~McCadMergeConvexSolid();
+
+public:
+
+    /**< Merge the adjacent solids in the list */
+    void Perform();
+    /**< Number of solids removed by merging */
+    Standard_Integer GetCellReduction() const;
+    /**< Number of surfaces removed by merging */
+    Standard_Integer GetSurfReduction() const;
+
+private:
+
+    vector<McCadDcompSolid*> *m_pSolidList;     /**< The decomposed solids */
+    vector<Bnd_Box> m_BoxList;                  /**< Boundary boxes of the solids */
+    Standard_Integer m_iCellReduction;          /**< Number of solids removed */
+    Standard_Integer m_iSurfReduction;          /**< Number of surfaces removed */
+
+private:
+
+    /**< The solids have a pair of faces on same surface with opposite orientations */
+    Standard_Boolean IsAdjacent(unsigned int iSolidA, unsigned int iSolidB);
+    /**< Fuse the solids, return false if the fused solid is not one convex solid */
+    Standard_Boolean FuseSolids(const TopoDS_Solid &theSolidA,
+                                const TopoDS_Solid &theSolidB,
+                                TopoDS_Solid &theSolid);
+    /**< Count the different surfaces of the solids in list */
+    Standard_Integer CountSurfaces();
+};
+
+#endif // MCCADMERGECONVEXSOLID_HXX
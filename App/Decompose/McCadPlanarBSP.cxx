@@ -0,0 +1,948 @@
+#include "McCadPlanarBSP.hxx"
+
+#include <math.h>
+#include <algorithm>
+
+#include <BRep_Tool.hxx>
+#include <BRepAdaptor_Surface.hxx>
+#include <BRepAdaptor_Curve.hxx>
+#include <BRepBndLib.hxx>
+#include <BRepTools_WireExplorer.hxx>
+#include <BRepBuilderAPI_MakePolygon.hxx>
+#include <BRepBuilderAPI_MakeFace.hxx>
+#include <BRepBuilderAPI_Sewing.hxx>
+#include <BRepBuilderAPI_MakeSolid.hxx>
+#include <BRepClass3d_SolidClassifier.hxx>
+#include <BRepGProp.hxx>
+#include <GProp_GProps.hxx>
+#include <Bnd_Box.hxx>
+#include <ShapeFix_Solid.hxx>
+#include <TopExp.hxx>
+#include <TopExp_Explorer.hxx>
+#include <TopoDS.hxx>
+#include <TopoDS_Shell.hxx>
+#include <TopoDS_Vertex.hxx>
+#include <TopoDS_Wire.hxx>
+#include <TopTools_HSequenceOfShape.hxx>
+#include <TopTools_IndexedMapOfShape.hxx>
+#include <TopTools_IndexedDataMapOfShapeListOfShape.hxx>
+#include <TopTools_ListIteratorOfListOfShape.hxx>
+#include <gp_Pln.hxx>
+#include <gp_Vec.hxx>
+
+#include "McCadDcompSolid.hxx"
+
+McCadPlanarBSP::McCadPlanarBSP(const TopoDS_Solid &theSolid)
+{
+    m_InputSolid = theSolid;
+    m_ResultSolids = new TopTools_HSequenceOfShape();
+    m_fTol = 1.0e-7;
+    m_fVolume = 0.0;
+    BRepBndLib::Add(m_InputSolid, m_BndBox);
+}
+
+McCadPlanarBSP::~McCadPlanarBSP()
+{
+    m_ResultSolids->Clear();
+}
+
+
+
+/** ***************************************************************************
+* @brief  The solid is bounded only by planes and all the edges are straight
+* @param  TopoDS_Solid theSolid
+* @return Standard_Boolean
+*
+* @date 19/10/2026
+* @author  agent
+******************************************************************************/
+Standard_Boolean McCadPlanarBSP::IsPlanarSolid(const TopoDS_Solid &theSolid)
+{
+    for (TopExp_Explorer exF(theSolid,TopAbs_FACE); exF.More(); exF.Next())
+    {
+        BRepAdaptor_Surface BS(TopoDS::Face(exF.Current()), Standard_True);
+        if (BS.GetType() != GeomAbs_Plane)
+        {
+            return Standard_False;
+        }
+    }
+
+    for (TopExp_Explorer exE(theSolid,TopAbs_EDGE); exE.More(); exE.Next())
+    {
+        BRepAdaptor_Curve BC(TopoDS::Edge(exE.Current()));
+        if (BC.GetType() != GeomAbs_Line)
+        {
+            return Standard_False;
+        }
+    }
+
+    return Standard_True;
+}
+
+
+
+/** ***************************************************************************
+* @brief  Build the BSP tree and create the convex cells. The result is only
+*         accepted when the cells have the same volume as the input solid.
+* @param
+* @return Standard_Boolean
+*
+* @date 19/10/2026
+* @author  agent
+******************************************************************************/
+Standard_Boolean McCadPlanarBSP::Perform()
+{
+    if (!GenPlaneData())
+    {
+        return Standard_False;
+    }
+
+    /// The root cell is the enlarged boundary box of solid
+    Bnd_Box bndBox;
+    BRepBndLib::Add(m_InputSolid, bndBox);
+    Standard_Real xMin, yMin, zMin, xMax, yMax, zMax;
+    bndBox.Get(xMin, yMin, zMin, xMax, yMax, zMax);
+    Standard_Real fGap = 0.01*sqrt(bndBox.SquareExtent()) + 1.0;
+
+    HalfSpace box[6] = { {-1, 0, 0, xMin - fGap}, { 1, 0, 0, -xMax - fGap},
+                         { 0,-1, 0, yMin - fGap}, { 0, 1, 0, -yMax - fGap},
+                         { 0, 0,-1, zMin - fGap}, { 0, 0, 1, -zMax - fGap} };
+    vector<HalfSpace> cell(box, box+6);
+
+    vector<Polygon> polygons = m_PolygonList;
+    vector<Segment> segments = m_ConcaveEdgeList;
+
+    try
+    {
+        if (!Build(cell,polygons,segments,0))
+        {
+            m_ResultSolids->Clear();
+            return Standard_False;
+        }
+    }
+    catch(...)
+    {
+        cout<<"#Planar BSP decomposition failed"<<endl;
+        m_ResultSolids->Clear();
+        return Standard_False;
+    }
+
+    GProp_GProps GP;
+    BRepGProp::VolumeProperties(m_InputSolid, GP);
+    Standard_Real fVolume = GP.Mass();
+
+    if (m_ResultSolids->IsEmpty() || Abs(m_fVolume - fVolume) > 1.0e-5*Abs(fVolume))
+    {
+        cout<<"#Planar BSP decomposition changes the volume "<<fVolume<<" to "<<m_fVolume<<endl;
+        m_ResultSolids->Clear();
+        return Standard_False;
+    }
+
+    return Standard_True;
+}
+
+
+
+/** ***************************************************************************
+* @brief  Get the created convex solids
+* @param  Handle_TopTools_HSequenceOfShape & solid_list
+* @return void
+*
+* @date 19/10/2026
+* @author  agent
+******************************************************************************/
+void McCadPlanarBSP::GetResultSolids(Handle_TopTools_HSequenceOfShape & solid_list)
+{
+    solid_list->Append(m_ResultSolids);
+}
+
+
+
+/** ***************************************************************************
+* @brief  The value of point in the equation of half-space, it is the signed
+*         distance because the normal is unit vector.
+* @param  HalfSpace theHS
+*         gp_Pnt thePnt
+* @return Standard_Real
+*
+* @date 19/10/2026
+* @author  agent
+******************************************************************************/
+Standard_Real McCadPlanarBSP::Eval(const HalfSpace &theHS, const gp_Pnt &thePnt)
+{
+    return theHS.a*thePnt.X() + theHS.b*thePnt.Y() + theHS.c*thePnt.Z() + theHS.d;
+}
+
+
+
+/** ***************************************************************************
+* @brief  The half-space of plane face, the normal points out of the solid
+* @param  TopoDS_Face theFace
+* @return HalfSpace
+*
+* @date 19/10/2026
+* @author  agent
+******************************************************************************/
+McCadPlanarBSP::HalfSpace McCadPlanarBSP::FaceHalfSpace(const TopoDS_Face &theFace)
+{
+    BRepAdaptor_Surface BS(theFace, Standard_True);
+    gp_Pln thePln = BS.Plane();
+
+    gp_Dir dir = thePln.Position().XDirection().Crossed(thePln.Position().YDirection());
+    if (theFace.Orientation() == TopAbs_REVERSED)
+    {
+        dir.Reverse();
+    }
+
+    const gp_Pnt &pnt = thePln.Location();
+
+    HalfSpace hs;
+    hs.a = dir.X();
+    hs.b = dir.Y();
+    hs.c = dir.Z();
+    hs.d = -(dir.X()*pnt.X() + dir.Y()*pnt.Y() + dir.Z()*pnt.Z());
+    return hs;
+}
+
+
+
+/** ***************************************************************************
+* @brief  Add the splitting plane, the planes with opposite normals are same
+* @param  HalfSpace theHS
+* @return Standard_Integer ( Index of plane )
+*
+* @date 19/10/2026
+* @author  agent
+******************************************************************************/
+Standard_Integer McCadPlanarBSP::AddSplitPlane(const HalfSpace &theHS)
+{
+    for (unsigned int i = 0; i < m_SplitPlnList.size(); i++)
+    {
+        const HalfSpace &hs = m_SplitPlnList.at(i);
+        Standard_Real fDot = hs.a*theHS.a + hs.b*theHS.b + hs.c*theHS.c;
+
+        if (fDot > 1.0 - 1.0e-9 && Abs(hs.d - theHS.d) < m_fTol)
+        {
+            return i;
+        }
+        if (fDot < -1.0 + 1.0e-9 && Abs(hs.d + theHS.d) < m_fTol)
+        {
+            return i;
+        }
+    }
+
+    m_SplitPlnList.push_back(theHS);
+    return m_SplitPlnList.size() - 1;
+}
+
+
+
+/** ***************************************************************************
+* @brief  Collect the half-spaces and wire polygons of the faces, and the
+*         concave edges with the planes of their two faces
+* @param
+* @return Standard_Boolean
+*
+* @date 19/10/2026
+* @author  agent
+******************************************************************************/
+Standard_Boolean McCadPlanarBSP::GenPlaneData()
+{
+    Bnd_Box bndBox;
+    BRepBndLib::Add(m_InputSolid, bndBox);
+    m_fTol = Max(1.0e-6, 1.0e-7*sqrt(bndBox.SquareExtent()));
+
+    TopTools_IndexedMapOfShape faceMap;
+    TopExp::MapShapes(m_InputSolid, TopAbs_FACE, faceMap);
+
+    for (int i = 1; i <= faceMap.Extent(); i++)
+    {
+        TopoDS_Face face = TopoDS::Face(faceMap(i));
+        m_FacePlnList.push_back(FaceHalfSpace(face));
+        m_FaceSplitList.push_back(AddSplitPlane(m_FacePlnList.back()));
+
+        for (TopExp_Explorer exW(face,TopAbs_WIRE); exW.More(); exW.Next())
+        {
+            TopoDS_Wire wire = TopoDS::Wire(exW.Current());
+
+            Polygon poly;
+            poly.iFace = i - 1;
+            for (BRepTools_WireExplorer wex(wire,face); wex.More(); wex.Next())
+            {
+                poly.pnts.push_back(BRep_Tool::Pnt(wex.CurrentVertex()));
+            }
+
+            if (poly.pnts.size() < 3)
+            {
+                return Standard_False;
+            }
+            m_PolygonList.push_back(poly);
+        }
+    }
+
+    TopTools_IndexedDataMapOfShapeListOfShape mapEdgeFace;
+    TopExp::MapShapesAndAncestors(m_InputSolid,TopAbs_EDGE,TopAbs_FACE,mapEdgeFace);
+
+    for (int iKey = 1; iKey <= mapEdgeFace.Extent(); iKey++)
+    {
+        const TopTools_ListOfShape &listFace = mapEdgeFace.FindFromIndex(iKey);
+        if (listFace.Extent() != 2)
+        {
+            return Standard_False;
+        }
+
+        TopoDS_Edge edge = TopoDS::Edge(mapEdgeFace.FindKey(iKey));
+        TopTools_ListIteratorOfListOfShape iterFace(listFace);
+        TopoDS_Face FaceA = TopoDS::Face(iterFace.Value());
+        iterFace.Next();
+        TopoDS_Face FaceB = TopoDS::Face(iterFace.Value());
+
+        if (!McCadDcompSolid::IsConcaveEdge(edge,FaceA,FaceB))
+        {
+            continue;
+        }
+
+        TopoDS_Vertex vtxA, vtxB;
+        TopExp::Vertices(edge, vtxA, vtxB);
+
+        Segment seg;
+        seg.pntA = BRep_Tool::Pnt(vtxA);
+        seg.pntB = BRep_Tool::Pnt(vtxB);
+        seg.iPlnA = m_FaceSplitList.at(faceMap.FindIndex(FaceA) - 1);
+        seg.iPlnB = m_FaceSplitList.at(faceMap.FindIndex(FaceB) - 1);
+        m_ConcaveEdgeList.push_back(seg);
+    }
+
+    return Standard_True;
+}
+
+
+
+/** ***************************************************************************
+* @brief  Split the cell with the plane which holds most concave edges. When
+*         no concave edge is left, the cell can still hold several pieces of
+*         the solid, e.g. the slab between the walls of a hole, so it is split
+*         with the plane of a face cutting the part of solid. The polygons and
+*         edges on the splitting plane are removed, so the depth is limited by
+*         the number of splitting planes. The cell in which every face plane
+*         bounds the part of solid is a leaf.
+* @param  vector<HalfSpace> &theCell      ( Half-spaces bounding the cell )
+*         vector<Polygon> &thePolygons    ( Face polygons in the cell )
+*         vector<Segment> &theSegments    ( Concave edges in the cell )
+*         Standard_Integer iDepth
+* @return Standard_Boolean
+*
+* @date 19/10/2026
+* @author  agent
+******************************************************************************/
+Standard_Boolean McCadPlanarBSP::Build(vector<HalfSpace> &theCell,
+                                       vector<Polygon> &thePolygons,
+                                       vector<Segment> &theSegments,
+                                       Standard_Integer iDepth)
+{
+    Standard_Integer iCutFace = -1;
+    if (theSegments.empty())
+    {
+        iCutFace = FindCuttingFace(thePolygons);
+        if (iCutFace < 0)
+        {
+            return GenLeafSolid(theCell,thePolygons);
+        }
+    }
+
+    if (iDepth > (Standard_Integer)m_SplitPlnList.size())
+    {
+        return Standard_False;
+    }
+
+    Standard_Integer iSplit = 0;
+    if (iCutFace >= 0)
+    {
+        iSplit = m_FaceSplitList.at(iCutFace);
+    }
+    else
+    {
+        /// Select the plane on which most of the concave edges lie
+        vector<Standard_Integer> count(m_SplitPlnList.size(),0);
+        for (unsigned int i = 0; i < theSegments.size(); i++)
+        {
+            count.at(theSegments.at(i).iPlnA)++;
+            count.at(theSegments.at(i).iPlnB)++;
+        }
+        iSplit = max_element(count.begin(),count.end()) - count.begin();
+    }
+
+    for (int iSide = 0; iSide < 2; iSide++)
+    {
+        HalfSpace hs = m_SplitPlnList.at(iSplit);
+        if (iSide == 1)
+        {
+            hs.a = -hs.a; hs.b = -hs.b; hs.c = -hs.c; hs.d = -hs.d;
+        }
+
+        vector<HalfSpace> cell = theCell;
+        cell.push_back(hs);
+
+        vector<Polygon> polygons;
+        for (unsigned int i = 0; i < thePolygons.size(); i++)
+        {
+            Polygon poly;
+            ClipPolygon(thePolygons.at(i),hs,poly);
+            if (poly.pnts.size() >= 3)
+            {
+                polygons.push_back(poly);
+            }
+        }
+
+        vector<Segment> segments;
+        for (unsigned int i = 0; i < theSegments.size(); i++)
+        {
+            const Segment &seg = theSegments.at(i);
+            if (seg.iPlnA == iSplit || seg.iPlnB == iSplit)
+            {
+                continue;   // The edge is on the splitting plane
+            }
+
+            Segment segClip;
+            if (ClipSegment(seg,hs,segClip))
+            {
+                segments.push_back(segClip);
+            }
+        }
+
+        if (!Build(cell,polygons,segments,iDepth+1))
+        {
+            return Standard_False;
+        }
+    }
+
+    return Standard_True;
+}
+
+
+
+/** ***************************************************************************
+* @brief  The area of each face in the cell, the inner wires reduce the area
+* @param  vector<Polygon> &thePolygons
+*         vector<Standard_Real> &area_list
+* @return void
+*
+* @date 19/10/2026
+* @author  agent
+******************************************************************************/
+void McCadPlanarBSP::CalFaceArea(const vector<Polygon> &thePolygons, vector<Standard_Real> &area_list)
+{
+    area_list.assign(m_FacePlnList.size(),0.0);
+    for (unsigned int i = 0; i < thePolygons.size(); i++)
+    {
+        area_list.at(thePolygons.at(i).iFace) += SignedArea(thePolygons.at(i));
+    }
+}
+
+
+
+/** ***************************************************************************
+* @brief  Find the face with area in the cell whose plane has the points of
+*         other faces in the cell on its outer side. Such plane cuts the part
+*         of solid, which is not convex or has several pieces. The face with
+*         most points outside is selected.
+* @param  vector<Polygon> &thePolygons
+* @return Standard_Integer ( Index of face, -1 if every face plane bounds it )
+*
+* @date 19/10/2026
+* @author  agent
+******************************************************************************/
+Standard_Integer McCadPlanarBSP::FindCuttingFace(const vector<Polygon> &thePolygons)
+{
+    vector<Standard_Real> area;
+    CalFaceArea(thePolygons,area);
+
+    Standard_Integer iCutFace = -1;
+    Standard_Integer iMaxOut = 0;
+    for (unsigned int i = 0; i < area.size(); i++)
+    {
+        if (area.at(i) <= m_fTol*m_fTol*1.0e4)
+        {
+            continue;
+        }
+
+        const HalfSpace &hs = m_FacePlnList.at(i);
+        Standard_Integer iNbOut = 0;
+        for (unsigned int j = 0; j < thePolygons.size(); j++)
+        {
+            const Polygon &poly = thePolygons.at(j);
+            if (area.at(poly.iFace) <= m_fTol*m_fTol*1.0e4)
+            {
+                continue;
+            }
+            for (unsigned int k = 0; k < poly.pnts.size(); k++)
+            {
+                if (Eval(hs,poly.pnts.at(k)) > m_fTol*100)
+                {
+                    iNbOut++;
+                }
+            }
+        }
+
+        if (iNbOut > iMaxOut)
+        {
+            iMaxOut = iNbOut;
+            iCutFace = i;
+        }
+    }
+
+    return iCutFace;
+}
+
+
+
+/** ***************************************************************************
+* @brief  The part of solid in the leaf cell is bounded by the cell and the
+*         faces with area in the cell. The centre of the created convex solid
+*         is classified to decide whether the cell is inside the solid.
+* @param  vector<HalfSpace> &theCell
+*         vector<Polygon> &thePolygons
+* @return Standard_Boolean
+*
+* @date 19/10/2026
+* @author  agent
+******************************************************************************/
+Standard_Boolean McCadPlanarBSP::GenLeafSolid(vector<HalfSpace> &theCell,
+                                              vector<Polygon> &thePolygons)
+{
+    /// The faces with area in the cell, they all bound the part of solid
+    vector<Standard_Real> area;
+    CalFaceArea(thePolygons,area);
+
+    vector<HalfSpace> hs_list = theCell;
+    for (unsigned int i = 0; i < area.size(); i++)
+    {
+        if (area.at(i) > m_fTol*m_fTol*1.0e4)
+        {
+            hs_list.push_back(m_FacePlnList.at(i));
+        }
+    }
+
+    TopoDS_Solid theSolid;
+    if (!MakeConvexSolid(hs_list,theSolid))
+    {
+        return Standard_True;   // The cell is empty
+    }
+
+    GProp_GProps GP;
+    BRepGProp::VolumeProperties(theSolid, GP);
+    if (GP.Mass() < m_fTol)
+    {
+        return Standard_True;
+    }
+
+    BRepClass3d_SolidClassifier bsc3d(m_InputSolid);
+    bsc3d.Perform(GP.CentreOfMass(), m_fTol);
+    if (bsc3d.State() != TopAbs_IN)
+    {
+        return Standard_True;   // The cell is outside the solid
+    }
+
+    m_ResultSolids->Append(theSolid);
+    m_fVolume += GP.Mass();
+    return Standard_True;
+}
+
+
+
+/** ***************************************************************************
+* @brief  Shrink the bounding box of the input solid to the box of the cell
+*         with the half-spaces normal to the axes, then remove the
+*         half-spaces which contain the whole box. They do not bound the
+*         region, and the vertex search is cubic in the number of planes.
+* @param  vector<HalfSpace> &theHSList
+*         Standard_Real theBox[6] ( xMin,yMin,zMin,xMax,yMax,zMax of the cell )
+* @return Standard_Boolean ( False if the box of the cell is empty )
+*
+* @date 19/10/2026
+* @author  agent
+******************************************************************************/
+Standard_Boolean McCadPlanarBSP::PruneHalfSpaces(vector<HalfSpace> &theHSList,
+                                                 Standard_Real theBox[6])
+{
+    if (m_BndBox.IsVoid())
+    {
+        return Standard_False;
+    }
+    m_BndBox.Get(theBox[0],theBox[1],theBox[2],theBox[3],theBox[4],theBox[5]);
+
+    for (unsigned int i = 0; i < theHSList.size(); i++)
+    {
+        const HalfSpace &hs = theHSList.at(i);
+        Standard_Real coef[3] = {hs.a, hs.b, hs.c};
+        for (int k = 0; k < 3; k++)
+        {
+            if (Abs(coef[k]) < 1.0 - 1.0e-9)
+            {
+                continue;
+            }
+
+            Standard_Real fPos = -hs.d/coef[k];
+            if (coef[k] > 0)
+            {
+                theBox[k+3] = Min(theBox[k+3],fPos);
+            }
+            else
+            {
+                theBox[k] = Max(theBox[k],fPos);
+            }
+        }
+    }
+
+    for (int k = 0; k < 3; k++)
+    {
+        if (theBox[k] > theBox[k+3] + m_fTol*10)
+        {
+            return Standard_False;
+        }
+    }
+
+    vector<HalfSpace> hs_list;
+    for (unsigned int i = 0; i < theHSList.size(); i++)
+    {
+        const HalfSpace &hs = theHSList.at(i);
+
+        /// The corners of the box with the largest and smallest value
+        Standard_Real fMax = hs.d, fMin = hs.d;
+        Standard_Real coef[3] = {hs.a, hs.b, hs.c};
+        for (int k = 0; k < 3; k++)
+        {
+            fMax += coef[k] > 0 ? coef[k]*theBox[k+3] : coef[k]*theBox[k];
+            fMin += coef[k] > 0 ? coef[k]*theBox[k] : coef[k]*theBox[k+3];
+        }
+
+        if (fMin > m_fTol*10)
+        {
+            return Standard_False;  // The box is outside the half-space
+        }
+        if (fMax < -m_fTol*10)
+        {
+            continue;               // The plane does not cut the box
+        }
+        hs_list.push_back(hs);
+    }
+
+    theHSList = hs_list;
+    return Standard_True;
+}
+
+
+
+/** ***************************************************************************
+* @brief  Create the convex solid bounded by the half-spaces. The vertices are
+*         the intersection points of three planes inside all the half-spaces,
+*         the vertices on each plane are sorted around the plane normal.
+* @param  vector<HalfSpace> &theHSList
+*         TopoDS_Solid &theSolid
+* @return Standard_Boolean ( False if the region has no volume )
+*
+* @date 19/10/2026
+* @author  agent
+******************************************************************************/
+Standard_Boolean McCadPlanarBSP::MakeConvexSolid(vector<HalfSpace> &theHSList,
+                                                 TopoDS_Solid &theSolid)
+{
+    /// Only the planes cutting the box of the cell are intersected
+    Standard_Real box[6];
+    if (!PruneHalfSpaces(theHSList,box))
+    {
+        return Standard_False;
+    }
+
+    Standard_Integer iNbHS = theHSList.size();
+    vector<gp_Pnt> vertex_list;
+
+    for (int i = 0; i < iNbHS-2; i++)
+    {
+        const HalfSpace &P = theHSList.at(i);
+        for (int j = i+1; j < iNbHS-1; j++)
+        {
+            const HalfSpace &Q = theHSList.at(j);
+            for (int k = j+1; k < iNbHS; k++)
+            {
+                const HalfSpace &R = theHSList.at(k);
+
+                Standard_Real det = P.a*(Q.b*R.c - Q.c*R.b)
+                                  - P.b*(Q.a*R.c - Q.c*R.a)
+                                  + P.c*(Q.a*R.b - Q.b*R.a);
+                if (Abs(det) < 1.0e-10)
+                {
+                    continue;
+                }
+
+                /// Cramer's rule for the three plane equations
+                Standard_Real x = (-P.d*(Q.b*R.c - Q.c*R.b)
+                                   - P.b*(-Q.d*R.c + Q.c*R.d)
+                                   + P.c*(-Q.d*R.b + Q.b*R.d))/det;
+                Standard_Real y = (P.a*(-Q.d*R.c + Q.c*R.d)
+                                   + P.d*(Q.a*R.c - Q.c*R.a)
+                                   + P.c*(-Q.a*R.d + Q.d*R.a))/det;
+                Standard_Real z = (P.a*(-Q.b*R.d + Q.d*R.b)
+                                   - P.b*(-Q.a*R.d + Q.d*R.a)
+                                   - P.d*(Q.a*R.b - Q.b*R.a))/det;
+                gp_Pnt pnt(x,y,z);
+
+                if (x < box[0] - m_fTol*10 || x > box[3] + m_fTol*10
+                    || y < box[1] - m_fTol*10 || y > box[4] + m_fTol*10
+                    || z < box[2] - m_fTol*10 || z > box[5] + m_fTol*10)
+                {
+                    continue;   // The vertex is out of the box of cell
+                }
+
+                Standard_Boolean bInside = Standard_True;
+                for (int m = 0; m < iNbHS; m++)
+                {
+                    if (Eval(theHSList.at(m),pnt) > m_fTol*10)
+                    {
+                        bInside = Standard_False;
+                        break;
+                    }
+                }
+                if (!bInside)
+                {
+                    continue;
+                }
+
+                Standard_Boolean bRepeat = Standard_False;
+                for (unsigned int m = 0; m < vertex_list.size(); m++)
+                {
+                    if (vertex_list.at(m).Distance(pnt) < m_fTol*10)
+                    {
+                        bRepeat = Standard_True;
+                        break;
+                    }
+                }
+                if (!bRepeat)
+                {
+                    vertex_list.push_back(pnt);
+                }
+            }
+        }
+    }
+
+    if (vertex_list.size() < 4)
+    {
+        return Standard_False;
+    }
+
+    BRepBuilderAPI_Sewing sewer(m_fTol*10);
+    Standard_Integer iNbFace = 0;
+    vector<Standard_Boolean> used(iNbHS,Standard_False);
+
+    for (int i = 0; i < iNbHS; i++)
+    {
+        const HalfSpace &hs = theHSList.at(i);
+        gp_Dir normal(hs.a,hs.b,hs.c);
+
+        /// The same plane is added only once
+        Standard_Boolean bSame = Standard_False;
+        for (int j = 0; j < i; j++)
+        {
+            const HalfSpace &hsB = theHSList.at(j);
+            if (used.at(j) && hs.a*hsB.a + hs.b*hsB.b + hs.c*hsB.c > 1.0 - 1.0e-9
+                && Abs(hs.d - hsB.d) < m_fTol)
+            {
+                bSame = Standard_True;
+                break;
+            }
+        }
+        if (bSame)
+        {
+            continue;
+        }
+
+        vector<gp_Pnt> face_pnts;
+        gp_XYZ centre(0,0,0);
+        for (unsigned int m = 0; m < vertex_list.size(); m++)
+        {
+            if (Abs(Eval(hs,vertex_list.at(m))) < m_fTol*10)
+            {
+                face_pnts.push_back(vertex_list.at(m));
+                centre += vertex_list.at(m).XYZ();
+            }
+        }
+        if (face_pnts.size() < 3)
+        {
+            continue;
+        }
+        centre /= face_pnts.size();
+
+        /// Sort the points anticlockwise around the outer normal
+        gp_Dir dirU = gp_Dir(gp_Vec(gp_Pnt(centre),face_pnts.at(0)));
+        gp_Dir dirV = normal.Crossed(dirU);
+        vector< pair<Standard_Real,Standard_Integer> > angle_list;
+        for (unsigned int m = 0; m < face_pnts.size(); m++)
+        {
+            gp_Vec vec(gp_Pnt(centre),face_pnts.at(m));
+            angle_list.push_back(make_pair(atan2(vec.Dot(gp_Vec(dirV)),vec.Dot(gp_Vec(dirU))),m));
+        }
+        sort(angle_list.begin(),angle_list.end());
+
+        BRepBuilderAPI_MakePolygon polygon;
+        for (unsigned int m = 0; m < angle_list.size(); m++)
+        {
+            polygon.Add(face_pnts.at(angle_list.at(m).second));
+        }
+        polygon.Close();
+        if (!polygon.IsDone())
+        {
+            continue;
+        }
+
+        BRepBuilderAPI_MakeFace makeFace(polygon.Wire(),Standard_True);
+        if (!makeFace.IsDone())
+        {
+            continue;
+        }
+
+        sewer.Add(makeFace.Face());
+        used.at(i) = Standard_True;
+        iNbFace++;
+    }
+
+    if (iNbFace < 4)
+    {
+        return Standard_False;
+    }
+
+    sewer.Perform();
+    TopoDS_Shape theShell = sewer.SewedShape();
+    if (theShell.ShapeType() != TopAbs_SHELL)
+    {
+        return Standard_False;
+    }
+
+    BRepBuilderAPI_MakeSolid makeSolid(TopoDS::Shell(theShell));
+    if (!makeSolid.IsDone())
+    {
+        return Standard_False;
+    }
+
+    Handle(ShapeFix_Solid) solidFix = new ShapeFix_Solid;
+    solidFix->Init(makeSolid.Solid());
+    solidFix->Perform();
+    theSolid = TopoDS::Solid(solidFix->Solid());
+
+    return Standard_True;
+}
+
+
+
+/** ***************************************************************************
+* @brief  Clip the polygon with the half-space, the points on the plane are
+*         kept on both sides, the polygon lying on the plane is removed.
+* @param  Polygon thePoly
+*         HalfSpace theHS
+*         Polygon theResult
+* @return void
+*
+* @date 19/10/2026
+* @author  agent
+******************************************************************************/
+void McCadPlanarBSP::ClipPolygon(const Polygon &thePoly, const HalfSpace &theHS, Polygon &theResult)
+{
+    theResult.iFace = thePoly.iFace;
+    theResult.pnts.clear();
+
+    /// The polygon on the plane is dropped, the plane bounds the cell already
+    Standard_Integer iNbPnt = thePoly.pnts.size();
+    Standard_Integer iOnPlane = 0;
+    for (int i = 0; i < iNbPnt; i++)
+    {
+        if (Abs(Eval(theHS,thePoly.pnts.at(i))) <= m_fTol)
+        {
+            iOnPlane++;
+        }
+    }
+    if (iOnPlane == iNbPnt)
+    {
+        return;
+    }
+
+    for (int i = 0; i < iNbPnt; i++)
+    {
+        const gp_Pnt &pntP = thePoly.pnts.at(i);
+        const gp_Pnt &pntQ = thePoly.pnts.at((i+1)%iNbPnt);
+        Standard_Real fP = Eval(theHS,pntP);
+        Standard_Real fQ = Eval(theHS,pntQ);
+
+        if (fP <= m_fTol)
+        {
+            theResult.pnts.push_back(pntP);
+        }
+
+        if ((fP < -m_fTol && fQ > m_fTol) || (fP > m_fTol && fQ < -m_fTol))
+        {
+            Standard_Real t = fP/(fP - fQ);
+            theResult.pnts.push_back(gp_Pnt(pntP.XYZ() + t*(pntQ.XYZ() - pntP.XYZ())));
+        }
+    }
+}
+
+
+
+/** ***************************************************************************
+* @brief  Clip the segment with the half-space
+* @param  Segment theSeg
+*         HalfSpace theHS
+*         Segment theResult
+* @return Standard_Boolean ( False if no part of segment is left )
+*
+* @date 19/10/2026
+* @author  agent
+******************************************************************************/
+Standard_Boolean McCadPlanarBSP::ClipSegment(const Segment &theSeg, const HalfSpace &theHS, Segment &theResult)
+{
+    theResult = theSeg;
+
+    Standard_Real fA = Eval(theHS,theSeg.pntA);
+    Standard_Real fB = Eval(theHS,theSeg.pntB);
+
+    if (fA >= -m_fTol && fB >= -m_fTol)
+    {
+        return Standard_False;  // Outside or on the plane
+    }
+
+    if (fA > m_fTol)
+    {
+        Standard_Real t = fA/(fA - fB);
+        theResult.pntA = gp_Pnt(theSeg.pntA.XYZ() + t*(theSeg.pntB.XYZ() - theSeg.pntA.XYZ()));
+    }
+    else if (fB > m_fTol)
+    {
+        Standard_Real t = fB/(fB - fA);
+        theResult.pntB = gp_Pnt(theSeg.pntB.XYZ() + t*(theSeg.pntA.XYZ() - theSeg.pntB.XYZ()));
+    }
+
+    return theResult.pntA.Distance(theResult.pntB) > m_fTol;
+}
+
+
+
+/** ***************************************************************************
+* @brief  Signed area of polygon with the outer normal of its face, the outer
+*         wire is positive and the inner wires are negative
+* @param  Polygon thePoly
+* @return Standard_Real
+*
+* @date 19/10/2026
+* @author  agent
+******************************************************************************/
+Standard_Real McCadPlanarBSP::SignedArea(const Polygon &thePoly)
+{
+    const HalfSpace &hs = m_FacePlnList.at(thePoly.iFace);
+    gp_XYZ sum(0,0,0);
+
+    Standard_Integer iNbPnt = thePoly.pnts.size();
+    for (int i = 0; i < iNbPnt; i++)
+    {
+        sum += thePoly.pnts.at(i).XYZ().Crossed(thePoly.pnts.at((i+1)%iNbPnt).XYZ());
+    }
+
+    return 0.5*(sum.X()*hs.a + sum.Y()*hs.b + sum.Z()*hs.c);
+}
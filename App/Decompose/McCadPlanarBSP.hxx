@@ -0,0 +1,127 @@
+#ifndef MCCADPLANARBSP_HXX
+#define MCCADPLANARBSP_HXX
+
+#include <vector>
+#include <Standard.hxx>
+#include <TopoDS_Solid.hxx>
+#include <TopoDS_Face.hxx>
+#include <gp_Pnt.hxx>
+#include <gp_Dir.hxx>
+#include <Bnd_Box.hxx>
+#include <Handle_TopTools_HSequenceOfShape.hxx>
+
+using namespace std;
+
+/** Decompose the solid bounded only by planes without boolean operations.
+    A BSP tree is built over the planes of the faces connected by concave
+    edges, then over the planes of the faces which cut the part of solid in
+    the cell. In the leaf cell every face plane bounds the part of solid, so
+    it is one convex piece and is created directly as an intersection of
+    half-spaces.
+    The total volume of the cells is compared with the input solid, the
+    kernel fails if they are different. */
+class McCadPlanarBSP
+{
+public:
+
+    void* operator new(size_t,void* anAddress)
+    {
+        return anAddress;
+    }
+    void* operator new(size_t size)
+    {
+        return Standard::Allocate(size);
+    }
+    void  operator delete(void *anAddress)
+    {
+        if (anAddress) Standard::Free((Standard_Address&)anAddress);
+    }
+
+    McCadPlanarBSP(const TopoDS_Solid &theSolid);
+    ~McCadPlanarBSP();
+
+public:
+
+    /**< The solid is bounded only by planes with straight edges or not */
+    static Standard_Boolean IsPlanarSolid(const TopoDS_Solid &theSolid);
+
+    /**< Perform the decomposition */
+    Standard_Boolean Perform();
+    /**< Get the convex solids after decomposition */
+    void GetResultSolids(Handle_TopTools_HSequenceOfShape & solid_list);
+
+private:
+
+    /** The half-space a*x+b*y+c*z+d <= 0, (a,b,c) is the unit outer normal */
+    struct HalfSpace
+    {
+        Standard_Real a, b, c, d;
+    };
+
+    /** The polygon of a face wire, ordered along the face orientation */
+    struct Polygon
+    {
+        vector<gp_Pnt> pnts;
+        Standard_Integer iFace;     /**< Index of the face half-space */
+    };
+
+    /** The part of concave edge left in the cell */
+    struct Segment
+    {
+        gp_Pnt pntA, pntB;
+        Standard_Integer iPlnA;     /**< Splitting plane of the first face */
+        Standard_Integer iPlnB;     /**< Splitting plane of the second face */
+    };
+
+    TopoDS_Solid m_InputSolid;                          /**< Input solid */
+    Handle_TopTools_HSequenceOfShape m_ResultSolids;    /**< The convex solids */
+
+    vector<HalfSpace> m_FacePlnList;                    /**< The half-spaces of faces */
+    vector<Standard_Integer> m_FaceSplitList;           /**< The splitting plane of each face */
+    vector<HalfSpace> m_SplitPlnList;                   /**< The splitting planes */
+    vector<Polygon> m_PolygonList;                      /**< The wires of faces */
+    vector<Segment> m_ConcaveEdgeList;                  /**< The concave edges */
+
+    Standard_Real m_fTol;                               /**< The distance tolerance */
+    Standard_Real m_fVolume;                            /**< Volume of created cells */
+    Bnd_Box m_BndBox;                                   /**< Bounding box of the input solid */
+
+private:
+
+    /**< Value of the point in half-space equation */
+    static Standard_Real Eval(const HalfSpace &theHS, const gp_Pnt &thePnt);
+    /**< Half-space of the plane face with outer normal */
+    HalfSpace FaceHalfSpace(const TopoDS_Face &theFace);
+    /**< Find the same plane in the list, or add it */
+    Standard_Integer AddSplitPlane(const HalfSpace &theHS);
+
+    /**< Collect the polygons, face planes and concave edges */
+    Standard_Boolean GenPlaneData();
+    /**< Build the BSP tree recursively */
+    Standard_Boolean Build(vector<HalfSpace> &theCell,
+                           vector<Polygon> &thePolygons,
+                           vector<Segment> &theSegments,
+                           Standard_Integer iDepth);
+    /**< Area of each face in the cell */
+    void CalFaceArea(const vector<Polygon> &thePolygons, vector<Standard_Real> &area_list);
+    /**< Find the face whose plane cuts the part of solid in cell, -1 if all the planes bound it */
+    Standard_Integer FindCuttingFace(const vector<Polygon> &thePolygons);
+    /**< Create the convex solid of the leaf cell */
+    Standard_Boolean GenLeafSolid(vector<HalfSpace> &theCell,
+                                  vector<Polygon> &thePolygons);
+    /**< Remove the half-spaces not cutting the box of cell, false if the cell is empty */
+    Standard_Boolean PruneHalfSpaces(vector<HalfSpace> &theHSList,
+                                     Standard_Real theBox[6]);
+    /**< Create the convex solid bounded by half-spaces */
+    Standard_Boolean MakeConvexSolid(vector<HalfSpace> &theHSList,
+                                     TopoDS_Solid &theSolid);
+
+    /**< Clip the polygon and keep the part inside half-space */
+    void ClipPolygon(const Polygon &thePoly, const HalfSpace &theHS, Polygon &theResult);
+    /**< Clip the segment, return false if nothing left in the open half-space */
+    Standard_Boolean ClipSegment(const Segment &theSeg, const HalfSpace &theHS, Segment &theResult);
+    /**< Area of polygon projected on the normal of its face */
+    Standard_Real SignedArea(const Polygon &thePoly);
+};
+
+#endif // MCCADPLANARBSP_HXX
@@ -0,0 +1,513 @@
+#include "McCadQuadricIntersect.hxx"
+
+#include <math.h>
+
+#include <gp_Vec.hxx>
+#include <gp_Dir.hxx>
+
+McCadQuadricIntersect::McCadQuadricIntersect()
+{
+}
+
+
+
+/** ***************************************************************************
+* @brief  Transform a point into the local coordinate system of the surface
+* @param  const gp_Ax3 &theAxis     Local coordinate system of the surface
+*         const gp_Pnt &thePnt      Point in the global system
+* @return Standard_Real &x,&y,&z    Coordinates in the local system
+*
+* @date 19/10/2026
+* @author  agent
+******************************************************************************/
+void McCadQuadricIntersect::ToLocal(const gp_Ax3 &theAxis, const gp_Pnt &thePnt,
+                                    Standard_Real &x, Standard_Real &y, Standard_Real &z)
+{
+    gp_Vec vec(theAxis.Location(), thePnt);
+    x = vec.Dot(gp_Vec(theAxis.XDirection()));
+    y = vec.Dot(gp_Vec(theAxis.YDirection()));
+    z = vec.Dot(gp_Vec(theAxis.Direction()));
+}
+
+
+
+/** ***************************************************************************
+* @brief  Solve the quadratic equation A*t^2 + B*t + C = 0. The numerically
+*         stable form is used to avoid the cancellation when B*B >> 4*A*C.
+*         If A vanishes the linear equation is solved.
+* @param  Standard_Real A,B,C       Coefficients of equation
+* @return Standard_Integer          Number of real roots, stored in theRoot
+*
+* @date 19/10/2026
+* @author  agent
+******************************************************************************/
+Standard_Integer McCadQuadricIntersect::SolveQuadratic(Standard_Real A,
+                                                       Standard_Real B,
+                                                       Standard_Real C,
+                                                       Standard_Real theRoot[2])
+{
+    Standard_Real fScale = Max(Abs(B), Abs(C));
+    if (Abs(A) <= 1.0e-12 * Max(fScale, 1.0))
+    {
+        if (Abs(B) <= 1.0e-12)      // Degenerated equation, no isolated root
+        {
+            return 0;
+        }
+        theRoot[0] = -C/B;
+        return 1;
+    }
+
+    Standard_Real fDisc = B*B - 4.0*A*C;
+    if (fDisc < 0.0)
+    {
+        return 0;
+    }
+
+    Standard_Real fSqrt = sqrt(fDisc);
+    Standard_Real q = (B >= 0.0) ? -0.5*(B + fSqrt) : -0.5*(B - fSqrt);
+
+    theRoot[0] = q/A;
+    if (Abs(q) <= 1.0e-300)         // B and disc are zero, double root at t = 0
+    {
+        theRoot[1] = theRoot[0];
+    }
+    else
+    {
+        theRoot[1] = C/q;
+    }
+
+    if (theRoot[0] > theRoot[1])
+    {
+        Standard_Real fTmp = theRoot[0];
+        theRoot[0] = theRoot[1];
+        theRoot[1] = fTmp;
+    }
+    return 2;
+}
+
+
+
+/** ***************************************************************************
+* @brief  Keep the roots located in [0,1] of the segment. The roots slightly
+*         outside the range within the tolerance are moved to the end points,
+*         and two roots closer than tolerance are merged into one.
+* @param  Standard_Integer iNbRoot  Number of roots
+*         Standard_Real theRoot[2]  Roots
+*         Standard_Real theParTol   Tolerance in parameter space
+* @return Standard_Integer          Number of remained roots
+*
+* @date 19/10/2026
+* @author  agent
+******************************************************************************/
+Standard_Integer McCadQuadricIntersect::ClipRoots(Standard_Integer iNbRoot,
+                                                  Standard_Real theRoot[2],
+                                                  Standard_Real theParTol)
+{
+    Standard_Integer iNum = 0;
+    for (Standard_Integer i = 0; i < iNbRoot; i++)
+    {
+        Standard_Real t = theRoot[i];
+        if (t < -theParTol || t > 1.0 + theParTol)
+        {
+            continue;
+        }
+
+        t = Min(Max(t, 0.0), 1.0);
+        if (iNum > 0 && Abs(t - theRoot[iNum-1]) <= theParTol)
+        {
+            continue;               // The repeated root, such as tangent point
+        }
+        theRoot[iNum++] = t;
+    }
+    return iNum;
+}
+
+
+
+/** ***************************************************************************
+* @brief  Keep the roots whose height along the axis is inside the range,
+*         the height of root t is z0 + t*dz in the local frame.
+* @param  Standard_Integer iNbRoot
+*         Standard_Real theRoot[2]
+*         Standard_Real z0, dz              Height of segment start and step
+*         Standard_Real theZMin, theZMax    Range of height
+* @return Standard_Integer                  Number of roots kept
+*
+* @date 19/10/2026
+* @author  agent
+******************************************************************************/
+Standard_Integer McCadQuadricIntersect::ClipHeight(Standard_Integer iNbRoot,
+                                                   Standard_Real theRoot[2],
+                                                   Standard_Real z0,
+                                                   Standard_Real dz,
+                                                   Standard_Real theZMin,
+                                                   Standard_Real theZMax)
+{
+    Standard_Integer iNum = 0;
+    for (Standard_Integer i = 0; i < iNbRoot; i++)
+    {
+        Standard_Real z = z0 + theRoot[i]*dz;
+        if (z >= theZMin && z <= theZMax)
+        {
+            theRoot[iNum++] = theRoot[i];
+        }
+    }
+    return iNum;
+}
+
+
+
+/** ***************************************************************************
+* @brief  Calculate the intersection of segment and the cylinder bounded
+*         by its V parameters. In the local frame the cylinder is
+*         x^2 + y^2 = r^2, and the segment P(t) = A + t(B-A), t in [0,1].
+*         When the segment does not reach the cylinder but the closest point
+*         is within tolerance, the segment is considered as tangent and one
+*         point is returned. The points out of [VMin,VMax] along the axis
+*         are not on the face and they are removed.
+* @param  const gp_Pnt &thePntA, &thePntB   The end points of segment
+*         const gp_Cylinder &theCyln        Cylinder
+*         Standard_Real theVMin, theVMax    V range of the cylinder face
+*         Standard_Real theTol              Distance tolerance
+* @return Standard_Integer                  Number of intersected points
+*         Standard_Real theParam[2]         Parameters of intersected points
+*
+* @date 19/10/2026
+* @author  agent
+******************************************************************************/
+Standard_Integer McCadQuadricIntersect::SegmentCylinder(const gp_Pnt &thePntA,
+                                                        const gp_Pnt &thePntB,
+                                                        const gp_Cylinder &theCyln,
+                                                        Standard_Real theVMin,
+                                                        Standard_Real theVMax,
+                                                        Standard_Real theTol,
+                                                        Standard_Real theParam[2])
+{
+    Standard_Real fLength = thePntA.Distance(thePntB);
+    if (fLength <= theTol)
+    {
+        return 0;
+    }
+
+    Standard_Real ax, ay, az, bx, by, bz;
+    ToLocal(theCyln.Position(), thePntA, ax, ay, az);
+    ToLocal(theCyln.Position(), thePntB, bx, by, bz);
+
+    Standard_Real dx = bx - ax;
+    Standard_Real dy = by - ay;
+    Standard_Real dz = bz - az;
+    Standard_Real r  = theCyln.Radius();
+
+    Standard_Real A = dx*dx + dy*dy;
+    Standard_Real B = 2.0*(ax*dx + ay*dy);
+    Standard_Real C = ax*ax + ay*ay - r*r;
+
+    /// The segment is parallel with the axis, it can not cross the cylinder
+    if (A <= 1.0e-12*fLength*fLength)
+    {
+        return 0;
+    }
+
+    Standard_Integer iNbRoot = SolveQuadratic(A, B, C, theParam);
+    if (iNbRoot == 0)
+    {
+        Standard_Real t0 = -B/(2.0*A);  // The closest point to the axis
+        if (t0 < 0.0 || t0 > 1.0)
+        {
+            return 0;
+        }
+        Standard_Real x = ax + t0*dx;
+        Standard_Real y = ay + t0*dy;
+        if (Abs(sqrt(x*x + y*y) - r) > theTol)
+        {
+            return 0;
+        }
+        theParam[0] = t0;
+        iNbRoot = 1;
+    }
+
+    /// The V parameter of cylinder is the height along the axis
+    iNbRoot = ClipHeight(iNbRoot, theParam, az, dz, theVMin - theTol, theVMax + theTol);
+    return ClipRoots(iNbRoot, theParam, theTol/fLength);
+}
+
+
+
+/** ***************************************************************************
+* @brief  Calculate the intersection of segment and the cone. In the local
+*         frame the cone is x^2 + y^2 = (R + z*tan(a))^2, only the nappe on
+*         which R + z*tan(a) >= 0 is considered, and only the part within
+*         [VMin,VMax], which is the extended cone used for collision
+*         detection.
+* @param  const gp_Pnt &thePntA, &thePntB   The end points of segment
+*         const gp_Cone &theCone            Cone
+*         Standard_Real theVMin, theVMax    V range of the cone face
+*         Standard_Real theTol              Distance tolerance
+* @return Standard_Integer                  Number of intersected points
+*         Standard_Real theParam[2]         Parameters of intersected points
+*
+* @date 19/10/2026
+* @author  agent
+******************************************************************************/
+Standard_Integer McCadQuadricIntersect::SegmentCone(const gp_Pnt &thePntA,
+                                                    const gp_Pnt &thePntB,
+                                                    const gp_Cone &theCone,
+                                                    Standard_Real theVMin,
+                                                    Standard_Real theVMax,
+                                                    Standard_Real theTol,
+                                                    Standard_Real theParam[2])
+{
+    Standard_Real fLength = thePntA.Distance(thePntB);
+    if (fLength <= theTol)
+    {
+        return 0;
+    }
+
+    Standard_Real ax, ay, az, bx, by, bz;
+    ToLocal(theCone.Position(), thePntA, ax, ay, az);
+    ToLocal(theCone.Position(), thePntB, bx, by, bz);
+
+    Standard_Real dx = bx - ax;
+    Standard_Real dy = by - ay;
+    Standard_Real dz = bz - az;
+    Standard_Real k  = tan(theCone.SemiAngle());
+    Standard_Real R  = theCone.RefRadius();
+    Standard_Real rA = R + k*az;    // Radius of cone at the height of point A
+
+    Standard_Real A = dx*dx + dy*dy - k*k*dz*dz;
+    Standard_Real B = 2.0*(ax*dx + ay*dy - k*dz*rA);
+    Standard_Real C = ax*ax + ay*ay - rA*rA;
+
+    Standard_Real root[2];
+    Standard_Integer iNbRoot = SolveQuadratic(A, B, C, root);
+    if (iNbRoot == 0 && Abs(A) > 1.0e-12*fLength*fLength)
+    {
+        Standard_Real t0 = -B/(2.0*A);
+        if (t0 >= 0.0 && t0 <= 1.0)
+        {
+            gp_Pnt pnt(thePntA.XYZ() + t0*(thePntB.XYZ() - thePntA.XYZ()));
+            if (Abs(DistCone(pnt, theCone)) <= theTol)
+            {
+                root[0] = t0;
+                iNbRoot = 1;
+            }
+        }
+    }
+
+    /// Remove the roots on the opposite nappe of cone
+    Standard_Integer iNum = 0;
+    for (Standard_Integer i = 0; i < iNbRoot; i++)
+    {
+        if (rA + k*root[i]*dz >= -theTol)
+        {
+            theParam[iNum++] = root[i];
+        }
+    }
+
+    /// The V parameter of cone is the length along the generatrix
+    Standard_Real fCos = cos(theCone.SemiAngle());
+    iNum = ClipHeight(iNum, theParam, az, dz, (theVMin - theTol)*fCos, (theVMax + theTol)*fCos);
+    return ClipRoots(iNum, theParam, theTol/fLength);
+}
+
+
+
+/** ***************************************************************************
+* @brief  Approximated signed distance between point and cone, positive
+*         outside. The radial distance is projected to the normal of the cone
+*         surface, the points beyond the apex use the distance to apex.
+* @param  const gp_Pnt &thePnt
+*         const gp_Cone &theCone
+* @return Standard_Real
+*
+* @date 19/10/2026
+* @author  agent
+******************************************************************************/
+Standard_Real McCadQuadricIntersect::DistCone(const gp_Pnt &thePnt, const gp_Cone &theCone)
+{
+    Standard_Real x, y, z;
+    ToLocal(theCone.Position(), thePnt, x, y, z);
+
+    Standard_Real fAngle = theCone.SemiAngle();
+    Standard_Real rCone  = theCone.RefRadius() + z*tan(fAngle);
+    if (rCone < 0.0)
+    {
+        return thePnt.Distance(theCone.Apex());
+    }
+    return (sqrt(x*x + y*y) - rCone)*cos(fAngle);
+}
+
+
+
+/** ***************************************************************************
+* @brief  The point located on the plane of triangle is inside the triangle
+*         or not, the barycentric coordinates are used.
+* @param  const gp_Pnt &thePnt
+*         const gp_Pnt &thePntA, &thePntB, &thePntC  Vertexes of triangle
+*         Standard_Real theTol
+* @return Standard_Boolean
+*
+* @date 19/10/2026
+* @author  agent
+******************************************************************************/
+Standard_Boolean McCadQuadricIntersect::IsPntInTriangle(const gp_Pnt &thePnt,
+                                                        const gp_Pnt &thePntA,
+                                                        const gp_Pnt &thePntB,
+                                                        const gp_Pnt &thePntC,
+                                                        Standard_Real theTol)
+{
+    gp_Vec v0(thePntA, thePntC);
+    gp_Vec v1(thePntA, thePntB);
+    gp_Vec v2(thePntA, thePnt);
+
+    Standard_Real d00 = v0.Dot(v0);
+    Standard_Real d01 = v0.Dot(v1);
+    Standard_Real d11 = v1.Dot(v1);
+    Standard_Real d20 = v2.Dot(v0);
+    Standard_Real d21 = v2.Dot(v1);
+
+    Standard_Real fDenom = d00*d11 - d01*d01;
+    if (fDenom <= 1.0e-300)
+    {
+        return Standard_False;  // Degenerated triangle
+    }
+
+    Standard_Real u = (d11*d20 - d01*d21)/fDenom;
+    Standard_Real v = (d00*d21 - d01*d20)/fDenom;
+
+    Standard_Real fParTol = theTol/sqrt(Max(d00, d11));
+    return (u >= -fParTol && v >= -fParTol && u + v <= 1.0 + fParTol);
+}
+
+
+
+/** ***************************************************************************
+* @brief  Calculate the point where the axis passes through the plane of
+*         triangle, and judge it is inside the triangle or not.
+* @param  const gp_Ax3 &theAxis
+*         const gp_Pnt &thePntA, &thePntB, &thePntC
+*         Standard_Real theTol
+* @return Standard_Boolean
+*         gp_Pnt &thePierce     The intersected point of axis and plane
+*
+* @date 19/10/2026
+* @author  agent
+******************************************************************************/
+Standard_Boolean McCadQuadricIntersect::AxisPierceTriangle(const gp_Ax3 &theAxis,
+                                                           const gp_Pnt &thePntA,
+                                                           const gp_Pnt &thePntB,
+                                                           const gp_Pnt &thePntC,
+                                                           Standard_Real theTol,
+                                                           gp_Pnt &thePierce)
+{
+    gp_Vec vecNorm = gp_Vec(thePntA, thePntB).Crossed(gp_Vec(thePntA, thePntC));
+    Standard_Real fNorm = vecNorm.Magnitude();
+    if (fNorm <= 1.0e-300)
+    {
+        return Standard_False;
+    }
+
+    gp_Vec vecDir(theAxis.Direction());
+    Standard_Real fDenom = vecNorm.Dot(vecDir);
+
+    /// The axis is parallel with the triangle, the section curves are not
+    /// closed and they must cross the edges of triangle.
+    if (Abs(fDenom) <= 1.0e-9*fNorm)
+    {
+        return Standard_False;
+    }
+
+    Standard_Real s = vecNorm.Dot(gp_Vec(theAxis.Location(), thePntA))/fDenom;
+    thePierce = theAxis.Location().Translated(s*vecDir);
+
+    return IsPntInTriangle(thePierce, thePntA, thePntB, thePntC, theTol);
+}
+
+
+
+/** ***************************************************************************
+* @brief  If all vertexes of triangle are outside the cylinder and no edge
+*         crosses it, the cylinder can still go through the interior of the
+*         triangle. The section is an ellipse around the point where the axis
+*         pierces the triangle plane, so they are collied only if this point
+*         is inside the triangle. The ellipse reaches r*tan(b) above and below
+*         this point along the axis, b is the angle between the axis and the
+*         normal of triangle, it must overlap the V range of the face.
+* @param  const gp_Pnt &thePntA, &thePntB, &thePntC
+*         const gp_Cylinder &theCyln
+*         Standard_Real theVMin, theVMax    V range of the cylinder face
+*         Standard_Real theTol
+* @return Standard_Boolean
+*
+* @date 19/10/2026
+* @author  agent
+******************************************************************************/
+Standard_Boolean McCadQuadricIntersect::CylinderInTriangle(const gp_Pnt &thePntA,
+                                                           const gp_Pnt &thePntB,
+                                                           const gp_Pnt &thePntC,
+                                                           const gp_Cylinder &theCyln,
+                                                           Standard_Real theVMin,
+                                                           Standard_Real theVMax,
+                                                           Standard_Real theTol)
+{
+    gp_Pnt pntPierce;
+    if (!AxisPierceTriangle(theCyln.Position(), thePntA, thePntB, thePntC,
+                            theTol, pntPierce))
+    {
+        return Standard_False;
+    }
+
+    gp_Vec vecNorm = gp_Vec(thePntA, thePntB).Crossed(gp_Vec(thePntA, thePntC));
+    Standard_Real fCos = Abs(vecNorm.Normalized().Dot(gp_Vec(theCyln.Axis().Direction())));
+    Standard_Real fHalf = theCyln.Radius()*sqrt(Max(0.0, 1.0 - fCos*fCos))/fCos;
+
+    Standard_Real x, y, z;
+    ToLocal(theCyln.Position(), pntPierce, x, y, z);
+    return z - fHalf <= theVMax + theTol && z + fHalf >= theVMin - theTol;
+}
+
+
+
+/** ***************************************************************************
+* @brief  The same as CylinderInTriangle, besides the pierced point must be
+*         located inside the cone, otherwise the section is open or empty.
+*         The section is inside the triangle, so it is on the face only if
+*         the heights of triangle overlap the V range of the face.
+* @param  const gp_Pnt &thePntA, &thePntB, &thePntC
+*         const gp_Cone &theCone
+*         Standard_Real theVMin, theVMax    V range of the cone face
+*         Standard_Real theTol
+* @return Standard_Boolean
+*
+* @date 19/10/2026
+* @author  agent
+******************************************************************************/
+Standard_Boolean McCadQuadricIntersect::ConeInTriangle(const gp_Pnt &thePntA,
+                                                       const gp_Pnt &thePntB,
+                                                       const gp_Pnt &thePntC,
+                                                       const gp_Cone &theCone,
+                                                       Standard_Real theVMin,
+                                                       Standard_Real theVMax,
+                                                       Standard_Real theTol)
+{
+    gp_Pnt pntPierce;
+    if (!AxisPierceTriangle(theCone.Position(), thePntA, thePntB, thePntC,
+                            theTol, pntPierce))
+    {
+        return Standard_False;
+    }
+    if (DistCone(pntPierce, theCone) >= -theTol)
+    {
+        return Standard_False;
+    }
+
+    Standard_Real x, y, z[3];
+    ToLocal(theCone.Position(), thePntA, x, y, z[0]);
+    ToLocal(theCone.Position(), thePntB, x, y, z[1]);
+    ToLocal(theCone.Position(), thePntC, x, y, z[2]);
+
+    Standard_Real fCos = cos(theCone.SemiAngle());
+    Standard_Real zMin = Min(z[0], Min(z[1], z[2]));
+    Standard_Real zMax = Max(z[0], Max(z[1], z[2]));
+    return zMin <= (theVMax + theTol)*fCos && zMax >= (theVMin - theTol)*fCos;
+}
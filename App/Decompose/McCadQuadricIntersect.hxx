@@ -0,0 +1,105 @@
+#ifndef MCCADQUADRICINTERSECT_HXX
+#define MCCADQUADRICINTERSECT_HXX
+
+#include <Standard.hxx>
+#include <gp_Pnt.hxx>
+#include <gp_Ax3.hxx>
+#include <gp_Cylinder.hxx>
+#include <gp_Cone.hxx>
+
+/** Analytic intersection of straight segments and triangles with the quadric
+    surfaces used in the decomposition. The equations are solved in the local
+    frame of the surface, so no TopoDS edge or face needs to be built. */
+class McCadQuadricIntersect
+{
+public:
+
+    void* operator new(size_t,void* anAddress)
+    {
+        return anAddress;
+    }
+    void* operator new(size_t size)
+    {
+        return Standard::Allocate(size);
+    }
+    void  operator delete(void *anAddress)
+    {
+        if (anAddress) Standard::Free((Standard_Address&)anAddress);
+    }
+
+    McCadQuadricIntersect();
+
+public:
+
+    /**< Intersect segment AB with the cylinder within [VMin,VMax], return the number of parameters */
+    static Standard_Integer SegmentCylinder(const gp_Pnt &thePntA,
+                                            const gp_Pnt &thePntB,
+                                            const gp_Cylinder &theCyln,
+                                            Standard_Real theVMin,
+                                            Standard_Real theVMax,
+                                            Standard_Real theTol,
+                                            Standard_Real theParam[2]);
+    /**< Intersect segment AB with the nappe of cone within [VMin,VMax] */
+    static Standard_Integer SegmentCone(const gp_Pnt &thePntA,
+                                        const gp_Pnt &thePntB,
+                                        const gp_Cone &theCone,
+                                        Standard_Real theVMin,
+                                        Standard_Real theVMax,
+                                        Standard_Real theTol,
+                                        Standard_Real theParam[2]);
+    /**< The cylinder cuts the interior of the triangle without crossing its edges */
+    static Standard_Boolean CylinderInTriangle(const gp_Pnt &thePntA,
+                                               const gp_Pnt &thePntB,
+                                               const gp_Pnt &thePntC,
+                                               const gp_Cylinder &theCyln,
+                                               Standard_Real theVMin,
+                                               Standard_Real theVMax,
+                                               Standard_Real theTol);
+    /**< The cone cuts the interior of the triangle without crossing its edges */
+    static Standard_Boolean ConeInTriangle(const gp_Pnt &thePntA,
+                                           const gp_Pnt &thePntB,
+                                           const gp_Pnt &thePntC,
+                                           const gp_Cone &theCone,
+                                           Standard_Real theVMin,
+                                           Standard_Real theVMax,
+                                           Standard_Real theTol);
+    /**< Approximated signed distance between point and cone, positive outside */
+    static Standard_Real DistCone(const gp_Pnt &thePnt, const gp_Cone &theCone);
+
+private:
+
+    /**< Transform the point into the local coordinate system */
+    static void ToLocal(const gp_Ax3 &theAxis, const gp_Pnt &thePnt,
+                        Standard_Real &x, Standard_Real &y, Standard_Real &z);
+    /**< Solve the quadratic equation A*t^2 + B*t + C = 0 */
+    static Standard_Integer SolveQuadratic(Standard_Real A,
+                                           Standard_Real B,
+                                           Standard_Real C,
+                                           Standard_Real theRoot[2]);
+    /**< Keep the roots inside [0,1] and remove the repeated ones */
+    static Standard_Integer ClipRoots(Standard_Integer iNbRoot,
+                                      Standard_Real theRoot[2],
+                                      Standard_Real theParTol);
+    /**< Keep the roots whose height along the axis is inside the range */
+    static Standard_Integer ClipHeight(Standard_Integer iNbRoot,
+                                       Standard_Real theRoot[2],
+                                       Standard_Real z0,
+                                       Standard_Real dz,
+                                       Standard_Real theZMin,
+                                       Standard_Real theZMax);
+    /**< The point on the triangle plane is inside the triangle or not */
+    static Standard_Boolean IsPntInTriangle(const gp_Pnt &thePnt,
+                                            const gp_Pnt &thePntA,
+                                            const gp_Pnt &thePntB,
+                                            const gp_Pnt &thePntC,
+                                            Standard_Real theTol);
+    /**< Intersect the axis with the plane of triangle */
+    static Standard_Boolean AxisPierceTriangle(const gp_Ax3 &theAxis,
+                                               const gp_Pnt &thePntA,
+                                               const gp_Pnt &thePntB,
+                                               const gp_Pnt &thePntC,
+                                               Standard_Real theTol,
+                                               gp_Pnt &thePierce);
+};
+
+#endif // MCCADQUADRICINTERSECT_HXX
@@ -1,5 +1,7 @@
 #include "McCadSelSplitSurf.hxx"
 #include "McCadBndSurfCylinder.hxx"
+#include "McCadSurfRegistry.hxx"
+#include "../Tools/McCadConvertConfig.hxx"
 
 McCadSelSplitSurf::McCadSelSplitSurf()
 {
@@ -101,6 +103,7 @@ void McCadSelSplitSurf::GenSplitSurfList(vector<McCadSurface*> & face_list,
         if (selface_list.size() > 1)
         {
             SortSurfaces(selface_list);
+            SortByReuse(selface_list);
         }
         return;
     }
@@ -128,6 +131,7 @@ void McCadSelSplitSurf::GenSplitSurfList(vector<McCadSurface*> & face_list,
         if (selface_list.size() > 1)
         {
             SortSurfaces(selface_list);
+            SortByReuse(selface_list);
         }
         return;
     }
@@ -143,6 +147,7 @@ void McCadSelSplitSurf::GenSplitSurfList(vector<McCadSurface*> & face_list,
     }
 
     SortSurfaces(selface_list);
+    SortByReuse(selface_list);
     return;
 }
 
@@ -321,3 +326,52 @@ void McCadSelSplitSurf::SortSurfaces(vector<McCadSurface *> &face_list)
 //        }
 //    }
 }
+
+
+
+
+/** ***************************************************************************
+* @brief  Move the surfaces which have been used in the model before the new
+*         surfaces with same priority, the number of concave edges through and
+*         the number of boundary surfaces split. The bubble sort keeps the
+*         order of the others.
+* @param  vector<McCadSurface*> & face_list
+* @return Void
+*
+* @date 19/10/2026
+* @author  agent
+******************************************************************************/
+void McCadSelSplitSurf::SortByReuse(vector<McCadSurface *> &face_list)
+{
+    if (face_list.size() < 2 || !McCadConvertConfig::ReuseSurfaces())
+    {
+        return;
+    }
+
+    vector<Standard_Boolean> reuse_list;
+    for(unsigned int i = 0; i < face_list.size(); i++)
+    {
+        reuse_list.push_back(McCadSurfRegistry::Contains(*face_list.at(i)));
+    }
+
+    for(unsigned int i = 0; i < face_list.size() - 1; i++)
+    {
+        for (unsigned int j = 0; j < face_list.size() - 1 - i; j++)
+        {
+            McCadSurface * pSurfA = face_list.at(j);
+            McCadSurface * pSurfB = face_list.at(j+1);
+
+            if (reuse_list.at(j) || !reuse_list.at(j+1))
+            {
+                continue;
+            }
+
+            if (pSurfA->GetThroughConcaveEdges() == pSurfB->GetThroughConcaveEdges()
+                && pSurfA->GetSplitSurfNum() == pSurfB->GetSplitSurfNum())
+            {
+                swap(face_list.at(j),face_list.at(j+1));
+                swap(reuse_list.at(j),reuse_list.at(j+1));
+            }
+        }
+    }
+}
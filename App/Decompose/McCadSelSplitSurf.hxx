@@ -42,6 +42,8 @@ private:
 
     /**< Sort the surfaces with different conditions*/
     void SortSurfaces(vector<McCadSurface*> & face_list);
+    /**< Prefer the surfaces used in the model among the surfaces with same priority */
+    void SortByReuse(vector<McCadSurface*> & face_list);
 };
 
 #endif // MCCADSELSPLITSURF_HXX
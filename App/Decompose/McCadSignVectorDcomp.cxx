@@ -0,0 +1,920 @@
+#include "McCadSignVectorDcomp.hxx"
+
+#include <map>
+#include <math.h>
+
+#include <BRep_Tool.hxx>
+#include <BRepAdaptor_Surface.hxx>
+#include <BRepBndLib.hxx>
+#include <BRepAlgoAPI_Common.hxx>
+#include <BRepBuilderAPI_MakeFace.hxx>
+#include <BRepPrimAPI_MakeBox.hxx>
+#include <BRepPrimAPI_MakeHalfSpace.hxx>
+#include <BRepGProp.hxx>
+#include <GProp_GProps.hxx>
+#include <Bnd_Box.hxx>
+#include <ElSLib.hxx>
+#include <Geom_Surface.hxx>
+#include <TColgp_HSequenceOfPnt.hxx>
+#include <TopTools_HSequenceOfShape.hxx>
+#include <TopTools_ListOfShape.hxx>
+#include <TopoDS.hxx>
+#include <TopExp_Explorer.hxx>
+#include <gp_Cone.hxx>
+#include <gp_Cylinder.hxx>
+#include <gp_Pln.hxx>
+#include <gp_Sphere.hxx>
+
+#include <Standard_Version.hxx>
+#if OCC_VERSION_HEX >= 0x070200
+#include <BOPAlgo_CellsBuilder.hxx>
+#endif
+
+#include "../Tools/McCadGeomTool.hxx"
+#include "../Tools/McCadEvaluator.hxx"
+#include "../Tools/McCadConvertConfig.hxx"
+
+#include "../Convertor/IGeomFace.hxx"
+#include "../Convertor/McCadGeomPlane.hxx"
+#include "../Convertor/McCadGeomCylinder.hxx"
+#include "../Convertor/McCadGeomCone.hxx"
+#include "../Convertor/McCadGeomSphere.hxx"
+
+McCadSignVectorDcomp::McCadSignVectorDcomp(const TopoDS_Solid &theSolid)
+{
+    m_InputSolid = theSolid;
+    m_CellSolidList = new TopTools_HSequenceOfShape();
+
+    Bnd_Box bndBox;
+    BRepBndLib::Add(m_InputSolid, bndBox);
+    bndBox.SetGap(0.0);
+    m_fTol = Max(1.0e-6, 1.0e-6*sqrt(bndBox.SquareExtent()));
+}
+
+McCadSignVectorDcomp::~McCadSignVectorDcomp()
+{
+    m_SurfList.clear();
+    m_AdpSurfList.clear();
+    m_CellList.clear();
+    m_CellSolidList->Clear();
+}
+
+
+
+/** ***************************************************************************
+* @brief  The solid is bounded only by planes, cylinders, cones and spheres,
+*         the position of a point to them is given by the sign of evaluation
+* @param  TopoDS_Solid &theSolid
+* @return Standard_Boolean
+*
+* @date 19/10/2026
+* @author  agent
+******************************************************************************/
+Standard_Boolean McCadSignVectorDcomp::IsAnalyticSolid(const TopoDS_Solid &theSolid)
+{
+    for(TopExp_Explorer exF(theSolid,TopAbs_FACE); exF.More(); exF.Next())
+    {
+        BRepAdaptor_Surface BS(TopoDS::Face(exF.Current()), Standard_True);
+        GeomAbs_SurfaceType surfType = BS.GetType();
+        if(surfType != GeomAbs_Plane && surfType != GeomAbs_Cylinder
+           && surfType != GeomAbs_Cone && surfType != GeomAbs_Sphere)
+        {
+            return Standard_False;
+        }
+    }
+    return Standard_True;
+}
+
+
+
+/** ***************************************************************************
+* @brief  Generate the cells, merge them and check them with other points.
+*         The cells come from sampling, so their solids are built and the
+*         total volume is compared with the solid. If the cells can not
+*         represent the solid, the solid is decomposed with boolean
+*         operations as before.
+* @param
+* @return Standard_Boolean
+*
+* @date 19/10/2026
+* @author  agent
+******************************************************************************/
+Standard_Boolean McCadSignVectorDcomp::Perform()
+{
+    if(!GenSignVectors())
+    {
+        return Standard_False;
+    }
+
+    if(!Validate())
+    {
+        return Standard_False;
+    }
+
+    return GenCellSolids();
+}
+
+
+
+/** ***************************************************************************
+* @brief  Collect the surfaces, generate the sign vectors of the cells and
+*         merge them. No solid is built, it is enough for the tests on the
+*         cells such as IsSingleCell.
+* @param
+* @return Standard_Boolean
+*
+* @date 19/10/2026
+* @author  agent
+******************************************************************************/
+Standard_Boolean McCadSignVectorDcomp::GenSignVectors()
+{
+    GenSurfaces();
+
+    if(!GenCells())
+    {
+        return Standard_False;
+    }
+
+    MergeCells();
+    return Standard_True;
+}
+
+
+
+/** ***************************************************************************
+* @brief  Collect the different boundary surfaces, the faces on the same
+*         surface with either orientation are one surface
+* @param
+* @return void
+*
+* @date 19/10/2026
+* @author  agent
+******************************************************************************/
+void McCadSignVectorDcomp::GenSurfaces()
+{
+    Bnd_Box bndBox;
+    BRepBndLib::Add(m_InputSolid, bndBox);
+    Standard_Real fLength = sqrt(bndBox.SquareExtent());
+
+    for(TopExp_Explorer exF(m_InputSolid,TopAbs_FACE); exF.More(); exF.Next())
+    {
+        TopoDS_Face face = TopoDS::Face(exF.Current().Oriented(TopAbs_FORWARD));
+
+        Standard_Boolean bFound = Standard_False;
+        for(unsigned int i = 0; i < m_SurfList.size(); i++)
+        {
+            if(McCadGeomTool::IsSameSurfaces(m_SurfList.at(i),face))
+            {
+                bFound = Standard_True;
+                break;
+            }
+        }
+        if(bFound)
+        {
+            continue;
+        }
+
+        GeomAdaptor_Surface AdpSurf(BRep_Tool::Surface(face));
+
+        /// The quadric value grows with the radius, scale the tolerance with it
+        Standard_Real fScale = 1.0;
+        switch(AdpSurf.GetType())
+        {
+            case GeomAbs_Cylinder:
+                fScale = 2.0*AdpSurf.Cylinder().Radius();
+                break;
+            case GeomAbs_Sphere:
+                fScale = 2.0*AdpSurf.Sphere().Radius();
+                break;
+            case GeomAbs_Cone:
+            {
+                gp_Cone cone = AdpSurf.Cone();
+                fScale = 2.0*Max(cone.RefRadius(), fLength*tan(cone.SemiAngle()));
+                break;
+            }
+            default:
+                break;
+        }
+
+        m_SurfList.push_back(face);
+        m_AdpSurfList.push_back(AdpSurf);
+        m_ScaleList.push_back(Max(fScale,1.0));
+    }
+}
+
+
+
+/** ***************************************************************************
+* @brief  Generate the sample points, the grid points in the box of solid and
+*         the points moved a little from the boundary faces into the solid,
+*         which catch the thin cells along the faces.
+* @param  vector<gp_Pnt> &thePntList
+*         Standard_Real fShift  ( Position of the points in grid step, 0~1 )
+* @return void
+*
+* @date 19/10/2026
+* @author  agent
+******************************************************************************/
+void McCadSignVectorDcomp::GenSamplePoints(vector<gp_Pnt> &thePntList, Standard_Real fShift)
+{
+    Bnd_Box bndBox;
+    BRepBndLib::Add(m_InputSolid, bndBox);
+    bndBox.SetGap(0.0);
+
+    Standard_Real aXmin, aYmin, aZmin, aXmax, aYmax, aZmax;
+    bndBox.Get(aXmin, aYmin, aZmin, aXmax, aYmax, aZmax);
+
+    Standard_Integer iNum = McCadConvertConfig::GetMinSmplPntNum();
+    Standard_Real dx = (aXmax - aXmin)/iNum;
+    Standard_Real dy = (aYmax - aYmin)/iNum;
+    Standard_Real dz = (aZmax - aZmin)/iNum;
+
+    for(int i = 0; i < iNum; i++)
+    {
+        for(int j = 0; j < iNum; j++)
+        {
+            for(int k = 0; k < iNum; k++)
+            {
+                thePntList.push_back(gp_Pnt(aXmin + (i+fShift)*dx,
+                                            aYmin + (j+fShift)*dy,
+                                            aZmin + (k+fShift)*dz));
+            }
+        }
+    }
+
+    Standard_Real fOffset = 2.0e-3*fShift*sqrt(bndBox.SquareExtent());
+    for(TopExp_Explorer exF(m_InputSolid,TopAbs_FACE); exF.More(); exF.Next())
+    {
+        TopoDS_Face face = TopoDS::Face(exF.Current());
+        Handle_TColgp_HSequenceOfPnt pnt_list = McCadGeomTool::GetFaceSamplePnt(face);
+        for(int i = 1; i <= pnt_list->Length(); i++)
+        {
+            gp_Pnt pnt = pnt_list->Value(i);
+            gp_Dir dir = McCadGeomTool::NormalOnFace(face,pnt);   // Normal into the solid
+            thePntList.push_back(pnt.Translated(gp_Vec(dir)*fOffset));
+        }
+    }
+}
+
+
+
+/** ***************************************************************************
+* @brief  Sign of the point to each surface
+* @param  gp_Pnt &thePnt
+*         vector<Standard_Integer> &theSigns
+* @return Standard_Boolean ( False if the point is on one of the surfaces )
+*
+* @date 19/10/2026
+* @author  agent
+******************************************************************************/
+Standard_Boolean McCadSignVectorDcomp::SignVector(const gp_Pnt &thePnt,
+                                                  vector<Standard_Integer> &theSigns)
+{
+    theSigns.clear();
+    for(unsigned int i = 0; i < m_AdpSurfList.size(); i++)
+    {
+        Standard_Real aVal = McCadEvaluator::Evaluate(m_AdpSurfList.at(i),thePnt);
+        if(Abs(aVal) <= m_fTol*m_ScaleList.at(i))
+        {
+            return Standard_False;
+        }
+        theSigns.push_back(aVal > 0 ? 1 : -1);
+    }
+    return Standard_True;
+}
+
+
+
+/** ***************************************************************************
+* @brief  Classify the sample points, the sign vectors of inner points are
+*         the cells. A sign vector with both inner and outer points means the
+*         region is not connected and its parts are not all in the solid.
+* @param
+* @return Standard_Boolean
+*
+* @date 19/10/2026
+* @author  agent
+******************************************************************************/
+Standard_Boolean McCadSignVectorDcomp::GenCells()
+{
+    vector<gp_Pnt> pnt_list;
+    GenSamplePoints(pnt_list,0.5);
+
+    map< vector<Standard_Integer>, Standard_Integer > mapState;  // 1 inside, -1 outside
+    BRepClass3d_SolidClassifier bsc3d(m_InputSolid);
+
+    for(unsigned int i = 0; i < pnt_list.size(); i++)
+    {
+        vector<Standard_Integer> sign_list;
+        if(!SignVector(pnt_list.at(i),sign_list))
+        {
+            continue;
+        }
+
+        bsc3d.Perform(pnt_list.at(i),m_fTol);
+        Standard_Integer iState = 0;
+        if(bsc3d.State() == TopAbs_IN)
+        {
+            iState = 1;
+        }
+        else if(bsc3d.State() == TopAbs_OUT)
+        {
+            iState = -1;
+        }
+        else
+        {
+            continue;
+        }
+
+        map< vector<Standard_Integer>, Standard_Integer >::iterator iter = mapState.find(sign_list);
+        if(iter == mapState.end())
+        {
+            mapState[sign_list] = iState;
+        }
+        else if(iter->second != iState)
+        {
+            cout<<"#Sign vector region is partly inside the solid, use boolean decomposition"<<endl;
+            return Standard_False;
+        }
+    }
+
+    map< vector<Standard_Integer>, Standard_Integer >::iterator iter;
+    for(iter = mapState.begin(); iter != mapState.end(); iter++)
+    {
+        if(iter->second > 0)
+        {
+            m_CellList.push_back(iter->first);
+        }
+    }
+
+    return !m_CellList.empty();
+}
+
+
+
+/** ***************************************************************************
+* @brief  Merge two cells with opposite signs on only one surface, the union
+*         does not depend on that surface. Repeat until no cells are merged.
+* @param
+* @return void
+*
+* @date 19/10/2026
+* @author  agent
+******************************************************************************/
+void McCadSignVectorDcomp::MergeCells()
+{
+    Standard_Boolean bMerged = Standard_True;
+    while(bMerged)
+    {
+        bMerged = Standard_False;
+        for(unsigned int i = 0; i < m_CellList.size(); i++)
+        {
+            for(unsigned int j = i+1; j < m_CellList.size(); j++)
+            {
+                vector<Standard_Integer> &cellA = m_CellList.at(i);
+                vector<Standard_Integer> &cellB = m_CellList.at(j);
+
+                Standard_Integer iDiff = -1;
+                Standard_Integer iDiffNum = 0;
+                for(unsigned int k = 0; k < cellA.size(); k++)
+                {
+                    if(cellA.at(k) == cellB.at(k))
+                    {
+                        continue;
+                    }
+                    iDiffNum++;
+                    iDiff = k;
+                    if(cellA.at(k) == 0 || cellB.at(k) == 0 || iDiffNum > 1)
+                    {
+                        iDiffNum = 2;
+                        break;
+                    }
+                }
+
+                if(iDiffNum != 1)
+                {
+                    continue;
+                }
+
+                cellA.at(iDiff) = 0;
+                m_CellList.erase(m_CellList.begin()+j);
+                bMerged = Standard_True;
+                j = i;
+            }
+        }
+    }
+}
+
+
+
+/** ***************************************************************************
+* @brief  The point is in one of the cells or not
+* @param  vector<Standard_Integer> &theSigns
+* @return Standard_Boolean
+*
+* @date 19/10/2026
+* @author  agent
+******************************************************************************/
+Standard_Boolean McCadSignVectorDcomp::IsInCells(const vector<Standard_Integer> &theSigns)
+{
+    for(unsigned int i = 0; i < m_CellList.size(); i++)
+    {
+        const vector<Standard_Integer> &cell = m_CellList.at(i);
+
+        Standard_Boolean bIn = Standard_True;
+        for(unsigned int k = 0; k < cell.size(); k++)
+        {
+            if(cell.at(k) != 0 && cell.at(k) != theSigns.at(k))
+            {
+                bIn = Standard_False;
+                break;
+            }
+        }
+        if(bIn)
+        {
+            return Standard_True;
+        }
+    }
+    return Standard_False;
+}
+
+
+
+/** ***************************************************************************
+* @brief  Check the cells with the points on another grid, the points in the
+*         solid must be in the cells and the others must not. It finds the
+*         cells missed by the sample points.
+* @param
+* @return Standard_Boolean
+*
+* @date 19/10/2026
+* @author  agent
+******************************************************************************/
+Standard_Boolean McCadSignVectorDcomp::Validate()
+{
+    vector<gp_Pnt> pnt_list;
+    GenSamplePoints(pnt_list,0.25);
+
+    BRepClass3d_SolidClassifier bsc3d(m_InputSolid);
+    for(unsigned int i = 0; i < pnt_list.size(); i++)
+    {
+        vector<Standard_Integer> sign_list;
+        if(!SignVector(pnt_list.at(i),sign_list))
+        {
+            continue;
+        }
+
+        bsc3d.Perform(pnt_list.at(i),m_fTol);
+        if(bsc3d.State() == TopAbs_ON)
+        {
+            continue;
+        }
+
+        Standard_Boolean bInSolid = (bsc3d.State() == TopAbs_IN);
+        if(bInSolid != IsInCells(sign_list))
+        {
+            cout<<"#Sign vector cells do not match the solid, use boolean decomposition"<<endl;
+            return Standard_False;
+        }
+    }
+    return Standard_True;
+}
+
+
+
+/** ***************************************************************************
+* @brief  Create the face of the surface which covers the box of the solid.
+*         The face of cone is on the nappe of the solid, it ends at the apex.
+* @param  Standard_Integer iSurf
+*         gp_Pnt &theCentre  ( Centre of the box )
+*         Standard_Real fLength  ( Diagonal of the box )
+* @return TopoDS_Face
+*
+* @date 19/10/2026
+* @author  agent
+******************************************************************************/
+TopoDS_Face McCadSignVectorDcomp::GenSurfaceFace(Standard_Integer iSurf,
+                                                 const gp_Pnt &theCentre,
+                                                 Standard_Real fLength)
+{
+    const GeomAdaptor_Surface &AdpSurf = m_AdpSurfList.at(iSurf);
+    Standard_Real U = 0.0, V = 0.0;
+
+    switch(AdpSurf.GetType())
+    {
+        case GeomAbs_Plane:
+        {
+            gp_Pln pln = AdpSurf.Plane();
+            ElSLib::Parameters(pln, theCentre, U, V);
+            return BRepBuilderAPI_MakeFace(pln, U-fLength, U+fLength, V-fLength, V+fLength).Face();
+        }
+        case GeomAbs_Cylinder:
+        {
+            gp_Cylinder cyln = AdpSurf.Cylinder();
+            ElSLib::Parameters(cyln, theCentre, U, V);
+            return BRepBuilderAPI_MakeFace(cyln, 0, 2*M_PI, V-fLength, V+fLength).Face();
+        }
+        case GeomAbs_Cone:
+        {
+            gp_Cone cone = AdpSurf.Cone();
+            ElSLib::Parameters(cone, theCentre, U, V);
+            Standard_Real VMin = V-fLength, VMax = V+fLength;
+            Standard_Real VApex = -cone.RefRadius()/sin(cone.SemiAngle());
+            if (V > VApex)
+            {
+                VMin = Max(VMin, VApex);
+            }
+            else
+            {
+                VMax = Min(VMax, VApex);
+            }
+            return BRepBuilderAPI_MakeFace(cone, 0, 2*M_PI, VMin, VMax).Face();
+        }
+        case GeomAbs_Sphere:
+        {
+            return BRepBuilderAPI_MakeFace(AdpSurf.Sphere()).Face();
+        }
+        default:
+            break;
+    }
+    return TopoDS_Face();
+}
+
+
+
+/** ***************************************************************************
+* @brief  Create the half-space solid on the side of the surface with the
+*         given sign of evaluation. The reference point is moved from the
+*         middle of the face along its normal to the side of the sign.
+* @param  Standard_Integer iSurf
+*         Standard_Integer iSign ( 1 positive or -1 negative side )
+*         TopoDS_Face &theFace  ( Face of the surface covering the box )
+*         Standard_Real fOffset  ( Distance of the reference point )
+*         TopoDS_Solid &theHalfSpace
+* @return Standard_Boolean
+*
+* @date 19/10/2026
+* @author  agent
+******************************************************************************/
+Standard_Boolean McCadSignVectorDcomp::GenHalfSpace(Standard_Integer iSurf,
+                                                    Standard_Integer iSign,
+                                                    const TopoDS_Face &theFace,
+                                                    Standard_Real fOffset,
+                                                    TopoDS_Solid &theHalfSpace)
+{
+    BRepAdaptor_Surface BS(theFace, Standard_True);
+    Standard_Real U = (BS.FirstUParameter() + BS.LastUParameter())/2.0;
+    Standard_Real V = (BS.FirstVParameter() + BS.LastVParameter())/2.0;
+
+    gp_Pnt pnt;
+    gp_Vec vecU, vecV;
+    BS.D1(U, V, pnt, vecU, vecV);
+    gp_Vec vecNormal = vecU.Crossed(vecV);
+    if (vecNormal.Magnitude() < 1.0e-12)
+    {
+        return Standard_False;
+    }
+    vecNormal.Normalize();
+
+    gp_Pnt refPnt = pnt.Translated(vecNormal*fOffset);
+    Standard_Real aVal = McCadEvaluator::Evaluate(m_AdpSurfList.at(iSurf), refPnt);
+    if ((aVal > 0 ? 1 : -1) != iSign)
+    {
+        refPnt = pnt.Translated(vecNormal*(-fOffset));
+    }
+
+    theHalfSpace = BRepPrimAPI_MakeHalfSpace(theFace, refPnt).Solid();
+    return Standard_True;
+}
+
+
+
+/** ***************************************************************************
+* @brief  Build the solid of each cell as the common part of the enlarged box
+*         of solid and the half-spaces of its sign vector. The box and the
+*         positive half-spaces of all surfaces are split together once, each
+*         cell takes the parts inside the half-spaces of its positive signs
+*         and outside the ones of its negative signs, so the intersections
+*         are not repeated for every cell. Before OCC 7.2 the cells are the
+*         common parts with the half-spaces one by one. The cells come from
+*         the sample points, a cell missed or grown by the sampling changes
+*         the volume, so the sum of the cell volumes must be the volume of
+*         the solid.
+* @param
+* @return Standard_Boolean
+*
+* @date 19/10/2026
+* @author  agent
+******************************************************************************/
+Standard_Boolean McCadSignVectorDcomp::GenCellSolids()
+{
+    Bnd_Box bndBox;
+    BRepBndLib::Add(m_InputSolid, bndBox);
+    Standard_Real xMin, yMin, zMin, xMax, yMax, zMax;
+    bndBox.Get(xMin, yMin, zMin, xMax, yMax, zMax);
+    Standard_Real fGap = 0.01*sqrt(bndBox.SquareExtent()) + 1.0;
+    xMin -= fGap; yMin -= fGap; zMin -= fGap;
+    xMax += fGap; yMax += fGap; zMax += fGap;
+
+    gp_Pnt theCentre((xMin+xMax)/2.0, (yMin+yMax)/2.0, (zMin+zMax)/2.0);
+    Standard_Real fLength = gp_Pnt(xMin,yMin,zMin).Distance(gp_Pnt(xMax,yMax,zMax));
+    TopoDS_Solid theBox = BRepPrimAPI_MakeBox(gp_Pnt(xMin,yMin,zMin),
+                                              gp_Pnt(xMax,yMax,zMax)).Solid();
+
+    Standard_Real fCellVolume = 0.0;
+    try
+    {
+        vector<TopoDS_Face> face_list;
+        for(unsigned int i = 0; i < m_AdpSurfList.size(); i++)
+        {
+            face_list.push_back(GenSurfaceFace(i, theCentre, fLength));
+        }
+
+#if OCC_VERSION_HEX >= 0x070200
+        /// The positive half-space of every surface, the negative side of a
+        /// cell is the part outside it
+        vector<TopoDS_Solid> half_list(face_list.size());
+        TopTools_ListOfShape listArgument;
+        listArgument.Append(theBox);
+        for(unsigned int k = 0; k < face_list.size(); k++)
+        {
+            if(face_list.at(k).IsNull()
+               || !GenHalfSpace(k, 1, face_list.at(k), 1.0e-3*fLength, half_list.at(k)))
+            {
+                m_CellSolidList->Clear();
+                return Standard_False;
+            }
+            listArgument.Append(half_list.at(k));
+        }
+
+        BOPAlgo_CellsBuilder cellsBuilder;
+        cellsBuilder.SetArguments(listArgument);
+        cellsBuilder.SetRunParallel(Standard_True);
+        cellsBuilder.Perform();
+        if(cellsBuilder.HasErrors())
+        {
+            cout<<"#Sign vector cells can not be built, use boolean decomposition"<<endl;
+            m_CellSolidList->Clear();
+            return Standard_False;
+        }
+
+        for(unsigned int i = 0; i < m_CellList.size(); i++)
+        {
+            const vector<Standard_Integer> &cell = m_CellList.at(i);
+
+            TopTools_ListOfShape listTake, listAvoid;
+            listTake.Append(theBox);
+            for(unsigned int k = 0; k < cell.size(); k++)
+            {
+                if(cell.at(k) > 0)
+                {
+                    listTake.Append(half_list.at(k));
+                }
+                else if(cell.at(k) < 0)
+                {
+                    listAvoid.Append(half_list.at(k));
+                }
+            }
+
+            /// The parts split by the surfaces not bounding the cell are
+            /// fused into the cell again
+            cellsBuilder.RemoveAllFromResult();
+            cellsBuilder.AddToResult(listTake, listAvoid, 1);
+            cellsBuilder.RemoveInternalBoundaries();
+            if(cellsBuilder.HasErrors())
+            {
+                cout<<"#Sign vector cell can not be built, use boolean decomposition"<<endl;
+                m_CellSolidList->Clear();
+                return Standard_False;
+            }
+            TopoDS_Shape theCell = cellsBuilder.Shape();
+#else
+        for(unsigned int i = 0; i < m_CellList.size(); i++)
+        {
+            const vector<Standard_Integer> &cell = m_CellList.at(i);
+
+            TopoDS_Shape theCell = theBox;
+            for(unsigned int k = 0; k < cell.size(); k++)
+            {
+                if(cell.at(k) == 0)
+                {
+                    continue;
+                }
+
+                TopoDS_Solid theHalfSpace;
+                if(face_list.at(k).IsNull()
+                   || !GenHalfSpace(k, cell.at(k), face_list.at(k), 1.0e-3*fLength, theHalfSpace))
+                {
+                    m_CellSolidList->Clear();
+                    return Standard_False;
+                }
+
+                BRepAlgoAPI_Common Common(theCell, theHalfSpace);
+                if(!Common.IsDone())
+                {
+                    cout<<"#Sign vector cell can not be built, use boolean decomposition"<<endl;
+                    m_CellSolidList->Clear();
+                    return Standard_False;
+                }
+                theCell = Common.Shape();
+            }
+#endif
+
+            /// The region of a sign vector may have several parts
+            for(TopExp_Explorer exS(theCell,TopAbs_SOLID); exS.More(); exS.Next())
+            {
+                GProp_GProps GP;
+                BRepGProp::VolumeProperties(exS.Current(), GP);
+                fCellVolume += GP.Mass();
+                m_CellSolidList->Append(exS.Current());
+            }
+        }
+    }
+    catch(Standard_Failure)
+    {
+        Standard_Failure::Caught()->Print(cout); cout << endl;
+        m_CellSolidList->Clear();
+        return Standard_False;
+    }
+
+    GProp_GProps GP;
+    BRepGProp::VolumeProperties(m_InputSolid, GP);
+    Standard_Real fVolume = GP.Mass();
+
+    if(m_CellSolidList->IsEmpty() || Abs(fCellVolume - fVolume) > 1.0e-4*Abs(fVolume))
+    {
+        cout<<"#Sign vector cells change the volume "<<fVolume<<" to "<<fCellVolume
+            <<", use boolean decomposition"<<endl;
+        m_CellSolidList->Clear();
+        return Standard_False;
+    }
+
+    return Standard_True;
+}
+
+
+
+/** ***************************************************************************
+* @brief  Get the solids of the cells, they are the decomposed solids of the
+*         input solid
+* @param  Handle_TopTools_HSequenceOfShape & solid_list
+* @return void
+*
+* @date 19/10/2026
+* @author  agent
+******************************************************************************/
+void McCadSignVectorDcomp::GetCellSolids(Handle_TopTools_HSequenceOfShape & solid_list)
+{
+    solid_list->Append(m_CellSolidList);
+}
+
+
+
+/** ***************************************************************************
+* @brief  Number of the different boundary surfaces
+* @param
+* @return Standard_Integer
+*
+* @date 19/10/2026
+* @author  agent
+******************************************************************************/
+Standard_Integer McCadSignVectorDcomp::GetSurfNum() const
+{
+    return m_AdpSurfList.size();
+}
+
+
+
+/** ***************************************************************************
+* @brief  Number of the cells
+* @param
+* @return Standard_Integer
+*
+* @date 19/10/2026
+* @author  agent
+******************************************************************************/
+Standard_Integer McCadSignVectorDcomp::GetCellNum() const
+{
+    return m_CellList.size();
+}
+
+
+
+/** ***************************************************************************
+* @brief  The solid is one cell and every surface bounds it, so the solid is
+*         the intersection of the half-spaces of its boundary faces.
+* @param
+* @return Standard_Boolean
+*
+* @date 19/10/2026
+* @author  agent
+******************************************************************************/
+Standard_Boolean McCadSignVectorDcomp::IsSingleCell() const
+{
+    if(m_CellList.size() != 1)
+    {
+        return Standard_False;
+    }
+
+    const vector<Standard_Integer> &cell = m_CellList.at(0);
+    for(unsigned int k = 0; k < cell.size(); k++)
+    {
+        if(cell.at(k) == 0)
+        {
+            return Standard_False;
+        }
+    }
+    return Standard_True;
+}
+
+
+
+/** ***************************************************************************
+* @brief  Write the surface cards and cell expressions of the solid. The
+*         surfaces and cells are numbered after the ones of the solids
+*         written before, the sense of a surface is the sign of evaluation,
+*         and it is reversed if the card is reversed.
+* @param  Standard_Integer iSolid ( Number of input solid )
+*         Standard_Integer iSurfOffset ( Surfaces written before )
+*         Standard_Integer iCellOffset ( Cells written before )
+* @return TCollection_AsciiString
+*
+* @date 19/10/2026
+* @author  agent
+******************************************************************************/
+TCollection_AsciiString McCadSignVectorDcomp::GetCellExpressions(Standard_Integer iSolid,
+                                                                 Standard_Integer iSurfOffset,
+                                                                 Standard_Integer iCellOffset)
+{
+    TCollection_AsciiString strExpn = "c Solid ";
+    strExpn += TCollection_AsciiString(iSolid);
+    strExpn += ", ";
+    strExpn += TCollection_AsciiString((Standard_Integer)m_CellList.size());
+    strExpn += " cells\nc Surfaces\n";
+
+    vector<Standard_Integer> reverse_list;
+    for(unsigned int i = 0; i < m_AdpSurfList.size(); i++)
+    {
+        IGeomFace *pGeomFace = NULL;
+        switch(m_AdpSurfList.at(i).GetType())
+        {
+            case GeomAbs_Plane:
+                pGeomFace = new McCadGeomPlane(m_AdpSurfList.at(i));
+                break;
+            case GeomAbs_Cylinder:
+                pGeomFace = new McCadGeomCylinder(m_AdpSurfList.at(i));
+                break;
+            case GeomAbs_Cone:
+                pGeomFace = new McCadGeomCone(m_AdpSurfList.at(i));
+                break;
+            case GeomAbs_Sphere:
+                pGeomFace = new McCadGeomSphere(m_AdpSurfList.at(i));
+                break;
+            default:
+                break;
+        }
+
+        strExpn += TCollection_AsciiString((Standard_Integer)(iSurfOffset+i+1));
+        strExpn += "  ";
+        if(NULL != pGeomFace)
+        {
+            strExpn += pGeomFace->GetExpression();
+            reverse_list.push_back(pGeomFace->IsReversed() ? -1 : 1);
+            delete pGeomFace;
+            pGeomFace = NULL;
+        }
+        else
+        {
+            strExpn += "\n";
+            reverse_list.push_back(1);
+        }
+    }
+
+    strExpn += "c Cells\n";
+    for(unsigned int i = 0; i < m_CellList.size(); i++)
+    {
+        const vector<Standard_Integer> &cell = m_CellList.at(i);
+
+        strExpn += TCollection_AsciiString((Standard_Integer)(iCellOffset+i+1));
+        Standard_Integer iTerm = 0;
+        for(unsigned int k = 0; k < cell.size(); k++)
+        {
+            if(cell.at(k) == 0)
+            {
+                continue;
+            }
+
+            if(iTerm > 0 && iTerm%10 == 0)
+            {
+                strExpn += "\n     ";
+            }
+            strExpn += " ";
+            strExpn += TCollection_AsciiString((Standard_Integer)(cell.at(k)*reverse_list.at(k)
+                                                                  *(iSurfOffset+k+1)));
+            iTerm++;
+        }
+        strExpn += "\n";
+    }
+
+    return strExpn;
+}
@@ -0,0 +1,104 @@
+#ifndef MCCADSIGNVECTORDCOMP_HXX
+#define MCCADSIGNVECTORDCOMP_HXX
+
+#include <vector>
+#include <Standard.hxx>
+#include <TopoDS_Solid.hxx>
+#include <TopoDS_Face.hxx>
+#include <GeomAdaptor_Surface.hxx>
+#include <BRepClass3d_SolidClassifier.hxx>
+#include <TCollection_AsciiString.hxx>
+#include <gp_Pnt.hxx>
+#include <Handle_TopTools_HSequenceOfShape.hxx>
+
+using namespace std;
+
+/** Decompose the solid bounded by planes and quadrics without boolean
+    operations. The solid is kept as its boundary surfaces, every region of
+    the surface arrangement is a sign vector over the surfaces. The points
+    sampled in the box of solid and near the boundary faces are classified,
+    the sign vectors of the inner points are the cells of the solid, and the
+    cells different on only one surface are merged. The cells are written
+    as the intersections of half-spaces directly, and their solids are built
+    from the half-spaces for the conversion. The sum of the cell volumes is
+    compared with the input solid, the kernel fails if they are different. */
+class McCadSignVectorDcomp
+{
+public:
+
+    void* operator new(size_t,void* anAddress)
+    {
+        return anAddress;
+    }
+    void* operator new(size_t size)
+    {
+        return Standard::Allocate(size);
+    }
+    void  operator delete(void *anAddress)
+    {
+        if (anAddress) Standard::Free((Standard_Address&)anAddress);
+    }
+
+    McCadSignVectorDcomp(const TopoDS_Solid &theSolid);
+    ~McCadSignVectorDcomp();
+
+public:
+
+    /**< The solid is bounded only by planes, cylinders, cones and spheres */
+    static Standard_Boolean IsAnalyticSolid(const TopoDS_Solid &theSolid);
+
+    /**< Generate and merge the sign vectors of the cells and build their solids */
+    Standard_Boolean Perform();
+    /**< Generate and merge the sign vectors of the cells without building solids */
+    Standard_Boolean GenSignVectors();
+    /**< Number of the cells */
+    Standard_Integer GetCellNum() const;
+    /**< The solid is one cell bounded by all the surfaces */
+    Standard_Boolean IsSingleCell() const;
+    /**< Number of the different boundary surfaces */
+    Standard_Integer GetSurfNum() const;
+    /**< The surface cards and cell expressions of the solid, numbered after the offsets */
+    TCollection_AsciiString GetCellExpressions(Standard_Integer iSolid,
+                                               Standard_Integer iSurfOffset,
+                                               Standard_Integer iCellOffset);
+    /**< Get the solids of the cells */
+    void GetCellSolids(Handle_TopTools_HSequenceOfShape & solid_list);
+
+private:
+
+    TopoDS_Solid m_InputSolid;                      /**< Input solid */
+    vector<TopoDS_Face> m_SurfList;                 /**< The different boundary surfaces */
+    vector<GeomAdaptor_Surface> m_AdpSurfList;      /**< Adaptor surfaces for evaluation */
+    vector<Standard_Real> m_ScaleList;              /**< Value of evaluation at unit distance */
+    vector< vector<Standard_Integer> > m_CellList;  /**< Sign vectors of cells, 0 is not used */
+    Handle_TopTools_HSequenceOfShape m_CellSolidList;  /**< Solids of the cells */
+    Standard_Real m_fTol;                           /**< Distance tolerance */
+
+private:
+
+    /**< Collect the different boundary surfaces */
+    void GenSurfaces();
+    /**< Grid points in the box and points inside the boundary faces */
+    void GenSamplePoints(vector<gp_Pnt> &thePntList, Standard_Real fShift);
+    /**< Sign of the point to each surface, return false if it is on a surface */
+    Standard_Boolean SignVector(const gp_Pnt &thePnt, vector<Standard_Integer> &theSigns);
+    /**< Classify the sample points and collect the sign vectors of inner points */
+    Standard_Boolean GenCells();
+    /**< Merge the cells different on only one surface */
+    void MergeCells();
+    /**< Check the cells with the points not used for generating them */
+    Standard_Boolean Validate();
+    /**< The point is in one of the cells or not */
+    Standard_Boolean IsInCells(const vector<Standard_Integer> &theSigns);
+    /**< Face of the surface covering the box of solid */
+    TopoDS_Face GenSurfaceFace(Standard_Integer iSurf, const gp_Pnt &theCentre,
+                               Standard_Real fLength);
+    /**< Half-space solid on the given side of the surface */
+    Standard_Boolean GenHalfSpace(Standard_Integer iSurf, Standard_Integer iSign,
+                                  const TopoDS_Face &theFace, Standard_Real fOffset,
+                                  TopoDS_Solid &theHalfSpace);
+    /**< Build the solids of cells and compare their volume with the solid */
+    Standard_Boolean GenCellSolids();
+};
+
+#endif // MCCADSIGNVECTORDCOMP_HXX
@@ -2,7 +2,7 @@
 #include "BRepBuilderAPI_MakeFace.hxx"
 #include "gp_Pln.hxx"
 
-#include "../McCadTool/McCadGeomTool.hxx"
+#include "../Tools/McCadGeomTool.hxx"
 
 McCadSplitConeCone::McCadSplitConeCone()
 {
@@ -13,6 +13,21 @@ McCadSplitConeCone::~McCadSplitConeCone()
 }
 
 
+/** ***************************************************************************
+* @brief  The generator is applicable when the solid has at least two cones
+* @param  McCadDcompSolid     ( Input Solid )
+* @return Standard_Boolean
+*
+* @date 19/10/2026
+* @author  agent
+******************************************************************************/
+Standard_Boolean McCadSplitConeCone::IsApplicable(McCadDcompSolid *& pSolid)
+{
+    return pSolid->m_ConeList.size() >= 2;
+}
+
+
+
 /** ***************************************************************************
 * @brief Given a solid, trace the cones and cones and generate the splitting
 *        surfaces separating the cones
@@ -23,10 +38,10 @@ McCadSplitConeCone::~McCadSplitConeCone()
 * @modify
 * @author  Lei Lu
 ******************************************************************************/
-void McCadSplitConeCone::GenSplitSurfaces( McCadDcompSolid *& pSolid)
+void McCadSplitConeCone::GenSplitSurfaces(McCadDcompSolid *& pSolid,
+                                          vector<McCadAstSurface*> & AstFaceList)
 {
     vector<McCadBndSurface *>  &cone_list    = pSolid->m_ConeList;
-    vector<McCadAstSurface*>   &AstFaceList  = pSolid->m_AstFaceList;
 
     m_fLength = pSolid->m_fBoxSqLength;
 
@@ -125,8 +140,8 @@ Standard_Boolean McCadSplitConeCone::HasComCircleEdge(McCadBndSurfCone *&pSurfA,
             {
                 if (pEdgeA->IsSame(pEdgeB,1.0e-5))
                 {
-                    pEdgeA->SetConvexity(concave);  // Set the convexity of two edges
-                    pEdgeB->SetConvexity(concave);
+                    MarkConvexity(pEdgeA,concave);  // Set the convexity of two edges
+                    MarkConvexity(pEdgeB,concave);
                     pEdge = pEdgeA;
                     return Standard_True;
                 }
@@ -137,8 +152,8 @@ Standard_Boolean McCadSplitConeCone::HasComCircleEdge(McCadBndSurfCone *&pSurfA,
             {
                 if (pEdgeA->IsSame(pEdgeB,1.0e-5))
                 {
-                    pEdgeA->SetConvexity(concave);  // Set the convexity of two edges
-                    pEdgeB->SetConvexity(concave);
+                    MarkConvexity(pEdgeA,concave);  // Set the convexity of two edges
+                    MarkConvexity(pEdgeB,concave);
                     pEdge = pEdgeA;
                     return Standard_True;
                 }
@@ -269,8 +284,8 @@ Standard_Boolean McCadSplitConeCone::HasComLineEdge(McCadBndSurfCone *& pSurfA,
 
             if (pEdgeA->IsSame(pEdgeB,1.0e-5))
             {
-                pEdgeA->SetConvexity(concave);    /// Set the convexities of edgeA and edgeB
-                pEdgeB->SetConvexity(concave);
+                MarkConvexity(pEdgeA,concave);    /// Set the convexities of edgeA and edgeB
+                MarkConvexity(pEdgeB,concave);
 
                 pEdge = pEdgeA;
             }
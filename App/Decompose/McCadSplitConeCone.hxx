@@ -2,11 +2,12 @@
 #define MCCADSPLITCONECONE_HXX
 
 #include "McCadDcompSolid.hxx"
+#include "McCadAstSurfGenerator.hxx"
 #include "McCadAstSurface.hxx"
 #include "McCadBndSurfCone.hxx"
 #include "McCadAstSurfPlane.hxx"
 
-class McCadSplitConeCone
+class McCadSplitConeCone : public McCadAstSurfGenerator
 {
 
 public:
@@ -28,8 +29,10 @@ public:
     ~McCadSplitConeCone();
 
 public:
+    /**< The solid has the surfaces which this generator works on or not */
+    Standard_Boolean IsApplicable(McCadDcompSolid *& pSolid);
     /**< Given the solid, trace the cone surfaces and generate the splitting surface */
-    void GenSplitSurfaces(McCadDcompSolid *& pSolid);
+    void GenSplitSurfaces(McCadDcompSolid *& pSolid, vector<McCadAstSurface*> & AstFaceList);
 
 private:
     /**< Two cones have common circle edges */
@@ -11,6 +11,21 @@ McCadSplitConeCyln::~McCadSplitConeCyln()
 {
 }
 
+/** ***************************************************************************
+* @brief  The generator is applicable when the solid has both cones and cylinders
+* @param  McCadDcompSolid     ( Input Solid )
+* @return Standard_Boolean
+*
+* @date 19/10/2026
+* @author  agent
+******************************************************************************/
+Standard_Boolean McCadSplitConeCyln::IsApplicable(McCadDcompSolid *& pSolid)
+{
+    return !pSolid->m_ConeList.empty() && !pSolid->m_CylinderList.empty();
+}
+
+
+
 /** ***************************************************************************
 * @brief  Trace the cone surfaces and cylinder surfaces and generate the
 *         splitting surfaces
@@ -21,19 +36,19 @@ McCadSplitConeCyln::~McCadSplitConeCyln()
 * @modify 10/03/2017
 * @author  Lei Lu
 ******************************************************************************/
-void McCadSplitConeCyln::GenSplitSurfaces( McCadDcompSolid *& pSolid)
+void McCadSplitConeCyln::GenSplitSurfaces(McCadDcompSolid *& pSolid,
+                                          vector<McCadAstSurface*> & AstFaceList)
 {
     vector<McCadBndSurface *>  &cyln_list    = pSolid->m_CylinderList;
     vector<McCadBndSurface *>  &cone_list    = pSolid->m_ConeList;
-    vector<McCadAstSurface*>   &AstFaceList  = pSolid->m_AstFaceList;
 
     m_fLength = pSolid->m_fBoxSqLength;
 
     //STEPControl_Writer wrt2;
-    for(unsigned int i = 0; i < cyln_list.size()-1; i++ )
+    for(unsigned int i = 0; i < cyln_list.size(); i++ )
     {
         McCadBndSurfCylinder *pBndSurfA = (McCadBndSurfCylinder*)cyln_list.at(i);
-        for(unsigned int j = i+1; j < cone_list.size(); j++ )
+        for(unsigned int j = 0; j < cone_list.size(); j++ )
         {
             McCadBndSurfCone *pBndSurfB = (McCadBndSurfCone*)cone_list.at(j);
 
@@ -50,7 +65,7 @@ void McCadSplitConeCyln::GenSplitSurfaces( McCadDcompSolid *& pSolid)
                 pAstFace->SetCombined(Standard_True); // The assisted surface can not be merged
                 AstFaceList.push_back(pAstFace);
 
-                pBndSurfA->AddCylnCylnSplitEdge(pCurveEdge);
+                RecordCylnCylnSplitEdge(pBndSurfA,pCurveEdge);
                 //20170309 pBndSurfB->AddConeCylnSplitEdge(pCurveEdge);
             }
         }
@@ -92,8 +107,8 @@ Standard_Boolean McCadSplitConeCyln::HasComCircleEdge(McCadBndSurfCylinder *&pSu
 
             if (pEdgeA->IsSame(pEdgeB,1.0e-5))
             {
-                pEdgeA->SetConvexity(flat);  // Set the convexity of two edges
-                pEdgeB->SetConvexity(flat);
+                MarkConvexity(pEdgeA,flat);  // Set the convexity of two edges
+                MarkConvexity(pEdgeB,flat);
                 pEdge = pEdgeA;
                 return Standard_True;
             }
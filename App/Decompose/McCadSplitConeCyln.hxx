@@ -2,12 +2,13 @@
 #define MCCADSPLITCONECYLN_HXX
 
 #include "McCadDcompSolid.hxx"
+#include "McCadAstSurfGenerator.hxx"
 #include "McCadAstSurface.hxx"
 #include "McCadBndSurfCone.hxx"
 #include "McCadBndSurfCylinder.hxx"
 #include "McCadAstSurfPlane.hxx"
 
-class McCadSplitConeCyln
+class McCadSplitConeCyln : public McCadAstSurfGenerator
 {
 public:
 
@@ -29,8 +30,10 @@ public:
 
 public:
 
+    /**< The solid has the surfaces which this generator works on or not */
+    Standard_Boolean IsApplicable(McCadDcompSolid *& pSolid);
     /**< Given a solig, generate the splitting surface */
-    void GenSplitSurfaces(McCadDcompSolid *& pSolid);
+    void GenSplitSurfaces(McCadDcompSolid *& pSolid, vector<McCadAstSurface*> & AstFaceList);
 
 private:
     /**< Detect the common circle edge of cone and cylinder */
@@ -8,7 +8,7 @@
 
 #include <gp_Pln.hxx>
 
-#include "../McCadTool/McCadGeomTool.hxx"
+#include "../Tools/McCadGeomTool.hxx"
 
 McCadSplitConePln::McCadSplitConePln()
 {
@@ -19,6 +19,21 @@ McCadSplitConePln::~McCadSplitConePln()
 }
 
 
+/** ***************************************************************************
+* @brief  The generator is applicable when the solid has both cones and planes
+* @param  McCadDcompSolid     ( Input Solid )
+* @return Standard_Boolean
+*
+* @date 19/10/2026
+* @author  agent
+******************************************************************************/
+Standard_Boolean McCadSplitConePln::IsApplicable(McCadDcompSolid *& pSolid)
+{
+    return !pSolid->m_ConeList.empty() && !pSolid->m_PlaneList.empty();
+}
+
+
+
 /** ***************************************************************************
 * @brief  Generate the assisted surfaces and add them to the assisted splitting
 *         surface list
@@ -29,11 +44,11 @@ McCadSplitConePln::~McCadSplitConePln()
 * @modify 06/03/2017
 * @author  Lei Lu
 ******************************************************************************/
-void McCadSplitConePln::GenSplitSurfaces( McCadDcompSolid *& pSolid)
+void McCadSplitConePln::GenSplitSurfaces(McCadDcompSolid *& pSolid,
+                                         vector<McCadAstSurface*> & AstFaceList)
 {
     vector<McCadBndSurface *>  &cone_list     = pSolid->m_ConeList;
     vector<McCadBndSurface *>  &plane_list    = pSolid->m_PlaneList;
-    vector<McCadAstSurface*>   &AstFaceList   = pSolid->m_AstFaceList;
 
     m_fLength = pSolid->m_fBoxSqLength; // Set the length of created splitting surface
 
@@ -84,7 +99,7 @@ void McCadSplitConePln::GenSplitSurfaces( McCadDcompSolid *& pSolid)
     for(unsigned int i = 0; i < cone_list.size(); i++ )
     {
         McCadBndSurfCone *pBndCone = (McCadBndSurfCone*)cone_list.at(i);
-        if(pBndCone->HasConePlnSplitSurf())
+        if(!GetConePlnSplitEdges(pBndCone).empty())
         {
             CrtSplitSurfaces(pBndCone,AstFaceList);
         }
@@ -137,8 +152,8 @@ Standard_Boolean McCadSplitConePln::FindComLineEdge(McCadBndSurfCone *& pSurfCon
 
                 if(angle < 1.0e-4)
                 {
-                    pEdgeA->SetConvexity(flat);
-                    pEdgeB->SetConvexity(flat);
+                    MarkConvexity(pEdgeA,flat);
+                    MarkConvexity(pEdgeB,flat);
                 }
 
                 if(angle >= 0.5*M_PI && angle <= M_PI)
@@ -147,7 +162,7 @@ Standard_Boolean McCadSplitConePln::FindComLineEdge(McCadBndSurfCone *& pSurfCon
                 }
                 else
                 {
-                    pSurfCone->AddConePlnSplitEdge(pEdgeA);
+                    RecordConePlnSplitEdge(pSurfCone,pEdgeA);
                 }
                 return Standard_True;
             }
@@ -174,10 +189,11 @@ Standard_Boolean McCadSplitConePln::FindComLineEdge(McCadBndSurfCone *& pSurfCon
 void McCadSplitConePln::CrtSplitSurfaces(McCadBndSurfCone *& pConeFace,
                                          vector<McCadAstSurface*> & astFace_list)
 {
-    int iEdgeNum = pConeFace->GetConePlnSplitEdgeList().size();
+    vector<McCadEdge*> edge_list = GetConePlnSplitEdges(pConeFace);
+    int iEdgeNum = edge_list.size();
     if (iEdgeNum  == 1)
     {
-         McCadEdge *pEdge = pConeFace->GetConePlnSplitEdgeList().at(0);
+         McCadEdge *pEdge = edge_list.at(0);
          McCadAstSurfPlane *pAstSplitSurf = CrtSplitSurfThroughLine(pConeFace,pEdge);
          astFace_list.push_back(pAstSplitSurf);
     }
@@ -189,9 +205,9 @@ void McCadSplitConePln::CrtSplitSurfaces(McCadBndSurfCone *& pConeFace,
         /// to split them
         if (radian < M_PI)
         {
-            for(unsigned int i = 0 ; i < pConeFace->GetConePlnSplitEdgeList().size(); i++)
+            for(unsigned int i = 0 ; i < edge_list.size(); i++)
             {
-                McCadEdge *pEdge = pConeFace->GetConePlnSplitEdgeList().at(i);
+                McCadEdge *pEdge = edge_list.at(i);
                 McCadAstSurfPlane *pAstSplitSurf = CrtSplitSurfThroughLine(pConeFace,pEdge);
                 astFace_list.push_back(pAstSplitSurf);
             }
@@ -199,8 +215,8 @@ void McCadSplitConePln::CrtSplitSurfaces(McCadBndSurfCone *& pConeFace,
         else /// if the radian of cylinder is lager than 180 degree, use one splitting
              /// surfaces which connect two edges
         {
-            McCadEdge *pEdgeA = pConeFace->GetConePlnSplitEdgeList().at(0);
-            McCadEdge *pEdgeB = pConeFace->GetConePlnSplitEdgeList().at(1);
+            McCadEdge *pEdgeA = edge_list.at(0);
+            McCadEdge *pEdgeB = edge_list.at(1);
 
             McCadAstSurfPlane* pAstSplitSurf = CrtSplitSurfThroughTwoLines(pEdgeA,pEdgeB);
             astFace_list.push_back(pAstSplitSurf);
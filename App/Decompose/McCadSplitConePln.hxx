@@ -6,11 +6,12 @@
 #include "McCadAstSurfPlane.hxx"
 #include "McCadBndSurfCone.hxx"
 #include "McCadDcompSolid.hxx"
+#include "McCadAstSurfGenerator.hxx"
 #include "McCadBndSurfPlane.hxx"
 
 using namespace std;
 
-class McCadSplitConePln
+class McCadSplitConePln : public McCadAstSurfGenerator
 {
 public:
 
@@ -32,8 +33,10 @@ public:
 
 public:
 
+    /**< The solid has the surfaces which this generator works on or not */
+    Standard_Boolean IsApplicable(McCadDcompSolid *& pSolid);
     /**< Generate assiste splitting surfaces and add into the assisted surface list */
-    void GenSplitSurfaces( McCadDcompSolid *& pSolid );
+    void GenSplitSurfaces(McCadDcompSolid *& pSolid, vector<McCadAstSurface*> & AstFaceList);
 
 private:
 
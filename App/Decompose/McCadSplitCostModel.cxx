@@ -0,0 +1,352 @@
+#include "McCadSplitCostModel.hxx"
+
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <stdlib.h>
+
+#include <BRep_Tool.hxx>
+#include <TopoDS.hxx>
+#include <TopoDS_Edge.hxx>
+#include <TopoDS_Face.hxx>
+#include <TopExp.hxx>
+#include <TopExp_Explorer.hxx>
+#include <TopTools_HSequenceOfShape.hxx>
+#include <TopTools_IndexedDataMapOfShapeListOfShape.hxx>
+#include <TopTools_ListIteratorOfListOfShape.hxx>
+
+#include "McCadDcompSolid.hxx"
+#include "McCadSurfRegistry.hxx"
+#include "../Tools/McCadConvertConfig.hxx"
+#include "../Tools/McCadMathTool.hxx"
+
+Standard_Boolean McCadSplitCostModel::m_bLoaded = Standard_False;
+Standard_Boolean McCadSplitCostModel::m_bFitted = Standard_False;
+Standard_Real McCadSplitCostModel::m_fWeight[McCadSplitCostModel::NbFeature];
+
+McCadSplitCostModel::McCadSplitCostModel()
+{
+}
+
+
+
+/** ***************************************************************************
+* @brief  Estimate the remaining work after splitting. Each concave edge of the
+*         split solids needs at least one more split, and the faces decide the
+*         cost of surface judgement.
+* @param  Handle_TopTools_HSequenceOfShape &solid_list  ( Split solids )
+*         Standard_Boolean bValid   ( The boolean operation succeeded or not )
+* @return Standard_Real
+*
+* @date 19/10/2026
+* @author  agent
+******************************************************************************/
+Standard_Real McCadSplitCostModel::ScoreSplit(Handle_TopTools_HSequenceOfShape &solid_list,
+                                              Standard_Boolean bValid)
+{
+    /// The split which does not separate the solid is not a valid split
+    if(!bValid || solid_list.IsNull() || solid_list->Length() < 2)
+    {
+        return InvalidCost();
+    }
+
+    Standard_Real fCost = 0.0;
+    for(int i = 1; i <= solid_list->Length(); i++)
+    {
+        const TopoDS_Shape &theShape = solid_list->Value(i);
+        if(theShape.ShapeType() != TopAbs_SOLID)
+        {
+            return InvalidCost();
+        }
+
+        Standard_Integer iFaceNum = 0;
+        for(TopExp_Explorer exF(theShape,TopAbs_FACE); exF.More(); exF.Next())
+        {
+            iFaceNum++;
+        }
+
+        fCost += CountConcaveEdges(TopoDS::Solid(theShape)) + 0.1*iFaceNum;
+    }
+
+    return fCost;
+}
+
+
+
+/** ***************************************************************************
+* @brief  The cost of failed boolean operation, it is larger than any valid split
+* @param
+* @return Standard_Real
+*
+* @date 19/10/2026
+* @author  agent
+******************************************************************************/
+Standard_Real McCadSplitCostModel::InvalidCost()
+{
+    return 1.0e6;
+}
+
+
+
+/** ***************************************************************************
+* @brief  Count the concave edges of solid
+* @param  TopoDS_Solid &theSolid
+* @return Standard_Integer
+*
+* @date 19/10/2026
+* @author  agent
+******************************************************************************/
+Standard_Integer McCadSplitCostModel::CountConcaveEdges(const TopoDS_Solid &theSolid)
+{
+    TopTools_IndexedDataMapOfShapeListOfShape mapEdgeFace;
+    TopExp::MapShapesAndAncestors(theSolid,TopAbs_EDGE,TopAbs_FACE,mapEdgeFace);
+
+    Standard_Integer iConcaveEdge = 0;
+    for (int iKey = 1; iKey <= mapEdgeFace.Extent(); iKey++)
+    {
+        const TopTools_ListOfShape &listFace = mapEdgeFace.FindFromIndex(iKey);
+        if(listFace.Extent() != 2)
+        {
+            continue;
+        }
+
+        TopoDS_Edge edge = TopoDS::Edge(mapEdgeFace.FindKey(iKey));
+        if(BRep_Tool::Degenerated(edge))
+        {
+            continue;
+        }
+
+        TopTools_ListIteratorOfListOfShape iterFace(listFace);
+        TopoDS_Face FaceA = TopoDS::Face(iterFace.Value());
+        iterFace.Next();
+        TopoDS_Face FaceB = TopoDS::Face(iterFace.Value());
+
+        if(McCadDcompSolid::IsConcaveEdge(edge,FaceA,FaceB))
+        {
+            iConcaveEdge++;
+        }
+    }
+
+    return iConcaveEdge;
+}
+
+
+
+/** ***************************************************************************
+* @brief  The features of the splitting surface used by the cost model
+* @param  McCadSurface *& pSurf
+*         Standard_Real theFeature[]
+* @return void
+*
+* @date 19/10/2026
+* @author  agent
+******************************************************************************/
+void McCadSplitCostModel::GetFeatures(McCadSurface *& pSurf, Standard_Real theFeature[NbFeature])
+{
+    theFeature[0] = 1.0;
+    theFeature[1] = pSurf->GetThroughConcaveEdges();
+    theFeature[2] = pSurf->GetSplitSurfNum();
+    theFeature[3] = pSurf->SplitCurvSurfNum();
+    theFeature[4] = pSurf->IsAstSurf() ? 1.0 : 0.0;
+    theFeature[5] = pSurf->GetSurfType() == Plane ? 0.0 : 1.0;
+}
+
+
+
+/** ***************************************************************************
+* @brief  Append the features and cost into the record file
+* @param  McCadSurface *& pSurf
+*         Standard_Real fCost
+* @return void
+*
+* @date 19/10/2026
+* @author  agent
+******************************************************************************/
+void McCadSplitCostModel::Record(McCadSurface *& pSurf, Standard_Real fCost)
+{
+    TCollection_AsciiString strFile = McCadConvertConfig::GetSplitCostFile();
+    if(strFile.IsEmpty())
+    {
+        return;
+    }
+
+    ofstream outFile(strFile.ToCString(), ios::app);
+    if(!outFile)
+    {
+        cout<<"#Cannot open the split cost file "<<strFile.ToCString()<<endl;
+        return;
+    }
+
+    Standard_Real feature[NbFeature];
+    GetFeatures(pSurf,feature);
+    for(int i = 1; i < NbFeature; i++)
+    {
+        outFile<<feature[i]<<",";
+    }
+    outFile<<fCost<<endl;
+}
+
+
+
+/** ***************************************************************************
+* @brief  Read the records and fit the weights with least squares. The failed
+*         splits are not used, their cost is not a measurement of work.
+* @param
+* @return void
+*
+* @date 19/10/2026
+* @author  agent
+******************************************************************************/
+void McCadSplitCostModel::Load()
+{
+    m_bLoaded = Standard_True;
+    m_bFitted = Standard_False;
+
+    TCollection_AsciiString strFile = McCadConvertConfig::GetSplitCostFile();
+    if(strFile.IsEmpty())
+    {
+        return;
+    }
+
+    ifstream inFile(strFile.ToCString());
+    if(!inFile)
+    {
+        return;
+    }
+
+    vector< vector<Standard_Real> > row_list;
+    vector<Standard_Real> cost_list;
+    string strLine;
+    while(getline(inFile,strLine))
+    {
+        Standard_Real feature[NbFeature+1];
+        feature[0] = 1.0;
+
+        stringstream ss(strLine);
+        string strValue;
+        int iValue = 1;
+        while(iValue <= NbFeature && getline(ss,strValue,','))
+        {
+            feature[iValue++] = atof(strValue.c_str());
+        }
+
+        if(iValue <= NbFeature || feature[NbFeature] >= InvalidCost())
+        {
+            continue;
+        }
+
+        row_list.push_back(vector<Standard_Real>(feature,feature+NbFeature));
+        cost_list.push_back(feature[NbFeature]);
+    }
+
+    vector<Standard_Real> weight_list;
+    if(!McCadMathTool::FitLeastSquares(row_list,cost_list,weight_list))
+    {
+        return;
+    }
+
+    for(int i = 0; i < NbFeature; i++)
+    {
+        m_fWeight[i] = weight_list.at(i);
+    }
+
+    m_bFitted = Standard_True;
+    cout<<"# Split cost model is fitted with "<<row_list.size()<<" records"<<endl;
+}
+
+
+
+/** ***************************************************************************
+* @brief  The model is fitted or not, the record file is read at first call
+* @param
+* @return Standard_Boolean
+*
+* @date 19/10/2026
+* @author  agent
+******************************************************************************/
+Standard_Boolean McCadSplitCostModel::IsFitted()
+{
+    if(!m_bLoaded)
+    {
+        Load();
+    }
+    return m_bFitted;
+}
+
+
+
+/** ***************************************************************************
+* @brief  Predict the remaining work after splitting with the surface
+* @param  McCadSurface *& pSurf
+* @return Standard_Real
+*
+* @date 19/10/2026
+* @author  agent
+******************************************************************************/
+Standard_Real McCadSplitCostModel::Predict(McCadSurface *& pSurf)
+{
+    if(!IsFitted())
+    {
+        return 0.0;
+    }
+
+    Standard_Real feature[NbFeature];
+    GetFeatures(pSurf,feature);
+
+    Standard_Real fCost = 0.0;
+    for(int i = 0; i < NbFeature; i++)
+    {
+        fCost += m_fWeight[i]*feature[i];
+    }
+    return fCost;
+}
+
+
+
+/** ***************************************************************************
+* @brief  Rank the splitting surfaces by the predicted cost. The rank is a
+*         stable bubble sort on the incoming order: the surfaces with same
+*         cost keep the heuristic order, and a surface registered in the
+*         model is not moved behind a new surface, the reuse bias of the
+*         selection is kept.
+* @param  vector<McCadSurface*> & face_list
+* @return void
+*
+* @date 19/10/2026
+* @author  agent
+******************************************************************************/
+void McCadSplitCostModel::RankSurfaces(vector<McCadSurface*> & face_list)
+{
+    if(face_list.size() < 2 || !IsFitted())
+    {
+        return;
+    }
+
+    Standard_Boolean bReuse = McCadConvertConfig::ReuseSurfaces();
+    vector<Standard_Real> cost_list;
+    vector<Standard_Boolean> reuse_list;
+    for(unsigned int i = 0; i < face_list.size(); i++)
+    {
+        McCadSurface *pSurf = face_list.at(i);
+        cost_list.push_back(Predict(pSurf));
+        reuse_list.push_back(bReuse && McCadSurfRegistry::Contains(*pSurf));
+    }
+
+    for(unsigned int i = 0; i < face_list.size() - 1; i++)
+    {
+        for (unsigned int j = 0; j < face_list.size() - 1 - i; j++)
+        {
+            if (reuse_list.at(j) && !reuse_list.at(j+1))
+            {
+                continue;   // The registered surface stays before the new one
+            }
+
+            if (cost_list.at(j) > cost_list.at(j+1))
+            {
+                swap(face_list.at(j),face_list.at(j+1));
+                swap(cost_list.at(j),cost_list.at(j+1));
+                swap(reuse_list.at(j),reuse_list.at(j+1));
+            }
+        }
+    }
+}
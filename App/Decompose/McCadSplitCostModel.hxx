@@ -0,0 +1,71 @@
+#ifndef MCCADSPLITCOSTMODEL_HXX
+#define MCCADSPLITCOSTMODEL_HXX
+
+#include <vector>
+#include <Standard.hxx>
+#include <TopoDS_Solid.hxx>
+#include <Handle_TopTools_HSequenceOfShape.hxx>
+#include <TCollection_AsciiString.hxx>
+
+#include "McCadSurface.hxx"
+
+using namespace std;
+
+/** The cost model of splitting surface selection. The remaining work after a
+    split is estimated by the concave edges and faces of the split solids. The
+    speculative split records the features of candidate surfaces with the
+    estimated work, and a linear model fitted on the records ranks the
+    candidates when the speculation is switched off. */
+class McCadSplitCostModel
+{
+public:
+
+    void* operator new(size_t,void* anAddress)
+    {
+        return anAddress;
+    }
+    void* operator new(size_t size)
+    {
+        return Standard::Allocate(size);
+    }
+    void  operator delete(void *anAddress)
+    {
+        if (anAddress) Standard::Free((Standard_Address&)anAddress);
+    }
+
+    McCadSplitCostModel();
+
+public:
+
+    /**< Estimated work of the split solids, InvalidCost() if the split failed */
+    static Standard_Real ScoreSplit(Handle_TopTools_HSequenceOfShape &solid_list,
+                                    Standard_Boolean bValid);
+    /**< The cost of a failed boolean operation */
+    static Standard_Real InvalidCost();
+
+    /**< Append the features of splitting surface and the cost into record file */
+    static void Record(McCadSurface *& pSurf, Standard_Real fCost);
+    /**< The model is fitted from the record file or not */
+    static Standard_Boolean IsFitted();
+    /**< Predict the cost of splitting surface with the fitted model */
+    static Standard_Real Predict(McCadSurface *& pSurf);
+    /**< Sort the splitting surfaces by predicted cost, keep the order of same cost */
+    static void RankSurfaces(vector<McCadSurface*> & face_list);
+    /**< Count the concave edges of the solid */
+    static Standard_Integer CountConcaveEdges(const TopoDS_Solid &theSolid);
+
+private:
+
+    enum { NbFeature = 6 };
+
+    static Standard_Boolean m_bLoaded;              /**< The record file has been read or not */
+    static Standard_Boolean m_bFitted;              /**< The weights are fitted or not */
+    static Standard_Real m_fWeight[NbFeature];      /**< The weights of features */
+
+    /**< The features of splitting surface */
+    static void GetFeatures(McCadSurface *& pSurf, Standard_Real theFeature[NbFeature]);
+    /**< Read the record file and fit the weights by least squares */
+    static void Load();
+};
+
+#endif // MCCADSPLITCOSTMODEL_HXX
@@ -26,7 +26,7 @@
 #include <STEPControl_Writer.hxx>
 #include <Handle_Geom_Surface.hxx>
 
-#include "../McCadTool/McCadGeomTool.hxx"
+#include "../Tools/McCadGeomTool.hxx"
 
 McCadSplitCylinders::McCadSplitCylinders()
 {
@@ -73,8 +73,8 @@ Standard_Boolean McCadSplitCylinders::HasComLineEdge(McCadBndSurfCylinder *& pSu
 
             if (pEdgeA->IsSame(pEdgeB,1.0e-5))
             {
-                pEdgeA->SetConvexity(flat);    /// Set the convexities of edgeA and edgeB
-                pEdgeB->SetConvexity(flat);
+                MarkConvexity(pEdgeA,flat);    /// Set the convexities of edgeA and edgeB
+                MarkConvexity(pEdgeB,flat);
 
                 pEdgeList->push_back(pEdgeA);
             }
@@ -127,8 +127,8 @@ Standard_Boolean McCadSplitCylinders::HasComCurvEdge(McCadBndSurfCylinder *&pSur
 
             if (pEdgeA->IsSame(pEdgeB,1.0e-5))
             {
-                pEdgeA->SetConvexity(flat);  // Set the convexity of two edges
-                pEdgeB->SetConvexity(flat);
+                MarkConvexity(pEdgeA,flat);  // Set the convexity of two edges
+                MarkConvexity(pEdgeB,flat);
                 pEdge = pEdgeA;
                 return Standard_True;
             }
@@ -261,6 +261,21 @@ McCadAstSurfPlane * McCadSplitCylinders::GenSurfThroughCurves(McCadEdge *& pEdge
 
 
 
+/** ***************************************************************************
+* @brief  The generator is applicable when the solid has at least two cylinders
+* @param  McCadDcompSolid     ( Input Solid )
+* @return Standard_Boolean
+*
+* @date 19/10/2026
+* @author  agent
+******************************************************************************/
+Standard_Boolean McCadSplitCylinders::IsApplicable(McCadDcompSolid *& pSolid)
+{
+    return pSolid->m_CylinderList.size() >= 2;
+}
+
+
+
 /** ***************************************************************************
 * @brief  Generate the splitting surface thought the edge connect the
 *         two cylinders
@@ -272,10 +287,10 @@ McCadAstSurfPlane * McCadSplitCylinders::GenSurfThroughCurves(McCadEdge *& pEdge
 * @modify 13/07/2015
 * @author  Lei Lu
 ******************************************************************************/
-void McCadSplitCylinders::GenSplitSurfaces( McCadDcompSolid *& pSolid)
+void McCadSplitCylinders::GenSplitSurfaces(McCadDcompSolid *& pSolid,
+                                           vector<McCadAstSurface*> & AstFaceList)
 {
     vector<McCadBndSurface *>  &face_list    = pSolid->m_CylinderList;
-    vector<McCadAstSurface*>   &AstFaceList  = pSolid->m_AstFaceList;
 
     m_fLength = pSolid->m_fBoxSqLength; 
 
@@ -309,8 +324,8 @@ void McCadSplitCylinders::GenSplitSurfaces( McCadDcompSolid *& pSolid)
                     McCadAstSurfPlane * pAstFace = GenSurfThroughEdge(*pBndSurfA,*pBndSurfB,pEdge);
                     AstFaceList.push_back(pAstFace);
 
-                    pBndSurfA->AddCylnCylnSplitEdge(pEdge);
-                    pBndSurfB->AddCylnCylnSplitEdge(pEdge);
+                    RecordCylnCylnSplitEdge(pBndSurfA,pEdge);
+                    RecordCylnCylnSplitEdge(pBndSurfB,pEdge);
                 }
                 else if(pEdgeList->size() == 2)
                 {
@@ -331,10 +346,10 @@ void McCadSplitCylinders::GenSplitSurfaces( McCadDcompSolid *& pSolid)
                             McCadAstSurfPlane * pAstFace = GenSurfThroughTwoEdges(pEdgeLineA,pEdgeLineB);
                             AstFaceList.push_back(pAstFace);
 
-                            pBndSurfA->AddCylnCylnSplitEdge(pEdgeA);
-                            pBndSurfB->AddCylnCylnSplitEdge(pEdgeA);
-                            pBndSurfA->AddCylnCylnSplitEdge(pEdgeB);
-                            pBndSurfB->AddCylnCylnSplitEdge(pEdgeB);
+                            RecordCylnCylnSplitEdge(pBndSurfA,pEdgeA);
+                            RecordCylnCylnSplitEdge(pBndSurfB,pEdgeA);
+                            RecordCylnCylnSplitEdge(pBndSurfA,pEdgeB);
+                            RecordCylnCylnSplitEdge(pBndSurfB,pEdgeB);
 
                             // pBndSurfA->SetAstSurfaces(Standard_True);
                             // pBndSurfB->SetAstSurfaces(Standard_True);
@@ -354,8 +369,8 @@ void McCadSplitCylinders::GenSplitSurfaces( McCadDcompSolid *& pSolid)
                 pAstFace->SetCombined(Standard_True); // The assisted surface can not be merged
                 AstFaceList.push_back(pAstFace);
 
-                pBndSurfA->AddCylnCylnSplitEdge(pCurveEdge);
-                pBndSurfB->AddCylnCylnSplitEdge(pCurveEdge);
+                RecordCylnCylnSplitEdge(pBndSurfA,pCurveEdge);
+                RecordCylnCylnSplitEdge(pBndSurfB,pCurveEdge);
             }
         }
     }
@@ -14,10 +14,11 @@
 #include "McCadAstSurfPlane.hxx"
 #include "McCadBndSurfCylinder.hxx"
 #include "McCadDcompSolid.hxx"
+#include "McCadAstSurfGenerator.hxx"
 
 using namespace std;
 
-class McCadSplitCylinders
+class McCadSplitCylinders : public McCadAstSurfGenerator
 {    
 public:
 
@@ -39,7 +40,9 @@ public:
 
 public:
 
-    void GenSplitSurfaces(McCadDcompSolid *& pSolid);  /**< Generate the splitting surface */
+    /**< The solid has the surfaces which this generator works on or not */
+    Standard_Boolean IsApplicable(McCadDcompSolid *& pSolid);
+    void GenSplitSurfaces(McCadDcompSolid *& pSolid, vector<McCadAstSurface*> & AstFaceList);  /**< Generate the splitting surface */
 
 private:   
 
@@ -24,8 +24,8 @@
 #include <gp_Cylinder.hxx>
 #include <gp_Pln.hxx>
 
-#include "../McCadTool/McCadMathTool.hxx"
-#include "../McCadTool/McCadGeomTool.hxx"
+#include "../Tools/McCadMathTool.hxx"
+#include "../Tools/McCadGeomTool.hxx"
 
 
 McCadSplitCylnPln::McCadSplitCylnPln()
@@ -40,6 +40,21 @@ McCadSplitCylnPln::~McCadSplitCylnPln()
 
 
 
+/** ***************************************************************************
+* @brief  The generator is applicable when the solid has both cylinders and planes
+* @param  McCadDcompSolid     ( Input Solid )
+* @return Standard_Boolean
+*
+* @date 19/10/2026
+* @author  agent
+******************************************************************************/
+Standard_Boolean McCadSplitCylnPln::IsApplicable(McCadDcompSolid *& pSolid)
+{
+    return !pSolid->m_CylinderList.empty() && !pSolid->m_PlaneList.empty();
+}
+
+
+
 /** ***************************************************************************
 * @brief  Generate the assisted surfaces and add them to the assisted splitting
 *         surface list
@@ -50,11 +65,11 @@ McCadSplitCylnPln::~McCadSplitCylnPln()
 * @modify 13/07/2015
 * @author  Lei Lu
 ******************************************************************************/
-void McCadSplitCylnPln::GenSplitSurfaces( McCadDcompSolid *& pSolid)
+void McCadSplitCylnPln::GenSplitSurfaces(McCadDcompSolid *& pSolid,
+                                         vector<McCadAstSurface*> & AstFaceList)
 {
     vector<McCadBndSurface *>  &cylinder_list = pSolid->m_CylinderList;
     vector<McCadBndSurface *>  &plane_list    = pSolid->m_PlaneList;
-    vector<McCadAstSurface*>   &AstFaceList   = pSolid->m_AstFaceList;
 
     m_fLength = pSolid->m_fBoxSqLength; // Set the length of created splitting surface
 
@@ -104,7 +119,7 @@ void McCadSplitCylnPln::GenSplitSurfaces( McCadDcompSolid *& pSolid)
     for(int i = 0; i < cylinder_list.size(); i++ )
     {
         McCadBndSurfCylinder *pBndCyln = (McCadBndSurfCylinder*)cylinder_list.at(i);
-        if(pBndCyln->HasCylnPlnSplitSurf())
+        if(!GetCylnPlnSplitEdges(pBndCyln).empty())
         {
             CrtSplitSurfaces(pBndCyln,AstFaceList);
         }
@@ -173,10 +188,11 @@ void McCadSplitCylnPln::MergeSurfaces(vector<McCadAstSurface*> & theAstFaceList)
 void McCadSplitCylnPln::CrtSplitSurfaces(McCadBndSurfCylinder *& pCylnFace,
                                          vector<McCadAstSurface*> & astFace_list)
 {
-    int iEdgeNum = pCylnFace->GetCylnPlnSplitEdgeList().size();
+    vector<McCadEdge*> edge_list = GetCylnPlnSplitEdges(pCylnFace);
+    int iEdgeNum = edge_list.size();
     if (iEdgeNum  == 1)
     {
-         McCadEdge *pEdge = pCylnFace->GetCylnPlnSplitEdgeList().at(0);
+         McCadEdge *pEdge = edge_list.at(0);
          McCadAstSurfPlane *pAstSplitSurf = CrtSplitSurfThroughEdge(pCylnFace,pEdge);
          astFace_list.push_back(pAstSplitSurf);
     }
@@ -188,9 +204,9 @@ void McCadSplitCylnPln::CrtSplitSurfaces(McCadBndSurfCylinder *& pCylnFace,
         /// to split them
         if (radian < M_PI)
         {
-            for(unsigned int i = 0 ; i < pCylnFace->GetCylnPlnSplitEdgeList().size(); i++)
+            for(unsigned int i = 0 ; i < edge_list.size(); i++)
             {
-                McCadEdge *pEdge = pCylnFace->GetCylnPlnSplitEdgeList().at(i);
+                McCadEdge *pEdge = edge_list.at(i);
                 McCadAstSurfPlane *pAstSplitSurf = CrtSplitSurfThroughEdge(pCylnFace,pEdge);
                 astFace_list.push_back(pAstSplitSurf);
             }
@@ -198,8 +214,8 @@ void McCadSplitCylnPln::CrtSplitSurfaces(McCadBndSurfCylinder *& pCylnFace,
         else /// if the radian of cylinder is lager than 120 degree, use one splitting
              /// surfaces which connect two edges
         {
-            McCadEdge *pEdgeA = pCylnFace->GetCylnPlnSplitEdgeList().at(0);
-            McCadEdge *pEdgeB = pCylnFace->GetCylnPlnSplitEdgeList().at(1);
+            McCadEdge *pEdgeA = edge_list.at(0);
+            McCadEdge *pEdgeB = edge_list.at(1);
 
             McCadAstSurfPlane* pAstSplitSurf = CrtSplitSurfThroughTwoEdges(pEdgeA,pEdgeB);
             astFace_list.push_back(pAstSplitSurf);
@@ -353,8 +369,8 @@ Standard_Boolean McCadSplitCylnPln::FindComLineEdge(McCadBndSurfCylinder *& pSur
 
                 if(angle < 1.0e-4)
                 {
-                    pEdgeA->SetConvexity(flat);
-                    pEdgeB->SetConvexity(flat);
+                    MarkConvexity(pEdgeA,flat);
+                    MarkConvexity(pEdgeB,flat);
                 }          
 
                 if(angle >= 0.5*M_PI && angle <= M_PI)
@@ -363,7 +379,7 @@ Standard_Boolean McCadSplitCylnPln::FindComLineEdge(McCadBndSurfCylinder *& pSur
                 }
                 else
                 {                   
-                    pSurfCyln->AddCylnPlnSplitEdge(pEdgeA);
+                    RecordCylnPlnSplitEdge(pSurfCyln,pEdgeA);
                    //pSurfCyln->SetAstSurfaces(Standard_True);
                 }                
                 return Standard_True;
@@ -11,10 +11,11 @@
 #include "McCadAstSurfPlane.hxx"
 
 #include "McCadDcompSolid.hxx"
+#include "McCadAstSurfGenerator.hxx"
 
 using namespace std;
 
-class McCadSplitCylnPln
+class McCadSplitCylnPln : public McCadAstSurfGenerator
 {
 public:
 
@@ -35,8 +36,10 @@ public:
     ~McCadSplitCylnPln();    
 
 public:
+    /**< The solid has the surfaces which this generator works on or not */
+    Standard_Boolean IsApplicable(McCadDcompSolid *& pSolid);
     /**< Generate assiste splitting surfaces and add into the assisted surface list */
-    void GenSplitSurfaces( McCadDcompSolid *& pSolid );   
+    void GenSplitSurfaces(McCadDcompSolid *& pSolid, vector<McCadAstSurface*> & AstFaceList);   
 
            // const vector<McCadBndSurface *> &cylinder_list,
            // const vector<McCadBndSurface *> &plane_list,
@@ -12,6 +12,24 @@ McCadSplitSphereCurveSurf::~McCadSplitSphereCurveSurf()
 }
 
 
+/** ***************************************************************************
+* @brief  The generator is applicable when the solid has spheres connected with other curved surfaces
+* @param  McCadDcompSolid     ( Input Solid )
+* @return Standard_Boolean
+*
+* @date 19/10/2026
+* @author  agent
+******************************************************************************/
+Standard_Boolean McCadSplitSphereCurveSurf::IsApplicable(McCadDcompSolid *& pSolid)
+{
+    return !pSolid->m_SphereList.empty()
+           && (pSolid->m_SphereList.size() >= 2
+               || !pSolid->m_ConeList.empty()
+               || !pSolid->m_CylinderList.empty());
+}
+
+
+
 /** ***************************************************************************
 * @brief  Input the solid, trace the boundary surfaces and find the common edges
 *         of the sphere and other curved surfaces, then generate the assisted
@@ -23,14 +41,13 @@ McCadSplitSphereCurveSurf::~McCadSplitSphereCurveSurf()
 * @modify
 * @author  Lei Lu
 ******************************************************************************/
-void McCadSplitSphereCurveSurf::GenSplitSurfaces( McCadDcompSolid *& pSolid)
+void McCadSplitSphereCurveSurf::GenSplitSurfaces(McCadDcompSolid *& pSolid,
+                                                 vector<McCadAstSurface*> & AstFaceList)
 {
     vector<McCadBndSurface *>  &sphere_list    = pSolid->m_SphereList;
     vector<McCadBndSurface *>  &cone_list      = pSolid->m_ConeList;
     vector<McCadBndSurface *>  &cylinder_list  = pSolid->m_CylinderList;
 
-    vector<McCadAstSurface*>   &AstFaceList  = pSolid->m_AstFaceList;
-
     m_fLength = pSolid->m_fBoxSqLength;
 
     for(unsigned int i = 0; i < sphere_list.size()-1; i++ )
@@ -143,8 +160,8 @@ Standard_Boolean McCadSplitSphereCurveSurf::HasComCircleEdge(McCadBndSurfSphere
 
             if (pEdgeA->IsSame(pEdgeB,1.0e-5))
             {
-                pEdgeA->SetConvexity(concave);  // Set the convexity of two edges
-                pEdgeB->SetConvexity(concave);
+                MarkConvexity(pEdgeA,concave);  // Set the convexity of two edges
+                MarkConvexity(pEdgeB,concave);
                 pEdge = pEdgeA;
                 return Standard_True;
             }
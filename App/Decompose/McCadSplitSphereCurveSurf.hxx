@@ -2,9 +2,10 @@
 #define MCCADSPLITSPHERECURVESURF_HXX
 
 #include "McCadDcompSolid.hxx"
+#include "McCadAstSurfGenerator.hxx"
 #include "McCadBndSurfSphere.hxx"
 
-class McCadSplitSphereCurveSurf
+class McCadSplitSphereCurveSurf : public McCadAstSurfGenerator
 {
 public:
 
@@ -24,7 +25,9 @@ public:
     McCadSplitSphereCurveSurf();
     ~McCadSplitSphereCurveSurf();
 
-    void GenSplitSurfaces(McCadDcompSolid *& pSolid);  /**< Generate the splitting surface */
+    /**< The solid has the surfaces which this generator works on or not */
+    Standard_Boolean IsApplicable(McCadDcompSolid *& pSolid);
+    void GenSplitSurfaces(McCadDcompSolid *& pSolid, vector<McCadAstSurface*> & AstFaceList);  /**< Generate the splitting surface */
 
 private:
 
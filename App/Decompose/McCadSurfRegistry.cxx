@@ -0,0 +1,172 @@
+#include "McCadSurfRegistry.hxx"
+
+#include <TopoDS.hxx>
+#include <TopExp_Explorer.hxx>
+
+#include "../Tools/McCadGeomTool.hxx"
+
+vector<TopoDS_Face> McCadSurfRegistry::m_SurfList;
+McCadGeomSurfHash McCadSurfRegistry::m_SurfHash;
+Standard_Integer McCadSurfRegistry::m_iSplitNum = 0;
+Standard_Integer McCadSurfRegistry::m_iReuseNum = 0;
+vector<TopoDS_Face> McCadSurfRegistry::m_SplitList;
+
+McCadSurfRegistry::McCadSurfRegistry()
+{
+}
+
+
+
+/** ***************************************************************************
+* @brief  Remove the registered surfaces and the statistics
+* @param
+* @return void
+*
+* @date 19/10/2026
+* @author  agent
+******************************************************************************/
+void McCadSurfRegistry::Clear()
+{
+    m_SurfList.clear();
+    m_SurfHash.Clear();
+    m_iSplitNum = 0;
+    m_iReuseNum = 0;
+    m_SplitList.clear();
+}
+
+
+
+/** ***************************************************************************
+* @brief  Register the boundary surfaces of the solid
+* @param  TopoDS_Shape &theSolid
+* @return void
+*
+* @date 19/10/2026
+* @author  agent
+******************************************************************************/
+void McCadSurfRegistry::AddSolid(const TopoDS_Shape &theSolid)
+{
+    for(TopExp_Explorer exF(theSolid,TopAbs_FACE); exF.More(); exF.Next())
+    {
+        Add(TopoDS::Face(exF.Current()));
+    }
+}
+
+
+
+/** ***************************************************************************
+* @brief  Register the splitting surface used by the decomposition, count the
+*         surfaces which have been registered before
+* @param  TopoDS_Face &theFace
+* @return void
+*
+* @date 19/10/2026
+* @author  agent
+******************************************************************************/
+void McCadSurfRegistry::AddSplitSurface(const TopoDS_Face &theFace)
+{
+    m_iSplitNum++;
+    m_SplitList.push_back(theFace);
+    if(Add(theFace))
+    {
+        m_iReuseNum++;
+    }
+}
+
+
+
+/** ***************************************************************************
+* @brief  The surface is registered or not. The faces are compared with the
+*         same orientation, the surfaces with opposite normals are same. Only
+*         the surfaces in the neighbour buckets of the hash are compared.
+* @param  TopoDS_Face &theFace
+* @return Standard_Boolean
+*
+* @date 19/10/2026
+* @author  agent
+******************************************************************************/
+Standard_Boolean McCadSurfRegistry::Contains(const TopoDS_Face &theFace)
+{
+    vector<Standard_Integer> index_list;
+    m_SurfHash.GetCandidates(theFace,index_list);
+
+    TopoDS_Face face = TopoDS::Face(theFace.Oriented(TopAbs_FORWARD));
+    for(unsigned int i = 0; i < index_list.size(); i++)
+    {
+        if(McCadGeomTool::IsSameSurfaces(m_SurfList.at(index_list.at(i)),face))
+        {
+            return Standard_True;
+        }
+    }
+    return Standard_False;
+}
+
+
+
+/** ***************************************************************************
+* @brief  Add the surface if it is not registered
+* @param  TopoDS_Face &theFace
+* @return Standard_Boolean ( The surface was registered before )
+*
+* @date 19/10/2026
+* @author  agent
+******************************************************************************/
+Standard_Boolean McCadSurfRegistry::Add(const TopoDS_Face &theFace)
+{
+    if(Contains(theFace))
+    {
+        return Standard_True;
+    }
+
+    TopoDS_Face face = TopoDS::Face(theFace.Oriented(TopAbs_FORWARD));
+    m_SurfHash.Add(face,m_SurfList.size());
+    m_SurfList.push_back(face);
+    return Standard_False;
+}
+
+
+
+/** ***************************************************************************
+* @brief  Number of used splitting surfaces
+* @param
+* @return Standard_Integer
+*
+* @date 19/10/2026
+* @author  agent
+******************************************************************************/
+Standard_Integer McCadSurfRegistry::GetSplitNum()
+{
+    return m_iSplitNum;
+}
+
+
+
+/** ***************************************************************************
+* @brief  Number of used splitting surfaces which were registered before, they
+*         do not add new surface cards
+* @param
+* @return Standard_Integer
+*
+* @date 19/10/2026
+* @author  agent
+******************************************************************************/
+Standard_Integer McCadSurfRegistry::GetReuseNum()
+{
+    return m_iReuseNum;
+}
+
+
+
+/** ***************************************************************************
+* @brief  The used splitting surfaces in the order of registering, registering
+*         them again in the same order restores the registry
+* @param
+* @return vector<TopoDS_Face>
+*
+* @date 19/10/2026
+* @author  agent
+******************************************************************************/
+const vector<TopoDS_Face> & McCadSurfRegistry::GetSplitSurfaces()
+{
+    return m_SplitList;
+}
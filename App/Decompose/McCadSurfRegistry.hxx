@@ -0,0 +1,68 @@
+#ifndef MCCADSURFREGISTRY_HXX
+#define MCCADSURFREGISTRY_HXX
+
+#include <vector>
+#include <Standard.hxx>
+#include <TopoDS_Shape.hxx>
+#include <TopoDS_Face.hxx>
+
+#include "../Convertor/McCadGeomSurfHash.hxx"
+
+using namespace std;
+
+/** The registry of the surfaces used in the whole model. The boundary surfaces
+    of the input solids and the used splitting surfaces are registered, the
+    selection of splitting surface prefers the registered ones among the
+    candidates with same priority, because they do not add new surface cards.
+    The surfaces are indexed by their quantised coefficients, a query only
+    compares the surfaces in the neighbour buckets. */
+class McCadSurfRegistry
+{
+public:
+
+    void* operator new(size_t,void* anAddress)
+    {
+        return anAddress;
+    }
+    void* operator new(size_t size)
+    {
+        return Standard::Allocate(size);
+    }
+    void  operator delete(void *anAddress)
+    {
+        if (anAddress) Standard::Free((Standard_Address&)anAddress);
+    }
+
+    McCadSurfRegistry();
+
+private:
+
+    static vector<TopoDS_Face> m_SurfList;          /**< Registered surfaces */
+    static McCadGeomSurfHash m_SurfHash;            /**< Hash index of the registered surfaces */
+    static Standard_Integer m_iSplitNum;            /**< Number of used splitting surfaces */
+    static Standard_Integer m_iReuseNum;            /**< Number of splitting surfaces which were registered */
+    static vector<TopoDS_Face> m_SplitList;         /**< Used splitting surfaces in order */
+
+    /**< Add the surface if it is not registered, return true if it is registered */
+    static Standard_Boolean Add(const TopoDS_Face &theFace);
+
+public:
+
+    /**< Remove the registered surfaces and the statistics */
+    static void Clear();
+    /**< Register the boundary surfaces of the solid */
+    static void AddSolid(const TopoDS_Shape &theSolid);
+    /**< Register the used splitting surface and count it is reused or not */
+    static void AddSplitSurface(const TopoDS_Face &theFace);
+    /**< The surface is registered or not */
+    static Standard_Boolean Contains(const TopoDS_Face &theFace);
+
+    /**< Number of used splitting surfaces */
+    static Standard_Integer GetSplitNum();
+    /**< Number of used splitting surfaces which did not add new surfaces */
+    static Standard_Integer GetReuseNum();
+    /**< The used splitting surfaces in the order of registering */
+    static const vector<TopoDS_Face> & GetSplitSurfaces();
+};
+
+#endif // MCCADSURFREGISTRY_HXX
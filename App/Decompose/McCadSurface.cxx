@@ -8,8 +8,8 @@
 #include <BRepTools.hxx>
 
 
-#include "../McCadTool/McCadMathTool.hxx"
-#include "../McCadTool/McCadGeomTool.hxx"
+#include "../Tools/McCadMathTool.hxx"
+#include "../Tools/McCadGeomTool.hxx"
 
 McCadSurface::McCadSurface()
 {
@@ -8,6 +8,8 @@
 #include "Tools/McCadConvertConfig.hxx"
 #include "Tools/McCadInputModelData.hxx"
 #include "Tools/McCadGeneTool.hxx"
+#include "Decompose/McCadDecompose.hxx"
+#include "Decompose/McCadDcompProgress.hxx"
 
 #include "../App/McCadMessager_Signal.h"
 
@@ -36,10 +38,18 @@ void McCadConversion::run()
     msg->sig_progress_main(0);
     msg->sig_main_label(QString::fromLatin1("Load the configuration"));
 
+    /// The settings and the decomposition status are shared with the decomposition
+    if (!McCadDcompProgress::Acquire())
+    {
+        msg->sig_message_append(QString::fromLatin1("-> Error: A decomposition or conversion is running."));
+        return;
+    }
+
     // read parameter file
     if (!McCadConvertConfig::ReadPrmt(m_strConfigFile))
     {
         msg->sig_message_append(QString::fromLatin1("-> Error: Load configurations error."));
+        McCadDcompProgress::Release();
         return;
     }
     msg->sig_message_append(QString::fromLatin1(">>> Load the configurations. OK!"));
@@ -50,13 +60,32 @@ void McCadConversion::run()
     if (!input_model.LoadSTEPModel(m_strStepFile))
     {
         msg->sig_message_append(QString::fromLatin1(">>> Error: Read geometry data error, please check the file name."));
+        McCadDcompProgress::Release();
         return;
     }
     msg->sig_message_append(QString::fromLatin1(">>> Input STEP file: %1").arg(QString::fromStdString(m_strStepFile.ToCString())));
     msg->sig_progress_main(5);   // finish the parameter reading progress
 
-    McCadVoidCellManager * pVoidCellManager = new McCadVoidCellManager();
     Handle(TopTools_HSequenceOfShape) hInputShape = input_model.GetModelData();
+
+    /// Decompose the model firstly, the decomposed solids are converted directly
+    /// without writing and reading the step file again.
+    if(McCadConvertConfig::DecomposeBeforeConvert())
+    {
+        msg->sig_main_label(QString::fromLatin1("Decompose the geometry"));
+
+        McCadDecompose * pDecompose = new McCadDecompose();
+        pDecompose->InputData(hInputShape, m_strStepFile);
+        pDecompose->PerformInMemory();
+        hInputShape = pDecompose->GetDecomposedSolids();
+
+        delete pDecompose;
+        pDecompose = NULL;
+
+        msg->sig_message_append(QString::fromLatin1(">>> Decompose the geometry in memory. OK!"));
+    }
+
+    McCadVoidCellManager * pVoidCellManager = new McCadVoidCellManager();
     pVoidCellManager->ReadGeomData( hInputShape );
 
     msg->sig_progress_main(45);
@@ -95,6 +124,8 @@ void McCadConversion::run()
     delete pVoidCellManager;
     pVoidCellManager = NULL;
 
+    McCadDcompProgress::Release();
+
     msg->sig_progress_main(100); // Finish the conversion;
     msg->sig_main_label(QString::fromLatin1("Finish"));
 }
@@ -0,0 +1,55 @@
+#include "PreCompiled.h"
+#include "McCadDecomposition.h"
+
+#include "Decompose/McCadDecompose.hxx"
+#include "Decompose/McCadDcompProgress.hxx"
+#include "Tools/McCadConvertConfig.hxx"
+#include "Tools/McCadGeneTool.hxx"
+
+McCadDecomposition::McCadDecomposition()
+{
+    m_SolidList = new TopTools_HSequenceOfShape;
+}
+
+McCadDecomposition::~McCadDecomposition()
+{
+}
+
+
+void McCadDecomposition::run()
+{
+    // The decomposition runs in the background thread, the progress and the
+    // decomposed solids are passed to the gui by McCadDcompProgress.
+    if (!m_strConfigFile.IsEmpty() && !McCadConvertConfig::ReadPrmt(m_strConfigFile))
+    {
+        cout<<"#Error: Load configurations from "<<m_strConfigFile.ToCString()<<" failed."<<endl;
+        McCadDcompProgress::Release();
+        return;
+    }
+
+    McCadDecompose * pDecompose = new McCadDecompose();
+    pDecompose->InputData(m_SolidList, m_strModelFile);
+    pDecompose->PerformInMemory();
+
+    delete pDecompose;
+    pDecompose = NULL;
+
+    /// The gui acquires the run before the thread starts
+    McCadDcompProgress::Release();
+}
+
+
+void McCadDecomposition::Setting(const QString strConfig,
+                                 const QString strModelFile,
+                                 Handle(TopTools_HSequenceOfShape) solid_list)
+{
+    m_strConfigFile = McCadGeneTool::ToAsciiString(strConfig);
+    m_strModelFile = McCadGeneTool::ToAsciiString(strModelFile);
+    m_SolidList = solid_list;
+}
+
+
+void McCadDecomposition::stop()
+{
+    McCadDcompProgress::Cancel();
+}
@@ -0,0 +1,36 @@
+#ifndef MCCADDECOMPOSITION_H
+#define MCCADDECOMPOSITION_H
+
+#include <QThread>
+#include <TCollection_AsciiString.hxx>
+#include <TopTools_HSequenceOfShape.hxx>
+
+#include <iostream>
+
+using namespace std;
+
+class McCadDecomposition : public QThread
+{
+
+public:
+    McCadDecomposition();
+    ~McCadDecomposition();
+    void Setting(const QString strConfig,
+                 const QString strModelFile,
+                 Handle(TopTools_HSequenceOfShape) solid_list);   // Set the config file, the model name and the input solids
+
+    void run();
+    void stop();
+
+private:
+
+    TCollection_AsciiString m_strConfigFile;            // The config file
+    TCollection_AsciiString m_strModelFile;             // The model name the output files are named after
+    Handle(TopTools_HSequenceOfShape) m_SolidList;      // The solids to be decomposed
+
+};
+
+
+
+
+#endif // MCCADDECOMPOSITION_H
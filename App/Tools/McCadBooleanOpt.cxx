@@ -9,9 +9,10 @@
 #include <BRepTools.hxx>
 #include <BRepAdaptor_Surface.hxx>
 #include <BRepTools_ReShape.hxx>
-#include <BOPTools_DSFiller.hxx>
 #include <BRepBuilderAPI_Sewing.hxx>
 #include <BRepCheck_Analyzer.hxx>
+#include <BRepBuilderAPI_Transform.hxx>
+#include <BRep_Tool.hxx>
 
 #include <STEPControl_Writer.hxx>
 #include <ShapeUpgrade_RemoveInternalWires.hxx>
@@ -23,22 +24,36 @@
 #include <TopoDS.hxx>
 #include <TopExp_Explorer.hxx>
 #include <TopTools_HSequenceOfShape.hxx>
+#include <TopLoc_Location.hxx>
+#include <TColStd_MapOfTransient.hxx>
+#include <TopTools_ListOfShape.hxx>
+#include <Geom_Surface.hxx>
+
+#include <Standard_Version.hxx>
+#if OCC_VERSION_HEX >= 0x070000
+#include <BOPAlgo_GlueEnum.hxx>
+#endif
 
 #include <gp_Pln.hxx>
 #include <gp_Cylinder.hxx>
+#include <gp_Trsf.hxx>
+#include <gp_Vec.hxx>
 #include <GeomAbs_SurfaceType.hxx>
 
 #include <GProp_GProps.hxx>
 #include <BRepGProp.hxx>
 
-#include "../McCadTool/McCadGeomTool.hxx"
+#include "../Tools/McCadGeomTool.hxx"
+#include "../Tools/McCadConvertConfig.hxx"
 
 McCadBooleanOpt::McCadBooleanOpt()
 {
+    m_bLazyRepair = Standard_False;
 }
 
 McCadBooleanOpt::McCadBooleanOpt(const TopoDS_Solid &theSolid, const TopoDS_Face &theFace)
 {
+    m_bLazyRepair = Standard_False;
     InputData(theSolid, theFace);
     m_ResultSolids = new TopTools_HSequenceOfShape;
 }
@@ -66,6 +81,23 @@ void McCadBooleanOpt::InputData(const TopoDS_Solid &theSolid, const TopoDS_Face
 
 
 
+/** ********************************************************************
+* @brief Only check the faces created by the splitting for the result
+*        solids, the full check and repair are left to the caller
+*
+* @param Standard_Boolean bLazy
+* @return void
+*
+* @date 19/10/2026
+* @author  agent
+***********************************************************************/
+void McCadBooleanOpt::SetLazyRepair(Standard_Boolean bLazy)
+{
+    m_bLazyRepair = bLazy;
+}
+
+
+
 
 /** ********************************************************************
 * @brief Calculate the boundary box of input solid
@@ -139,28 +171,27 @@ Standard_Boolean McCadBooleanOpt::Perform()
 
 //     m_InputSolid = TopoDS::Solid(shape); 
 
-     if( AdpSurf.GetType() == GeomAbs_Plane)
+     if( AdpSurf.GetType() == GeomAbs_Plane || AdpSurf.GetType() == GeomAbs_Cylinder)
      {
          return Split(split_face);
      }
-     else if(AdpSurf.GetType() == GeomAbs_Cylinder)
-     {
-         return SplitCyln(split_face);
-     }
 }
 
 
 /** ********************************************************************
-* @brief Split the solid with given cylinder surface, a cylinder will be
-*        created for splitting
+* @brief Split the solid with given cylinder surface and the options of
+*        one rung of the retry ladder, a cylinder will be created for
+*        splitting
 *
 * @param TopoDS_Face & theFace
+*        BoolRung & theRung
 * @return Standard_Boolean
 *
 * @date 04/08/2015
+* @modify 19/10/2026
 * @author  Lei Lu
 ***********************************************************************/
-Standard_Boolean McCadBooleanOpt::SplitCyln(TopoDS_Face & theFace)
+Standard_Boolean McCadBooleanOpt::SplitCylnWithRung(TopoDS_Face & theFace, const BoolRung & theRung)
 {
     gp_Pnt posPnt, negPnt;              // Calculate the positive and negative points of the splitting face
     CalPoints(theFace,posPnt,negPnt);   // Calculate the negative point of cylinder
@@ -190,55 +221,109 @@ Standard_Boolean McCadBooleanOpt::SplitCyln(TopoDS_Face & theFace)
     {
         Standard_Failure::Caught()->Print(cout);
         cout<<endl;
+        return Standard_False;
     }
 
-    try
+    if(PosBox.IsNull())
     {
-        BOPTools_DSFiller aDF;
-        aDF.SetShapes(m_InputSolid, NegCylnSld);
-        aDF.Perform();
-
-        BRepAlgoAPI_Common Common(PosBox,m_InputSolid,aDF);
-        if(Common.IsDone())
-        {
-            TopoDS_Shape ComSolid = Common.Shape();
-            //TopoDS_Shape solid = RemoveInternalWires(ComSolid);
-            m_ResultSolids->Append(ComSolid);
-
-        }
-        Common.Destroy();
-
-        BRepAlgoAPI_Cut Cutter(m_InputSolid,PosBox, aDF);
-        if(Cutter.IsDone())
-        {
-            TopoDS_Shape CutSolid = Cutter.Shape();
-            m_ResultSolids->Append(CutSolid);
-        }
-        Cutter.Destroy();
+        return Standard_False;
     }
-    catch(Standard_DomainError)
+
+    TopoDS_Shape ComSolid, CutSolid;
+    if(!PerformBoolean(PosBox,m_InputSolid,Standard_True,theRung,ComSolid)
+       || !PerformBoolean(m_InputSolid,PosBox,Standard_False,theRung,CutSolid))
     {
-        Standard_Failure::Caught()->Print(cout);
-        cout<<endl;
+        PosBox.Free();
+        return Standard_False;
     }
+    PosBox.Free();
 
-    return Standard_True;
+    m_ResultSolids->Append(ComSolid);
+    m_ResultSolids->Append(CutSolid);
 
+    if(m_bLazyRepair)
+    {
+        return CheckNewFaces();     // Check the faces created by splitting only
+    }
+    return CheckAndRepair(); // Check the geometry errors of output solids
 }
 
 
 
 /** ********************************************************************
-* @brief Split the solid with given splitting surface
+* @brief Split the solid with given plane or cylinder splitting surface.
+*        If the boolean operations fail or the result solids are invalid,
+*        retry along the ladder of boolean options. The cylinder uses the
+*        fuzzy and glue rungs, the perturbed rungs are for planes only.
 *
 * @param TopoDS_Face & theFace
 * @return Standard_Boolean
 *
 * @date 04/08/2015
+* @modify 19/10/2026
 * @author  Lei Lu
 ***********************************************************************/
 Standard_Boolean McCadBooleanOpt::Split(TopoDS_Face & theFace)
-{   
+{
+    vector<BoolRung> ladder;
+    GenRetryLadder(ladder);
+
+    /// Moving a cylinder changes its radius and the surface card of the
+    /// split solids would not be the one of the model, so only the plane
+    /// is moved
+    BRepAdaptor_Surface BS(theFace, Standard_True);
+    Standard_Boolean bPlane = (BS.GetType() == GeomAbs_Plane);
+
+    for(unsigned int i = 0; i < ladder.size(); i++)
+    {
+        const BoolRung &theRung = ladder.at(i);
+
+        TopoDS_Face split_face = theFace;
+        if(theRung.fOffset != 0.0)
+        {
+            if(!bPlane)
+            {
+                continue;
+            }
+            split_face = MoveSplitFace(theFace, theRung.fOffset);
+        }
+
+        FreeSolidList(m_ResultSolids);
+        Standard_Boolean bSplit = bPlane ? SplitWithRung(split_face, theRung)
+                                         : SplitCylnWithRung(split_face, theRung);
+        if(bSplit)
+        {
+            if(i > 0)
+            {
+                cout<<"#Boolean operation succeeded at retry "<<i<<" (fuzzy "
+                    <<theRung.fFuzzy<<", glue "<<theRung.bGlue<<", offset "
+                    <<theRung.fOffset<<")"<<endl;
+            }
+            return Standard_True;
+        }
+    }
+
+    FreeSolidList(m_ResultSolids);
+    m_ResultSolids->Append(m_InputSolid);
+    return Standard_False;
+}
+
+
+
+
+/** ********************************************************************
+* @brief Split the solid with the splitting surface and the options of
+*        one rung of the retry ladder
+*
+* @param TopoDS_Face & theFace
+*        BoolRung & theRung
+* @return Standard_Boolean
+*
+* @date 19/10/2026
+* @author  agent
+***********************************************************************/
+Standard_Boolean McCadBooleanOpt::SplitWithRung(TopoDS_Face & theFace, const BoolRung & theRung)
+{
     gp_Pnt posPnt, negPnt;  // Calculate the positive and negative points of the splitting face
 
     CalPoints(theFace,posPnt,negPnt);
@@ -274,19 +359,20 @@ Standard_Boolean McCadBooleanOpt::Split(TopoDS_Face & theFace)
         return Standard_False;
     }
 
-    if(SplitWithBoxes(PosBox,NegBox) && SplitWithBoxes(NegBox,PosBox))
+    if(SplitWithBoxes(PosBox,NegBox,theRung) && SplitWithBoxes(NegBox,PosBox,theRung))
     {
         PosBox.Free();
         NegBox.Free();
+        if(m_bLazyRepair)
+        {
+            return CheckNewFaces();     // Check the faces created by splitting only
+        }
         return CheckAndRepair(); // Check the geometry errors of output solids
     }
     else
     {
-        //FreeSolidList(m_ResultSolids);
         PosBox.Free();
         NegBox.Free();
-
-        m_ResultSolids->Append(m_InputSolid);
         return Standard_False;
     }
 }
@@ -299,53 +385,205 @@ Standard_Boolean McCadBooleanOpt::Split(TopoDS_Face & theFace)
 *        work, use subtract.
 *
 * @param TopoDS_Shape & theBoxA, TopoDS_Shape & theBoxB
+*        BoolRung & theRung ( Options of boolean operation )
 * @return Standard_Boolean
 *
 * @date 08/06/2016
+* @modify 19/10/2026
 * @author  Lei Lu
 ***********************************************************************/
 Standard_Boolean McCadBooleanOpt::SplitWithBoxes(TopoDS_Shape &theBoxA,
-                                                 TopoDS_Shape &theBoxB)
+                                                 TopoDS_Shape &theBoxB,
+                                                 const BoolRung &theRung)
+{
+    TopoDS_Shape ResultSolid;
+    if(PerformBoolean(theBoxA,m_InputSolid,Standard_True,theRung,ResultSolid))
+    {
+        m_ResultSolids->Append(ResultSolid);
+    }
+    else if(PerformBoolean(m_InputSolid,theBoxB,Standard_False,theRung,ResultSolid))
+    {
+        m_ResultSolids->Append(ResultSolid);
+    }
+    else
+    {
+        return Standard_False;
+    }
+
+    return Standard_True;
+}
+
+
+
+
+/** ********************************************************************
+* @brief Perform the common or cut operation with the options of rung.
+*        The operations run in parallel if the OCC version supports it.
+*        The result without solid is treated as a failure.
+*
+* @param TopoDS_Shape & theShapeA, TopoDS_Shape & theShapeB
+*        Standard_Boolean bCommon ( Common or cut )
+*        BoolRung & theRung
+*        TopoDS_Shape & theResult
+* @return Standard_Boolean
+*
+* @date 19/10/2026
+* @author  agent
+***********************************************************************/
+Standard_Boolean McCadBooleanOpt::PerformBoolean(const TopoDS_Shape &theShapeA,
+                                                 const TopoDS_Shape &theShapeB,
+                                                 Standard_Boolean bCommon,
+                                                 const BoolRung &theRung,
+                                                 TopoDS_Shape &theResult)
 {
     try
     {
-        BRepAlgoAPI_Common Common(theBoxA,m_InputSolid);
-        if(Common.IsDone())
+#if OCC_VERSION_HEX >= 0x060900
+        TopTools_ListOfShape listArgument, listTool;
+        listArgument.Append(theShapeA);
+        listTool.Append(theShapeB);
+
+        BRepAlgoAPI_Common Common;
+        BRepAlgoAPI_Cut Cutter;
+        BRepAlgoAPI_BooleanOperation *pBoolOpt = &Cutter;
+        if(bCommon)
         {
-            TopoDS_Shape ComSolid = Common.Shape();
-            m_ResultSolids->Append(ComSolid);
+            pBoolOpt = &Common;
         }
-        else
+
+        pBoolOpt->SetArguments(listArgument);
+        pBoolOpt->SetTools(listTool);
+        pBoolOpt->SetRunParallel(Standard_True);
+        pBoolOpt->SetFuzzyValue(theRung.fFuzzy);
+#if OCC_VERSION_HEX >= 0x070000
+        if(theRung.bGlue)
+        {
+            pBoolOpt->SetGlue(BOPAlgo_GlueShift);
+        }
+#endif
+        pBoolOpt->Build();
+        if(!pBoolOpt->IsDone())
         {
-            try
+            return Standard_False;
+        }
+        theResult = pBoolOpt->Shape();
+#else
+        /// Only the perturbed splitting surface can be retried
+        if(bCommon)
+        {
+            BRepAlgoAPI_Common Common(theShapeA,theShapeB);
+            if(!Common.IsDone())
             {
-                BRepAlgoAPI_Cut Cutter(m_InputSolid,theBoxB);
-                if(Cutter.IsDone())
-                {
-                    TopoDS_Shape CutSolid = Cutter.Shape();
-                    m_ResultSolids->Append(CutSolid);
-                }
-                Cutter.Destroy();
+                return Standard_False;
             }
-            catch(Standard_DomainError)
+            theResult = Common.Shape();
+            Common.Destroy();
+        }
+        else
+        {
+            BRepAlgoAPI_Cut Cutter(theShapeA,theShapeB);
+            if(!Cutter.IsDone())
             {
-                Standard_Failure::Caught()->Print(cout); cout << endl;
                 return Standard_False;
             }
+            theResult = Cutter.Shape();
+            Cutter.Destroy();
         }
-        Common.Destroy();
+#endif
     }
-    catch(Standard_DomainError)
+    catch(Standard_Failure)
     {
         Standard_Failure::Caught()->Print(cout); cout << endl;
         return Standard_False;
     }
 
-    return Standard_True;
+    if(theResult.IsNull())
+    {
+        return Standard_False;
+    }
+
+    TopExp_Explorer exp(theResult,TopAbs_SOLID);
+    return exp.More();
+}
+
+
+
+
+/** ********************************************************************
+* @brief Generate the retry ladder of boolean operation. The first rung
+*        is the plain operation, then the fuzzy value is increased, the
+*        glue option is used, and at last the splitting surface is moved
+*        a little to both sides.
+*
+* @param vector<BoolRung> & theLadder
+* @return void
+*
+* @date 19/10/2026
+* @author  agent
+***********************************************************************/
+void McCadBooleanOpt::GenRetryLadder(vector<BoolRung> & theLadder)
+{
+    BoolRung theRung;
+    theRung.fFuzzy = 0.0;
+    theRung.bGlue = Standard_False;
+    theRung.fOffset = 0.0;
+    theLadder.push_back(theRung);
+
+#if OCC_VERSION_HEX >= 0x060900
+    Standard_Real fFuzzy = McCadConvertConfig::GetBooleanFuzzyValue();
+    for(unsigned int i = 0; i < McCadConvertConfig::GetBooleanRetryNum(); i++)
+    {
+        theRung.fFuzzy = fFuzzy;
+        theLadder.push_back(theRung);
+        fFuzzy *= 10.0;
+    }
+#endif
+
+#if OCC_VERSION_HEX >= 0x070000
+    if(McCadConvertConfig::GetBooleanRetryNum() > 0)
+    {
+        theRung.bGlue = Standard_True;
+        theLadder.push_back(theRung);
+    }
+#endif
+
+    Standard_Real fOffset = McCadConvertConfig::GetBooleanPerturbation()*m_DglLength;
+    if(fOffset > 0.0)
+    {
+        theRung.fOffset = fOffset;
+        theLadder.push_back(theRung);
+        theRung.fOffset = -fOffset;
+        theLadder.push_back(theRung);
+    }
 }
 
 
 
+
+/** ********************************************************************
+* @brief Move the plane splitting surface along its normal
+*
+* @param TopoDS_Face & theFace
+*        Standard_Real fOffset ( Distance of moving )
+* @return TopoDS_Face
+*
+* @date 19/10/2026
+* @author  agent
+***********************************************************************/
+TopoDS_Face McCadBooleanOpt::MoveSplitFace(TopoDS_Face & theFace, Standard_Real fOffset)
+{
+    BRepAdaptor_Surface BS(theFace, Standard_True);
+    gp_Vec vecMove(BS.Plane().Axis().Direction());
+    gp_Trsf trsf;
+    trsf.SetTranslation(vecMove*fOffset);
+
+    BRepBuilderAPI_Transform theTransform(theFace, trsf, Standard_True);
+    return TopoDS::Face(theTransform.Shape());
+}
+
+
+
+
     //    Handle(ShapeFix_Solid) genericFix = new ShapeFix_Solid;
     //    genericFix->Init(m_InputSolid);
 
@@ -436,10 +674,113 @@ Standard_Boolean McCadBooleanOpt::SplitWithBoxes(TopoDS_Shape &theBoxA,
 ***********************************************************************/
 Standard_Boolean McCadBooleanOpt::CheckAndRepair()
 {
+    /** Remove the invalid solids */
+    Handle_TopTools_HSequenceOfShape NewSolidList = new TopTools_HSequenceOfShape;
+    RemoveSmallSolids(NewSolidList);
+
+    for(int i = 1; i <= NewSolidList->Length(); i++ )
+    {
+        TopoDS_Solid theSolid = TopoDS::Solid(NewSolidList->Value(i));
+
+        BRepCheck_Analyzer BrepAnalyzer(theSolid, Standard_True);
+
+        if(!BrepAnalyzer.IsValid())
+        {
+            if (!RebuildSolidFromShell( theSolid ))   // Rebuild the geometry
+            {
+                FreeSolidList(m_ResultSolids);
+                m_ResultSolids->Append(m_InputSolid);
+                return Standard_False;
+            }
+        }
+        m_ResultSolids->Append(theSolid);
+    }
+
+    FreeSolidList(NewSolidList);
+    return Standard_True;
+}
+
+
+
+
+/** ********************************************************************
+* @brief Check only the faces which are not on the surfaces of input
+*        solid. They are created by the splitting, the other faces are
+*        trimmed from the faces of input solid which have been checked.
+*        The solid is rebuilt only if the new faces have errors.
+*
+* @param
+* @return Standard_Boolean
+*
+* @date 19/10/2026
+* @author  agent
+***********************************************************************/
+Standard_Boolean McCadBooleanOpt::CheckNewFaces()
+{
+    Handle_TopTools_HSequenceOfShape NewSolidList = new TopTools_HSequenceOfShape;
+    RemoveSmallSolids(NewSolidList);
+
+    /// The boolean operation keeps the surface geometries of modified faces
+    TColStd_MapOfTransient mapInputSurf;
     TopExp_Explorer exp;
+    for(exp.Init(m_InputSolid,TopAbs_FACE); exp.More(); exp.Next())
+    {
+        TopLoc_Location loc;
+        mapInputSurf.Add(BRep_Tool::Surface(TopoDS::Face(exp.Current()),loc));
+    }
 
-    /** Remove the invalid solids */
-    Handle_TopTools_HSequenceOfShape NewSolidList = new TopTools_HSequenceOfShape;    
+    for(int i = 1; i <= NewSolidList->Length(); i++ )
+    {
+        TopoDS_Solid theSolid = TopoDS::Solid(NewSolidList->Value(i));
+
+        Standard_Boolean bValid = Standard_True;
+        for(exp.Init(theSolid,TopAbs_FACE); exp.More(); exp.Next())
+        {
+            TopoDS_Face face = TopoDS::Face(exp.Current());
+
+            TopLoc_Location loc;
+            if(mapInputSurf.Contains(BRep_Tool::Surface(face,loc)))
+            {
+                continue;
+            }
+
+            BRepCheck_Analyzer FaceAnalyzer(face, Standard_True);
+            if(!FaceAnalyzer.IsValid())
+            {
+                bValid = Standard_False;
+                break;
+            }
+        }
+
+        if(!bValid && !RebuildSolidFromShell(theSolid))
+        {
+            FreeSolidList(m_ResultSolids);
+            m_ResultSolids->Append(m_InputSolid);
+            return Standard_False;
+        }
+        m_ResultSolids->Append(theSolid);
+    }
+
+    FreeSolidList(NewSolidList);
+    return Standard_True;
+}
+
+
+
+
+/** ********************************************************************
+* @brief Move the solids of result shapes into the list, the null solids
+*        and the solids with small volume are removed
+*
+* @param Handle_TopTools_HSequenceOfShape & theList
+* @return void
+*
+* @date 19/10/2026
+* @author  agent
+***********************************************************************/
+void McCadBooleanOpt::RemoveSmallSolids(Handle_TopTools_HSequenceOfShape & theList)
+{
+    TopExp_Explorer exp;
 
     for(int i = 1; i <= m_ResultSolids->Length(); i++ )
     {
@@ -463,35 +804,36 @@ Standard_Boolean McCadBooleanOpt::CheckAndRepair()
                 cout<<"#Solid with small volume--------------------"<<GPsolid.Mass()<<endl;
                 continue;
             }
-            NewSolidList->Append(tmpSolid);
+            theList->Append(tmpSolid);
         }
     }
 
     FreeSolidList(m_ResultSolids);
+}
 
-    for(int i = 1; i <= NewSolidList->Length(); i++ )
-    {
-        TopoDS_Solid theSolid = TopoDS::Solid(NewSolidList->Value(i));
 
-        BRepCheck_Analyzer BrepAnalyzer(theSolid, Standard_True);
 
-        if(!BrepAnalyzer.IsValid())
-        {
-            if (!RebuildSolidFromShell( theSolid ))   // Rebuild the geometry
-            {
-                FreeSolidList(m_ResultSolids);
-                m_ResultSolids->Append(m_InputSolid);
-                return Standard_False;
-            }
-        }
-        else
-        {
-            m_ResultSolids->Append(theSolid);
-        }
+
+/** ********************************************************************
+* @brief Check the solid and rebuild it if it has errors. It is used for
+*        the solids split with lazy repair, when they become the final
+*        solids or the next splitting fails.
+*
+* @param TopoDS_Solid & theSolid
+* @return Standard_Boolean ( The solid had errors and has been healed )
+*
+* @date 19/10/2026
+* @author  agent
+***********************************************************************/
+Standard_Boolean McCadBooleanOpt::RepairSolid(TopoDS_Solid & theSolid)
+{
+    BRepCheck_Analyzer BrepAnalyzer(theSolid, Standard_True);
+    if(BrepAnalyzer.IsValid())
+    {
+        return Standard_False;
     }
 
-    FreeSolidList(NewSolidList);
-    return Standard_True;
+    return RebuildSolidFromShell(theSolid);
 }
 
 
@@ -499,9 +841,10 @@ Standard_Boolean McCadBooleanOpt::CheckAndRepair()
 
 
 /** ********************************************************************
-* @brief Rebuild the geometry by sewing the faces of shell with errors
+* @brief Rebuild the geometry by sewing the faces of shell with errors,
+*        the healed solid replaces the input solid
 *
-* @param
+* @param TopoDS_Solid & theSolid
 * @return Standard_Boolean
 *
 * @date 01/06/2016
@@ -558,13 +901,18 @@ Standard_Boolean McCadBooleanOpt::RebuildSolidFromShell(TopoDS_Solid & theSolid)
         }
     }
 
+    if(shape.IsNull() || shape.ShapeType() != TopAbs_SOLID)
+    {
+        return Standard_False;
+    }
+
     BRepCheck_Analyzer BA(shape, Standard_True);
     if(BA.IsValid())
     {
         cout<<"#          -> OK! The solid has been healed                 "<<endl;
         cout<<"#-----------------------------------------------------------"<<endl;
         bHasError = Standard_True;
-        m_ResultSolids->Append(shape);
+        theSolid = TopoDS::Solid(shape);
     }
     else
     {
@@ -39,11 +39,20 @@ public:
 
 private:
 
+    /** The options of boolean operation on one rung of the retry ladder */
+    struct BoolRung
+    {
+        Standard_Real fFuzzy;           /**< Fuzzy value, 0 is the default tolerance */
+        Standard_Boolean bGlue;         /**< Use the glue option */
+        Standard_Real fOffset;          /**< Distance of moving the splitting surface */
+    };
+
     TopoDS_Solid m_InputSolid;                          /**< Input solid for boolean operation */
     TopoDS_Face m_SplitFace;                            /**< Splitting surface */
     TopoDS_Shape m_BndBox;                              /**< The boundary box of split solid */
     Standard_Real m_DglLength;                          /**< The length of diagonal of boundary box */
     Handle_TopTools_HSequenceOfShape m_ResultSolids;    /**< The splitted result solid list */
+    Standard_Boolean m_bLazyRepair;                     /**< Only check the new faces of result solids */
 
 public:
 
@@ -52,14 +61,18 @@ public:
     /**< Get the result solids after splitting */
     void GetResultSolids(Handle_TopTools_HSequenceOfShape & solid_list);
     Standard_Boolean Perform();                /**< Perform the splitting */
+    /**< Only check the faces created by splitting, leave the full repair to caller */
+    void SetLazyRepair(Standard_Boolean bLazy);
+    /**< Check the solid and rebuild it if it has errors, return true if it is healed */
+    static Standard_Boolean RepairSolid(TopoDS_Solid &theSolid);
 
 
 private:
 
-    /**< Split solid with splittin surface */
+    /**< Split solid with plane or cylinder splittin surface along the retry ladder */
     Standard_Boolean Split(TopoDS_Face &split_face);
-    /**< Split solid with cylinder surface */
-    Standard_Boolean SplitCyln(TopoDS_Face & theFace);
+    /**< Split solid with cylinder surface with the options of one rung */
+    Standard_Boolean SplitCylnWithRung(TopoDS_Face & theFace, const BoolRung &theRung);
     /**< Create extended splitting surface */
     TopoDS_Face CrtExtSplitFace();
     /**< Calculate the positive point and negative point of splitting surface */
@@ -68,12 +81,27 @@ private:
     void CalBndBox();
     /**< Check the errors of output solids */
     Standard_Boolean CheckAndRepair();
+    /**< Check the faces created by splitting of output solids */
+    Standard_Boolean CheckNewFaces();
+    /**< Collect the result solids, remove the null and small solids */
+    void RemoveSmallSolids(Handle_TopTools_HSequenceOfShape & theList);
     /** Free the solid list */
     void FreeSolidList(Handle_TopTools_HSequenceOfShape & theList);
     /** Rebuild the solid from shells with error */
-    Standard_Boolean RebuildSolidFromShell(TopoDS_Solid &theSolid);
+    static Standard_Boolean RebuildSolidFromShell(TopoDS_Solid &theSolid);
     /** Split the solid with positive and negative half boxes */
-    Standard_Boolean SplitWithBoxes(TopoDS_Shape &theBoxA, TopoDS_Shape &theBoxB);
+    Standard_Boolean SplitWithBoxes(TopoDS_Shape &theBoxA, TopoDS_Shape &theBoxB,
+                                    const BoolRung &theRung);
+    /** Split the solid with the options of one rung */
+    Standard_Boolean SplitWithRung(TopoDS_Face &theFace, const BoolRung &theRung);
+    /** Perform the common or cut with the options of rung */
+    Standard_Boolean PerformBoolean(const TopoDS_Shape &theShapeA, const TopoDS_Shape &theShapeB,
+                                    Standard_Boolean bCommon, const BoolRung &theRung,
+                                    TopoDS_Shape &theResult);
+    /** Generate the retry ladder of boolean operation */
+    void GenRetryLadder(vector<BoolRung> &theLadder);
+    /** Move the plane splitting surface along its normal */
+    TopoDS_Face MoveSplitFace(TopoDS_Face &theFace, Standard_Real fOffset);
 
     /**< Remove the internal wires of surfaces */
     TopoDS_Shape RemoveInternalWires(TopoDS_Shape & theSolid);
@@ -0,0 +1,561 @@
+#include "McCadBoxCollision.hxx"
+
+#include <math.h>
+#include <gp_XYZ.hxx>
+#include <gp_Pln.hxx>
+#include <gp_Cone.hxx>
+#include <gp_Cylinder.hxx>
+#include <gp_Sphere.hxx>
+#include <gp_Torus.hxx>
+
+#define BOX_SEARCH_DEPTH    4       /**< Max level of dividing the box for cone and torus */
+
+McCadBoxCollision::McCadBoxCollision()
+{
+}
+
+McCadBoxCollision::~McCadBoxCollision()
+{
+}
+
+
+
+/** ********************************************************************
+* @brief Separating axis test of triangle and box. The triangle and box
+*        are projected on the axes of box, the normal of triangle and
+*        the cross products of the axes of box and the edges, if they
+*        are separated on one of the axes, they have no common point.
+*        The touching triangle and box have common points.
+*
+* @param const gp_Pnt & P1, const gp_Pnt & P2, const gp_Pnt & P3
+*        const gp_Pnt & min_pnt, const gp_Pnt & max_pnt
+* @return Standard_Boolean
+*
+* @date 19/10/2026
+* @author  agent
+***********************************************************************/
+Standard_Boolean McCadBoxCollision::TriangleBox(const gp_Pnt & P1, const gp_Pnt & P2, const gp_Pnt & P3,
+                                                const gp_Pnt & min_pnt, const gp_Pnt & max_pnt)
+{
+    /// Move the center of box to the origin
+    Standard_Real fHalf[3], fVex[3][3];
+    for (Standard_Integer k = 0; k < 3; k++)
+    {
+        Standard_Real fCen = 0.5*(min_pnt.Coord(k+1) + max_pnt.Coord(k+1));
+        fHalf[k] = 0.5*(max_pnt.Coord(k+1) - min_pnt.Coord(k+1));
+        fVex[0][k] = P1.Coord(k+1) - fCen;
+        fVex[1][k] = P2.Coord(k+1) - fCen;
+        fVex[2][k] = P3.Coord(k+1) - fCen;
+    }
+
+    /// The axes of box
+    for (Standard_Integer k = 0; k < 3; k++)
+    {
+        Standard_Real fLow = Min(fVex[0][k], Min(fVex[1][k], fVex[2][k]));
+        Standard_Real fHigh = Max(fVex[0][k], Max(fVex[1][k], fVex[2][k]));
+        if (fLow > fHalf[k] || fHigh < -fHalf[k])
+        {
+            return Standard_False;
+        }
+    }
+
+    Standard_Real fEdge[3][3];
+    for (Standard_Integer k = 0; k < 3; k++)
+    {
+        fEdge[0][k] = fVex[1][k] - fVex[0][k];
+        fEdge[1][k] = fVex[2][k] - fVex[1][k];
+        fEdge[2][k] = fVex[0][k] - fVex[2][k];
+    }
+
+    /// The normal of triangle, it is skipped if the triangle is degenerated
+    /// to a segment whose normal is only the rounding error.
+    Standard_Real fNorm[3];
+    fNorm[0] = fEdge[0][1]*fEdge[1][2] - fEdge[0][2]*fEdge[1][1];
+    fNorm[1] = fEdge[0][2]*fEdge[1][0] - fEdge[0][0]*fEdge[1][2];
+    fNorm[2] = fEdge[0][0]*fEdge[1][1] - fEdge[0][1]*fEdge[1][0];
+    Standard_Real fNormLen = fNorm[0]*fNorm[0] + fNorm[1]*fNorm[1] + fNorm[2]*fNorm[2];
+    Standard_Real fEdgeLen = (fEdge[0][0]*fEdge[0][0] + fEdge[0][1]*fEdge[0][1] + fEdge[0][2]*fEdge[0][2])
+                            *(fEdge[1][0]*fEdge[1][0] + fEdge[1][1]*fEdge[1][1] + fEdge[1][2]*fEdge[1][2]);
+    Standard_Real fRadius = 0.0;
+    if (fNormLen > 1.0e-24*fEdgeLen)
+    {
+        Standard_Real fDist = fNorm[0]*fVex[0][0] + fNorm[1]*fVex[0][1] + fNorm[2]*fVex[0][2];
+        fRadius = fHalf[0]*fabs(fNorm[0]) + fHalf[1]*fabs(fNorm[1]) + fHalf[2]*fabs(fNorm[2]);
+        if (fabs(fDist) > fRadius)
+        {
+            return Standard_False;
+        }
+    }
+
+    /// The cross products of the axes of box and the edges of triangle
+    for (Standard_Integer k = 0; k < 3; k++)
+    {
+        for (Standard_Integer j = 0; j < 3; j++)
+        {
+            Standard_Real fAxis[3] = {0.0, 0.0, 0.0};
+            Standard_Integer k1 = (k+1)%3, k2 = (k+2)%3;
+            fAxis[k1] = -fEdge[j][k2];
+            fAxis[k2] = fEdge[j][k1];
+
+            Standard_Real fLow = RealLast(), fHigh = -RealLast();
+            for (Standard_Integer i = 0; i < 3; i++)
+            {
+                Standard_Real fProj = fAxis[k1]*fVex[i][k1] + fAxis[k2]*fVex[i][k2];
+                fLow = Min(fLow, fProj);
+                fHigh = Max(fHigh, fProj);
+            }
+            fRadius = fHalf[k1]*fabs(fAxis[k1]) + fHalf[k2]*fabs(fAxis[k2]);
+            if (fLow > fRadius || fHigh < -fRadius)
+            {
+                return Standard_False;
+            }
+        }
+    }
+
+    return Standard_True;
+}
+
+
+
+/** ********************************************************************
+* @brief Calculate the position of box to the surface. The box crosses
+*        the surface if it has points below -fTol and above fTol. The
+*        distance range of plane, sphere and cylinder is calculated. For
+*        cone and torus, the box is divided, the sub-box is skipped if the
+*        distance of its center is beyond its half diagonal. If the sides
+*        can not be decided at the last level, the box is taken as crossed.
+*        The surface of revolution and the free form surfaces are not
+*        evaluated, their position is unknown.
+*
+* @param const GeomAdaptor_Surface & theSurf
+*        const gp_Pnt & min_pnt, const gp_Pnt & max_pnt
+*        Standard_Real fTol
+* @return BoxPosition
+*
+* @date 19/10/2026
+* @author  agent
+***********************************************************************/
+BoxPosition McCadBoxCollision::SurfaceBox(const GeomAdaptor_Surface & theSurf,
+                                          const gp_Pnt & min_pnt, const gp_Pnt & max_pnt,
+                                          Standard_Real fTol)
+{
+    SurfParam theParam;
+    if (!GetSurfParam(theSurf, theParam))
+    {
+        return BoxUnknownPosition;
+    }
+
+    Standard_Real fMin[3] = {min_pnt.X(), min_pnt.Y(), min_pnt.Z()};
+    Standard_Real fMax[3] = {max_pnt.X(), max_pnt.Y(), max_pnt.Z()};
+
+    Standard_Real fLow = 0.0, fHigh = 0.0;     // The range of the signed distance in box
+    switch (theParam.eType)
+    {
+        case GeomAbs_Plane:
+        {
+            gp_Pnt cen_pnt((fMin[0]+fMax[0])/2, (fMin[1]+fMax[1])/2, (fMin[2]+fMax[2])/2);
+            Standard_Real fDist = SignedDistance(theParam, cen_pnt);
+            Standard_Real fRadius = 0.0;
+            for (Standard_Integer k = 0; k < 3; k++)
+            {
+                fRadius += 0.5*(fMax[k] - fMin[k])*fabs(theParam.Axis.Coord(k+1));
+            }
+            fLow = fDist - fRadius;
+            fHigh = fDist + fRadius;
+            break;
+        }
+        case GeomAbs_Sphere:
+        {
+            Standard_Real fNear = 0.0, fFar = 0.0;
+            for (Standard_Integer k = 0; k < 3; k++)
+            {
+                Standard_Real fCoord = theParam.Origin.Coord(k+1);
+                Standard_Real fGap = Max(0.0, Max(fMin[k] - fCoord, fCoord - fMax[k]));
+                Standard_Real fSide = Max(fabs(fCoord - fMin[k]), fabs(fCoord - fMax[k]));
+                fNear += fGap*fGap;
+                fFar += fSide*fSide;
+            }
+            fLow = sqrt(fNear) - theParam.fMajor;
+            fHigh = sqrt(fFar) - theParam.fMajor;
+            break;
+        }
+        case GeomAbs_Cylinder:
+        {
+            AxisDistRange(theParam, fMin, fMax, fLow, fHigh);
+            fLow -= theParam.fMajor;
+            fHigh -= theParam.fMajor;
+            break;
+        }
+        default:
+        {
+            /// Check the vertexes of box firstly, then divide the box
+            Standard_Boolean bBelow = Standard_False, bAbove = Standard_False;
+            for (Standard_Integer i = 0; i < 8; i++)
+            {
+                Standard_Real fDist = SignedDistance(theParam, BoxVertex(min_pnt, max_pnt, i));
+                if (fDist < -fTol) bBelow = Standard_True;
+                if (fDist > fTol) bAbove = Standard_True;
+            }
+
+            Standard_Boolean bUnresolved = Standard_False;
+            if (!bBelow || !bAbove)
+            {
+                bUnresolved = SearchSides(theParam, fMin, fMax, fTol, 0, bBelow, bAbove);
+            }
+
+            if ((bBelow && bAbove) || bUnresolved)
+            {
+                return BoxCrossSurf;
+            }
+            return bBelow ? BoxBelowSurf : BoxAboveSurf;
+        }
+    }
+
+    if (fLow < -fTol && fHigh > fTol)
+    {
+        return BoxCrossSurf;
+    }
+    return fHigh <= fTol ? BoxBelowSurf : BoxAboveSurf;
+}
+
+
+
+/** ********************************************************************
+* @brief Calculate the signed distances from the eight vertexes of box to
+*        the surface, the parameters of surface are read once for them.
+*        The distance is minus at the inside of the surface as the
+*        McCadEvaluator gives.
+*
+* @param const GeomAdaptor_Surface & theSurf
+*        const gp_Pnt & min_pnt, const gp_Pnt & max_pnt
+*        Standard_Real * fDist     The distances of the vertexes given by BoxVertex
+* @return Standard_Boolean
+*
+* @date 19/10/2026
+* @author  agent
+***********************************************************************/
+Standard_Boolean McCadBoxCollision::VertexDistance(const GeomAdaptor_Surface & theSurf,
+                                                   const gp_Pnt & min_pnt, const gp_Pnt & max_pnt,
+                                                   Standard_Real * fDist)
+{
+    SurfParam theParam;
+    if (!GetSurfParam(theSurf, theParam))
+    {
+        return Standard_False;
+    }
+
+    for (Standard_Integer i = 0; i < 8; i++)
+    {
+        fDist[i] = SignedDistance(theParam, BoxVertex(min_pnt, max_pnt, i));
+    }
+    return Standard_True;
+}
+
+
+
+/** ********************************************************************
+* @brief Get the vertex of box, the first, second and third bit of the
+*        index choose the max x, y and z coordinates.
+*
+* @param const gp_Pnt & min_pnt, const gp_Pnt & max_pnt
+*        Standard_Integer i     Index from 0 to 7
+* @return gp_Pnt
+*
+* @date 19/10/2026
+* @author  agent
+***********************************************************************/
+gp_Pnt McCadBoxCollision::BoxVertex(const gp_Pnt & min_pnt, const gp_Pnt & max_pnt, Standard_Integer i)
+{
+    return gp_Pnt((i & 1) ? max_pnt.X() : min_pnt.X(),
+                  (i & 2) ? max_pnt.Y() : min_pnt.Y(),
+                  (i & 4) ? max_pnt.Z() : min_pnt.Z());
+}
+
+
+
+/** ********************************************************************
+* @brief Read the parameters of the surface, the sign of distance is
+*        same as the surface equation given by the coefficients
+*
+* @param const GeomAdaptor_Surface & theSurf
+*        SurfParam & theParam
+* @return Standard_Boolean
+*
+* @date 19/10/2026
+* @author  agent
+***********************************************************************/
+Standard_Boolean McCadBoxCollision::GetSurfParam(const GeomAdaptor_Surface & theSurf, SurfParam & theParam)
+{
+    theParam.eType = theSurf.GetType();
+    theParam.fMajor = 0.0;
+    theParam.fMinor = 0.0;
+    theParam.fSin = 0.0;
+    theParam.fCos = 1.0;
+
+    switch (theParam.eType)
+    {
+        case GeomAbs_Plane:
+        {
+            /// The normal is same as gp_Pln::Coefficients used by McCadEvaluator
+            /// and McCadGeomPlane, it is reversed for the indirect coordinate system
+            gp_Pln plane = theSurf.Plane();
+            theParam.Origin = plane.Location();
+            theParam.Axis = plane.Axis().Direction();
+            if (!plane.Position().Direct())
+            {
+                theParam.Axis.Reverse();
+            }
+            return Standard_True;
+        }
+        case GeomAbs_Cylinder:
+        {
+            /// The distances to cylinder, cone and torus do not change with the
+            /// direction of axis, the indirect coordinate system gives the same sign
+            gp_Cylinder cylinder = theSurf.Cylinder();
+            theParam.Origin = cylinder.Location();
+            theParam.Axis = cylinder.Axis().Direction();
+            theParam.fMajor = cylinder.Radius();
+            return Standard_True;
+        }
+        case GeomAbs_Cone:
+        {
+            gp_Cone cone = theSurf.Cone();
+            theParam.Origin = cone.Apex();
+            theParam.Axis = cone.Axis().Direction();
+            theParam.fSin = sin(fabs(cone.SemiAngle()));
+            theParam.fCos = cos(fabs(cone.SemiAngle()));
+            return Standard_True;
+        }
+        case GeomAbs_Sphere:
+        {
+            gp_Sphere sphere = theSurf.Sphere();
+            theParam.Origin = sphere.Location();
+            theParam.fMajor = sphere.Radius();
+            return Standard_True;
+        }
+        case GeomAbs_Torus:
+        {
+            gp_Torus torus = theSurf.Torus();
+            theParam.Origin = torus.Location();
+            theParam.Axis = torus.Axis().Direction();
+            theParam.fMajor = torus.MajorRadius();
+            theParam.fMinor = torus.MinorRadius();
+            return Standard_True;
+        }
+        default:
+        {
+            return Standard_False;
+        }
+    }
+}
+
+
+
+/** ********************************************************************
+* @brief The signed distance from the point to the surface, it is minus
+*        inside the sphere, cylinder, cone and torus. The distance to
+*        cone is the distance to the two lines of its section through
+*        the axis. The change of the distance is not larger than the
+*        moving of the point.
+*
+* @param const SurfParam & theParam
+*        const gp_Pnt & thePnt
+* @return Standard_Real
+*
+* @date 19/10/2026
+* @author  agent
+***********************************************************************/
+Standard_Real McCadBoxCollision::SignedDistance(const SurfParam & theParam, const gp_Pnt & thePnt)
+{
+    gp_XYZ vec = thePnt.XYZ() - theParam.Origin.XYZ();
+    if (theParam.eType == GeomAbs_Plane)
+    {
+        return vec.Dot(theParam.Axis.XYZ());
+    }
+    if (theParam.eType == GeomAbs_Sphere)
+    {
+        return vec.Modulus() - theParam.fMajor;
+    }
+
+    Standard_Real fAxial = vec.Dot(theParam.Axis.XYZ());
+    Standard_Real fRadial = (vec - fAxial*theParam.Axis.XYZ()).Modulus();
+
+    switch (theParam.eType)
+    {
+        case GeomAbs_Cylinder:
+        {
+            return fRadial - theParam.fMajor;
+        }
+        case GeomAbs_Cone:
+        {
+            Standard_Real fDist = RealLast();
+            for (Standard_Integer i = 0; i < 2; i++)
+            {
+                Standard_Real fDirX = (i == 0) ? theParam.fCos : -theParam.fCos;
+                Standard_Real fDirY = theParam.fSin;
+                Standard_Real fProj = fAxial*fDirX + fRadial*fDirY;
+                Standard_Real fLine = (fProj <= 0.0) ? sqrt(fAxial*fAxial + fRadial*fRadial)
+                                                    : fabs(fAxial*fDirY - fRadial*fDirX);
+                fDist = Min(fDist, fLine);
+            }
+            return (fRadial*theParam.fCos < fabs(fAxial)*theParam.fSin) ? -fDist : fDist;
+        }
+        case GeomAbs_Torus:
+        {
+            Standard_Real fRing = fRadial - theParam.fMajor;
+            return sqrt(fRing*fRing + fAxial*fAxial) - theParam.fMinor;
+        }
+        default:
+        {
+            return 0.0;
+        }
+    }
+}
+
+
+
+/** ********************************************************************
+* @brief The range of distance from the points in box to the axis. The
+*        largest one is at the vertexes. The smallest one is zero if the
+*        axis goes through the box, otherwise it is at the edges.
+*
+* @param const SurfParam & theParam
+*        const Standard_Real * fMin, const Standard_Real * fMax
+*        Standard_Real & fLow, Standard_Real & fHigh
+* @return void
+*
+* @date 19/10/2026
+* @author  agent
+***********************************************************************/
+void McCadBoxCollision::AxisDistRange(const SurfParam & theParam, const Standard_Real * fMin,
+                                      const Standard_Real * fMax, Standard_Real & fLow, Standard_Real & fHigh)
+{
+    const gp_XYZ & axis = theParam.Axis.XYZ();
+
+    /// The vectors from the axis to the vertexes, perpendicular to the axis
+    gp_XYZ perp_list[8];
+    fHigh = 0.0;
+    for (Standard_Integer i = 0; i < 8; i++)
+    {
+        gp_XYZ vec((i & 1) ? fMax[0] : fMin[0],
+                   (i & 2) ? fMax[1] : fMin[1],
+                   (i & 4) ? fMax[2] : fMin[2]);
+        vec -= theParam.Origin.XYZ();
+        perp_list[i] = vec - vec.Dot(axis)*axis;
+        fHigh = Max(fHigh, perp_list[i].Modulus());
+    }
+
+    /// Clip the axis with the slabs of box
+    Standard_Real fEnter = -RealLast(), fExit = RealLast();
+    Standard_Boolean bThrough = Standard_True;
+    for (Standard_Integer k = 0; k < 3 && bThrough; k++)
+    {
+        Standard_Real fOrg = theParam.Origin.Coord(k+1);
+        Standard_Real fDir = axis.Coord(k+1);
+        if (fabs(fDir) < 1.0e-12)
+        {
+            bThrough = (fOrg >= fMin[k] && fOrg <= fMax[k]);
+            continue;
+        }
+        Standard_Real t1 = (fMin[k] - fOrg)/fDir;
+        Standard_Real t2 = (fMax[k] - fOrg)/fDir;
+        fEnter = Max(fEnter, Min(t1, t2));
+        fExit = Min(fExit, Max(t1, t2));
+        bThrough = (fEnter <= fExit);
+    }
+
+    if (bThrough)
+    {
+        fLow = 0.0;
+        return;
+    }
+
+    /// The distance is convex, the nearest point on the edge is calculated
+    fLow = RealLast();
+    for (Standard_Integer i = 0; i < 8; i++)
+    {
+        for (Standard_Integer iBit = 1; iBit < 8; iBit <<= 1)
+        {
+            if (i & iBit)
+            {
+                continue;
+            }
+            const gp_XYZ & u = perp_list[i];
+            gp_XYZ v = perp_list[i | iBit] - perp_list[i];
+            Standard_Real fLen = v.SquareModulus();
+            Standard_Real s = (fLen > 0.0) ? -u.Dot(v)/fLen : 0.0;
+            s = Max(0.0, Min(1.0, s));
+            fLow = Min(fLow, (u + s*v).Modulus());
+        }
+    }
+}
+
+
+
+/** ********************************************************************
+* @brief Divide the box into eight sub-boxes recursively, find the points
+*        below and above the surface. The sub-box is not divided if its
+*        points can not give the side not found yet.
+*
+* @param const SurfParam & theParam
+*        const Standard_Real * fMin, const Standard_Real * fMax
+*        Standard_Real fTol
+*        Standard_Integer iDepth
+*        Standard_Boolean & bBelow, Standard_Boolean & bAbove
+* @return Standard_Boolean     The sides can not be decided at the last level
+*
+* @date 19/10/2026
+* @author  agent
+***********************************************************************/
+Standard_Boolean McCadBoxCollision::SearchSides(const SurfParam & theParam, const Standard_Real * fMin,
+                                                const Standard_Real * fMax, Standard_Real fTol,
+                                                Standard_Integer iDepth, Standard_Boolean & bBelow,
+                                                Standard_Boolean & bAbove)
+{
+    Standard_Real fCen[3], fHalf = 0.0;
+    for (Standard_Integer k = 0; k < 3; k++)
+    {
+        fCen[k] = 0.5*(fMin[k] + fMax[k]);
+        fHalf += (fMax[k] - fMin[k])*(fMax[k] - fMin[k]);
+    }
+    fHalf = 0.5*sqrt(fHalf);
+
+    Standard_Real fDist = SignedDistance(theParam, gp_Pnt(fCen[0], fCen[1], fCen[2]));
+    if (fDist < -fTol) bBelow = Standard_True;
+    if (fDist > fTol) bAbove = Standard_True;
+    if (bBelow && bAbove)
+    {
+        return Standard_False;
+    }
+
+    /// The distance in the box differs from the center within the half diagonal
+    Standard_Boolean bNeed = (!bBelow && fDist - fHalf < -fTol) || (!bAbove && fDist + fHalf > fTol);
+    if (!bNeed)
+    {
+        return Standard_False;
+    }
+    if (iDepth >= BOX_SEARCH_DEPTH)
+    {
+        return Standard_True;
+    }
+
+    Standard_Boolean bUnresolved = Standard_False;
+    for (Standard_Integer i = 0; i < 8; i++)
+    {
+        Standard_Real fSubMin[3], fSubMax[3];
+        for (Standard_Integer k = 0; k < 3; k++)
+        {
+            fSubMin[k] = (i & (1 << k)) ? fCen[k] : fMin[k];
+            fSubMax[k] = (i & (1 << k)) ? fMax[k] : fCen[k];
+        }
+        if (SearchSides(theParam, fSubMin, fSubMax, fTol, iDepth+1, bBelow, bAbove))
+        {
+            bUnresolved = Standard_True;
+        }
+        if (bBelow && bAbove)
+        {
+            return Standard_False;
+        }
+    }
+    return bUnresolved;
+}
@@ -0,0 +1,86 @@
+#ifndef MCCADBOXCOLLISION_HXX
+#define MCCADBOXCOLLISION_HXX
+
+#include <Standard.hxx>
+#include <Standard_Real.hxx>
+#include <GeomAdaptor_Surface.hxx>
+#include <GeomAbs_SurfaceType.hxx>
+#include <gp_Pnt.hxx>
+#include <gp_Dir.hxx>
+
+/** The position of axis aligned box to a surface */
+enum BoxPosition{ BoxBelowSurf,         /**< The box is at the negative side */
+                  BoxAboveSurf,         /**< The box is at the positive side */
+                  BoxCrossSurf,         /**< The surface goes through the box */
+                  BoxUnknownPosition};  /**< The surface can not be evaluated */
+
+/** Collision detection between the axis aligned void box and the triangles or
+    the surfaces of solids. The triangle is checked with separating axis test.
+    The surface is classified with the distance from the box points, the range
+    of distance is calculated for plane, sphere and cylinder, the box is divided
+    for cone and torus until the both sides are found or excluded. */
+class McCadBoxCollision
+{
+public:
+
+    void* operator new(size_t,void* anAddress)
+    {
+      return anAddress;
+    }
+    void* operator new(size_t size)
+    {
+      return Standard::Allocate(size);
+    }
+    void  operator delete(void *anAddress)
+    {
+      if (anAddress) Standard::Free((Standard_Address&)anAddress);
+    }
+
+    McCadBoxCollision();
+    ~McCadBoxCollision();
+
+public:
+
+    /**< The triangle and the box have common points or not */
+    Standard_EXPORT static Standard_Boolean TriangleBox(const gp_Pnt & P1, const gp_Pnt & P2, const gp_Pnt & P3,
+                                                        const gp_Pnt & min_pnt, const gp_Pnt & max_pnt);
+    /**< The position of the box to the surface, the points within fTol to surface are on it */
+    Standard_EXPORT static BoxPosition SurfaceBox(const GeomAdaptor_Surface & theSurf,
+                                                  const gp_Pnt & min_pnt, const gp_Pnt & max_pnt,
+                                                  Standard_Real fTol);
+    /**< The signed distances from the vertexes of box to the surface, false if it is not supported */
+    Standard_EXPORT static Standard_Boolean VertexDistance(const GeomAdaptor_Surface & theSurf,
+                                                           const gp_Pnt & min_pnt, const gp_Pnt & max_pnt,
+                                                           Standard_Real * fDist);
+    /**< The vertex of box, the bits of index choose the max coordinates */
+    Standard_EXPORT static gp_Pnt BoxVertex(const gp_Pnt & min_pnt, const gp_Pnt & max_pnt, Standard_Integer i);
+
+private:
+
+    /** The parameters of surface for calculating the distance */
+    struct SurfParam
+    {
+        GeomAbs_SurfaceType eType;      /**< Type of surface */
+        gp_Pnt Origin;                  /**< Point on plane, center or apex */
+        gp_Dir Axis;                    /**< Normal of plane or axis of surface */
+        Standard_Real fMajor;           /**< Radius or major radius of torus */
+        Standard_Real fMinor;           /**< Minor radius of torus */
+        Standard_Real fSin;             /**< Sine of semi-angle of cone */
+        Standard_Real fCos;             /**< Cosine of semi-angle of cone */
+    };
+
+    /**< Read the parameters of the surface, false if it is not supported */
+    static Standard_Boolean GetSurfParam(const GeomAdaptor_Surface & theSurf, SurfParam & theParam);
+    /**< The signed distance from the point to the surface */
+    static Standard_Real SignedDistance(const SurfParam & theParam, const gp_Pnt & thePnt);
+    /**< The range of distance from the points in box to the axis */
+    static void AxisDistRange(const SurfParam & theParam, const Standard_Real * fMin,
+                              const Standard_Real * fMax, Standard_Real & fLow, Standard_Real & fHigh);
+    /**< Divide the box to find the points at the two sides of surface */
+    static Standard_Boolean SearchSides(const SurfParam & theParam, const Standard_Real * fMin,
+                                        const Standard_Real * fMax, Standard_Real fTol,
+                                        Standard_Integer iDepth, Standard_Boolean & bBelow,
+                                        Standard_Boolean & bAbove);
+};
+
+#endif // MCCADBOXCOLLISION_HXX
@@ -6,6 +6,16 @@
 
 bool McCadConvertConfig::m_bWriteCollisionFile =false;
 bool McCadConvertConfig::m_bVoidGenerate = true;
+bool McCadConvertConfig::m_bPlanarBSP = false;
+bool McCadConvertConfig::m_bMergeConvex = false;
+bool McCadConvertConfig::m_bReuseSurf = false;
+bool McCadConvertConfig::m_bSymbolic = false;
+bool McCadConvertConfig::m_bPocketCell = false;
+bool McCadConvertConfig::m_bEstimateOnly = false;
+bool McCadConvertConfig::m_bResume = false;
+bool McCadConvertConfig::m_bFusedPipeline = false;
+bool McCadConvertConfig::m_bAdaptiveVoid = false;
+bool McCadConvertConfig::m_bCheckClassify = false;
 
 double McCadConvertConfig::m_dTolerance = 1.0e-7;
 double McCadConvertConfig::m_dMinIptSolidVol = 1.0;
@@ -26,6 +36,17 @@ unsigned int McCadConvertConfig::m_iMinSmplPntNum = 20;
 
 unsigned int McCadConvertConfig::m_iInitVoidBoxNum = 1;
 
+unsigned int McCadConvertConfig::m_iSplitSpeculateNum = 0;
+TCollection_AsciiString McCadConvertConfig::m_strSplitCostFile = "";
+TCollection_AsciiString McCadConvertConfig::m_strAstSurfGens = "CylnCyln,CylnPln";
+TCollection_AsciiString McCadConvertConfig::m_strEstimateFile = "";
+TCollection_AsciiString McCadConvertConfig::m_strCheckpointDir = "";
+unsigned int McCadConvertConfig::m_iCheckpointInterval = 100;
+
+unsigned int McCadConvertConfig::m_iBooleanRetryNum = 3;
+double McCadConvertConfig::m_dBooleanFuzzyValue = 1.0e-6;
+double McCadConvertConfig::m_dBooleanPerturbation = 1.0e-6;
+
 TCollection_AsciiString McCadConvertConfig::m_strInputFileName = "";
 TCollection_AsciiString McCadConvertConfig::m_strMatFile = "";
 TCollection_AsciiString McCadConvertConfig::m_strDirectory = "";
@@ -279,6 +300,52 @@ bool McCadConvertConfig::ReadPrmt(const TCollection_AsciiString InputFileName)
                 else
                     m_iInitVoidBoxNum = numString.IntegerValue();
             }
+            else if(iString.IsEqual("SPLITSPECULATENUMBER")) {
+                if(!numString.IsIntegerValue())
+                    MissmatchMessage(iString,numString);
+                else
+                    m_iSplitSpeculateNum = numString.IntegerValue();
+            }
+            else if(iString.IsEqual("SPLITCOSTFILE")) {
+                    if(numString.IsEqual("None") || numString.IsEqual("none")
+                       || numString.IsEqual("NONE"))
+                        m_strSplitCostFile = "";    // No recording of the split costs
+                    else
+                        m_strSplitCostFile = numString;
+            }
+            else if(iString.IsEqual("ASTSURFGENERATORS")) {
+                    m_strAstSurfGens = numString;
+            }
+            else if(iString.IsEqual("ESTIMATEFILE")) {
+                    m_strEstimateFile = numString;
+            }
+            else if(iString.IsEqual("CHECKPOINTDIRECTORY")) {
+                    m_strCheckpointDir = numString;
+            }
+            else if(iString.IsEqual("CHECKPOINTINTERVAL")) {
+                if(!numString.IsIntegerValue())
+                    MissmatchMessage(iString,numString);
+                else
+                    m_iCheckpointInterval = numString.IntegerValue();
+            }
+            else if(iString.IsEqual("BOOLEANRETRYNUMBER")) {
+                if(!numString.IsIntegerValue())
+                    MissmatchMessage(iString,numString);
+                else
+                    m_iBooleanRetryNum = numString.IntegerValue();
+            }
+            else if(iString.IsEqual("BOOLEANFUZZYVALUE")) {
+                if(!numString.IsRealValue())
+                    MissmatchMessage(iString,numString);
+                else
+                    m_dBooleanFuzzyValue = numString.RealValue();
+            }
+            else if(iString.IsEqual("BOOLEANPERTURBATION")) {
+                if(!numString.IsRealValue())
+                    MissmatchMessage(iString,numString);
+                else
+                    m_dBooleanPerturbation = numString.RealValue();
+            }
             else if(iString.IsEqual("VOIDGENERATE")) {
                 if( numString.IsEqual("Yes")    || numString.IsEqual("yes") ||
                     numString.IsEqual("YES") || numString.IsEqual("1")  )
@@ -288,6 +355,96 @@ bool McCadConvertConfig::ReadPrmt(const TCollection_AsciiString InputFileName)
                 else
                     m_bVoidGenerate = false;
             }
+            else if(iString.IsEqual("PLANARBSPDECOMPOSE")) {
+                if( numString.IsEqual("Yes")    || numString.IsEqual("yes") ||
+                    numString.IsEqual("YES") || numString.IsEqual("1")  )
+                {
+                    m_bPlanarBSP = true;
+                }
+                else
+                    m_bPlanarBSP = false;
+            }
+            else if(iString.IsEqual("MERGECONVEXSOLIDS")) {
+                if( numString.IsEqual("Yes")    || numString.IsEqual("yes") ||
+                    numString.IsEqual("YES") || numString.IsEqual("1")  )
+                {
+                    m_bMergeConvex = true;
+                }
+                else
+                    m_bMergeConvex = false;
+            }
+            else if(iString.IsEqual("SURFACEREUSE")) {
+                if( numString.IsEqual("Yes")    || numString.IsEqual("yes") ||
+                    numString.IsEqual("YES") || numString.IsEqual("1")  )
+                {
+                    m_bReuseSurf = true;
+                }
+                else
+                    m_bReuseSurf = false;
+            }
+            else if(iString.IsEqual("SYMBOLICDECOMPOSE")) {
+                if( numString.IsEqual("Yes")    || numString.IsEqual("yes") ||
+                    numString.IsEqual("YES") || numString.IsEqual("1")  )
+                {
+                    m_bSymbolic = true;
+                }
+                else
+                    m_bSymbolic = false;
+            }
+            else if(iString.IsEqual("HULLMINUSPOCKETS")) {
+                if( numString.IsEqual("Yes")    || numString.IsEqual("yes") ||
+                    numString.IsEqual("YES") || numString.IsEqual("1")  )
+                {
+                    m_bPocketCell = true;
+                }
+                else
+                    m_bPocketCell = false;
+            }
+            else if(iString.IsEqual("DECOMPOSEESTIMATE")) {
+                if( numString.IsEqual("Yes")    || numString.IsEqual("yes") ||
+                    numString.IsEqual("YES") || numString.IsEqual("1")  )
+                {
+                    m_bEstimateOnly = true;
+                }
+                else
+                    m_bEstimateOnly = false;
+            }
+            else if(iString.IsEqual("RESUMEDECOMPOSE")) {
+                if( numString.IsEqual("Yes")    || numString.IsEqual("yes") ||
+                    numString.IsEqual("YES") || numString.IsEqual("1")  )
+                {
+                    m_bResume = true;
+                }
+                else
+                    m_bResume = false;
+            }
+            else if(iString.IsEqual("DECOMPOSEBEFORECONVERT")) {
+                if( numString.IsEqual("Yes")    || numString.IsEqual("yes") ||
+                    numString.IsEqual("YES") || numString.IsEqual("1")  )
+                {
+                    m_bFusedPipeline = true;
+                }
+                else
+                    m_bFusedPipeline = false;
+            }
+            else if(iString.IsEqual("ADAPTIVEVOIDSPLIT")) {
+                if( numString.IsEqual("Yes")    || numString.IsEqual("yes") ||
+                    numString.IsEqual("YES") || numString.IsEqual("1")  )
+                {
+                    m_bAdaptiveVoid = true;
+                }
+                else
+                    m_bAdaptiveVoid = false;
+            }
+            else if(iString.IsEqual("CHECKPOINTCLASSIFY")) {
+                if( numString.IsEqual("Yes")    || numString.IsEqual("yes") ||
+                    numString.IsEqual("YES") || numString.IsEqual("1")  )
+                {
+                    m_bCheckClassify = true;
+                }
+                else
+                    m_bCheckClassify = false;
+            }
             else if(iString.IsEqual("UNITS")) {
                 if(numString.IsEqual("CM") || numString.IsEqual("cm"))
                     m_units = McCadGeom_CM;
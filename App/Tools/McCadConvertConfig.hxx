@@ -39,6 +39,16 @@ private:
 
     static bool m_bWriteCollisionFile;           /**< Whether write collision file or not */
     static bool m_bVoidGenerate;                 /**< Whether generate the void */
+    static bool m_bPlanarBSP;                    /**< Whether decompose the planar solids with BSP kernel */
+    static bool m_bMergeConvex;                  /**< Whether merge the adjacent convex solids after decomposition */
+    static bool m_bReuseSurf;                    /**< Whether prefer the splitting surfaces used in the model */
+    static bool m_bSymbolic;                     /**< Whether decompose the analytic solids by sign vectors */
+    static bool m_bPocketCell;                   /**< Whether keep the solid with convex pockets as one cell */
+    static bool m_bEstimateOnly;                 /**< Whether only estimate the decomposition cost */
+    static bool m_bResume;                       /**< Whether resume the decomposition from checkpoints */
+    static bool m_bFusedPipeline;                /**< Whether decompose and convert the model in one run */
+    static bool m_bAdaptiveVoid;                 /**< Whether split the void space adaptively with the solids */
+    static bool m_bCheckClassify;                /**< Whether check the point classification with BRep classifier */
 
     static double m_dTolerance;                  /**< Tolerence, the value less than tolerence will be treat as zero*/
     static double m_dMinIptSolidVol;             /**< The minimum volume of input solid */
@@ -56,6 +66,17 @@ private:
 
     static unsigned int m_iInitVoidBoxNum;       /**< Initial number of void boxes, n means n*n*n(x*y*z) void boxes */
 
+    static unsigned int m_iSplitSpeculateNum;    /**< Number of candidate splitting surfaces tried in parallel, 0 or 1 is off */
+    static TCollection_AsciiString m_strSplitCostFile;   /**< Record file of the splitting cost model */
+    static TCollection_AsciiString m_strAstSurfGens;     /**< Names of assisted surface generators, separated by "," */
+    static TCollection_AsciiString m_strEstimateFile;    /**< Record file of the decomposition cost estimator */
+    static TCollection_AsciiString m_strCheckpointDir;   /**< Run directory of decomposition checkpoints */
+    static unsigned int m_iCheckpointInterval;   /**< Number of solids between two checkpoints */
+
+    static unsigned int m_iBooleanRetryNum;      /**< Number of retries with increasing fuzzy value */
+    static double m_dBooleanFuzzyValue;          /**< Fuzzy value of the first retry */
+    static double m_dBooleanPerturbation;        /**< Moving distance of splitting surface, relative to solid size */
+
     static unsigned int m_iMaxSmplPntNum;        /**< Max sample point number */
     static unsigned int m_iMinSmplPntNum;        /**< Min sample point number */
 
@@ -77,6 +98,16 @@ public:
     Standard_EXPORT static bool ReadPrmt(const TCollection_AsciiString InputFileName);
     Standard_EXPORT static bool WriteCollisionFile(){return m_bWriteCollisionFile;};
     Standard_EXPORT static bool GenerateVoid(){return m_bVoidGenerate;};
+    Standard_EXPORT static bool UsePlanarBSP(){return m_bPlanarBSP;};
+    Standard_EXPORT static bool MergeConvexSolids(){return m_bMergeConvex;};
+    Standard_EXPORT static bool ReuseSurfaces(){return m_bReuseSurf;};
+    Standard_EXPORT static bool SymbolicDecompose(){return m_bSymbolic;};
+    Standard_EXPORT static bool HullMinusPockets(){return m_bPocketCell;};
+    Standard_EXPORT static bool EstimateOnly(){return m_bEstimateOnly;};
+    Standard_EXPORT static bool ResumeDecompose(){return m_bResume;};
+    Standard_EXPORT static bool DecomposeBeforeConvert(){return m_bFusedPipeline;};
+    Standard_EXPORT static bool AdaptiveVoidSplit(){return m_bAdaptiveVoid;};
+    Standard_EXPORT static bool CheckPointClassify(){return m_bCheckClassify;};
 
     Standard_EXPORT static double GetTolerence(){return m_dTolerance;};
     Standard_EXPORT static double GetAngleTolerance(){return m_dAngleTolerance;};
@@ -94,6 +125,15 @@ public:
     Standard_EXPORT static unsigned int GetMaxSmplPntNum(){return m_iMaxSmplPntNum;};
     Standard_EXPORT static unsigned int GetMinSmplPntNum(){return m_iMinSmplPntNum;};
     Standard_EXPORT static unsigned int GetInitVoidBoxNum(){return m_iInitVoidBoxNum;};
+    Standard_EXPORT static unsigned int GetSplitSpeculateNum(){return m_iSplitSpeculateNum;};
+    Standard_EXPORT static TCollection_AsciiString GetSplitCostFile(){return m_strSplitCostFile;};
+    Standard_EXPORT static TCollection_AsciiString GetAstSurfGenerators(){return m_strAstSurfGens;};
+    Standard_EXPORT static TCollection_AsciiString GetEstimateFile(){return m_strEstimateFile;};
+    Standard_EXPORT static TCollection_AsciiString GetCheckpointDir(){return m_strCheckpointDir;};
+    Standard_EXPORT static unsigned int GetCheckpointInterval(){return m_iCheckpointInterval;};
+    Standard_EXPORT static unsigned int GetBooleanRetryNum(){return m_iBooleanRetryNum;};
+    Standard_EXPORT static double GetBooleanFuzzyValue(){return m_dBooleanFuzzyValue;};
+    Standard_EXPORT static double GetBooleanPerturbation(){return m_dBooleanPerturbation;};
 
     Standard_EXPORT static TCollection_AsciiString GetInputFileName(){return m_strInputFileName;};
     Standard_EXPORT static TCollection_AsciiString GetMatFile(){return m_strMatFile;};
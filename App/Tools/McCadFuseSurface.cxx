@@ -13,7 +13,6 @@
 #include <GeomAdaptor_Curve.hxx>
 #include <TopAbs_Orientation.hxx>
 #include <TopExp_Explorer.hxx>
-#include <McCadMessenger_Singleton.hxx>
 #include <TopoDS.hxx>
 #include <STEPControl_Writer.hxx>
 #include <BRepBuilderAPI_MakeFace.hxx>
@@ -29,15 +28,15 @@
 
 #include <ShapeFix_Shape.hxx>
 
-#include "../McCadMcVoid/IGeomFace.hxx"
-#include "../McCadMcVoid/McCadGeomPlane.hxx"
-#include "../McCadMcVoid/McCadGeomCylinder.hxx"
-#include "../McCadMcVoid/McCadGeomCone.hxx"
-#include "../McCadMcVoid/McCadGeomSphere.hxx"
-#include "../McCadMcVoid/McCadGeomTorus.hxx"
-#include "../McCadMcVoid/McCadGeomRevolution.hxx"
-#include "../McCadTool/McCadConvertConfig.hxx"
-#include "../McCadTool/McCadMathTool.hxx"
+#include "../Convertor/IGeomFace.hxx"
+#include "../Convertor/McCadGeomPlane.hxx"
+#include "../Convertor/McCadGeomCylinder.hxx"
+#include "../Convertor/McCadGeomCone.hxx"
+#include "../Convertor/McCadGeomSphere.hxx"
+#include "../Convertor/McCadGeomTorus.hxx"
+#include "../Convertor/McCadGeomRevolution.hxx"
+#include "../Tools/McCadConvertConfig.hxx"
+#include "../Tools/McCadMathTool.hxx"
 
 McCadFuseSurface::McCadFuseSurface()
 {
@@ -865,7 +864,6 @@ bool McCadFuseSurface::FuseCylinders()
         return false;
     }
 
-    McCadMessenger_Singleton *msgr = McCadMessenger_Singleton::Instance();
 
     try
     {
@@ -874,8 +872,7 @@ bool McCadFuseSurface::FuseCylinders()
     }
     catch(...)
     {
-        msgr->Message("_#_McCadFuseSurface :: Boolean Fuse Operation crashed!!!\n",
-                              McCadMessenger_WarningMsg); 
+        cout<<"_#_McCadFuseSurface :: Boolean Fuse Operation crashed!!!"<<endl; 
 
         return false;
     }
@@ -883,8 +880,7 @@ bool McCadFuseSurface::FuseCylinders()
     BRepCheck_Analyzer face_analyzer(m_newSurf, true);  // check validity of Result
     if(!face_analyzer.IsValid())
     {
-        msgr->Message("_#_McCadFuseSurface :: The fused surface is not available\n",
-                              McCadMessenger_WarningMsg);
+        cout<<"_#_McCadFuseSurface :: The fused surface is not available"<<endl;
 
         return false;
     }
@@ -939,7 +935,6 @@ bool McCadFuseSurface::CombineSurfs()
         return false;
     }   
 
-    McCadMessenger_Singleton *msgr = McCadMessenger_Singleton::Instance();
     try
     {
         m_combSurf = CrtNewSurf();
@@ -956,16 +951,14 @@ bool McCadFuseSurface::CombineSurfs()
     }
     catch(...)
     {
-        msgr->Message("_#_McCadFuseSurface :: Boolean combination operation crashed!!!\n",
-                              McCadMessenger_WarningMsg);
+        cout<<"_#_McCadFuseSurface :: Boolean combination operation crashed!!!"<<endl;
         return false;
     }
 
     BRepCheck_Analyzer face_analyzer(m_combSurf, true);  // check validity of Result
     if(!face_analyzer.IsValid())
     {
-        msgr->Message("_#_McCadFuseSurface :: The combined surface is not available\n",
-                              McCadMessenger_WarningMsg);
+        cout<<"_#_McCadFuseSurface :: The combined surface is not available"<<endl;
 
         return false;
     }
@@ -26,3 +26,35 @@ void McCadGeneTool::WriteFile( TCollection_AsciiString outFileName,
 //    writerPlugin->SetFilename(outFileName);
 //    writerPlugin->Export(shapes);
 }
+
+
+
+/** ********************************************************************
+* @brief  Add the prefix to the name of file, the directory of the path
+*         is kept, e.g. "Error_" and "/work/Model.stp" give
+*         "/work/Error_Model.stp"
+*
+* @param  thePrefix (const TCollection_AsciiString &)
+*         theFileName (const TCollection_AsciiString &)
+* @return TCollection_AsciiString
+*
+* @date 19/10/2026
+* @author  agent
+***********************************************************************/
+TCollection_AsciiString McCadGeneTool::PrefixFileName(const TCollection_AsciiString &thePrefix,
+                                                      const TCollection_AsciiString &theFileName)
+{
+    Standard_Integer iSlash = Max(theFileName.SearchFromEnd("/"), theFileName.SearchFromEnd("\\"));
+    if(iSlash <= 0)
+    {
+        return thePrefix + theFileName;
+    }
+
+    TCollection_AsciiString strDir = theFileName.SubString(1, iSlash);
+    TCollection_AsciiString strName;
+    if(iSlash < theFileName.Length())
+    {
+        strName = theFileName.SubString(iSlash+1, theFileName.Length());
+    }
+    return strDir + thePrefix + strName;
+}
@@ -27,6 +27,9 @@ public:
     Standard_EXPORT static TCollection_AsciiString ToAsciiString(const QString& theStr);
     Standard_EXPORT static void WriteFile( TCollection_AsciiString outFileName,
                                     Handle_TopTools_HSequenceOfShape shapes);
+    /**< Add the prefix to the file name, the directory of the path is kept */
+    Standard_EXPORT static TCollection_AsciiString PrefixFileName(const TCollection_AsciiString &thePrefix,
+                                                                  const TCollection_AsciiString &theFileName);
 };
 
 #endif // MCCADGENETOOL_HXX
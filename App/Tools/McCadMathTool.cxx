@@ -90,3 +90,93 @@ Standard_Real McCadMathTool::MaxValue(Standard_Real value1,
     return MAX3(value1,value2,value3);
 }
 
+
+
+/** ********************************************************************
+* @brief  Fit the weights of a linear model with least squares. The
+*         normal equations are solved by Gaussian elimination with
+*         partial pivoting. At least two records for each feature are
+*         required, the weights are not changed if it fails.
+*
+* @param  theRows (const vector< vector<Standard_Real> > &)  Features of records
+*         theValues (const vector<Standard_Real> &)  Measured values
+*         theWeight (vector<Standard_Real> &)  Fitted weights
+* @return Standard_Boolean
+*
+* @date 19/10/2026
+* @author  agent
+***********************************************************************/
+Standard_Boolean McCadMathTool::FitLeastSquares(const vector< vector<Standard_Real> > &theRows,
+                                                const vector<Standard_Real> &theValues,
+                                                vector<Standard_Real> &theWeight)
+{
+    if(theRows.empty() || theRows.size() != theValues.size())
+    {
+        return Standard_False;
+    }
+
+    int iNbFeature = theRows.at(0).size();
+    if(iNbFeature == 0 || theRows.size() < 2*(unsigned int)iNbFeature)
+    {
+        return Standard_False;
+    }
+
+    /// Normal equations (A^T A) w = A^T b
+    vector< vector<Standard_Real> > fMatrix(iNbFeature, vector<Standard_Real>(iNbFeature+1, 0.0));
+    for(unsigned int k = 0; k < theRows.size(); k++)
+    {
+        for(int i = 0; i < iNbFeature; i++)
+        {
+            for(int j = 0; j < iNbFeature; j++)
+            {
+                fMatrix[i][j] += theRows.at(k).at(i)*theRows.at(k).at(j);
+            }
+            fMatrix[i][iNbFeature] += theRows.at(k).at(i)*theValues.at(k);
+        }
+    }
+
+    /// A small ridge keeps the features which never change solvable
+    for(int i = 0; i < iNbFeature; i++)
+    {
+        fMatrix[i][i] += 1.0e-6*theRows.size();
+    }
+
+    for(int k = 0; k < iNbFeature; k++)
+    {
+        int iPivot = k;
+        for(int i = k+1; i < iNbFeature; i++)
+        {
+            if(Abs(fMatrix[i][k]) > Abs(fMatrix[iPivot][k]))
+            {
+                iPivot = i;
+            }
+        }
+        if(Abs(fMatrix[iPivot][k]) < 1.0e-12)
+        {
+            return Standard_False;
+        }
+        swap(fMatrix[k],fMatrix[iPivot]);
+        for(int i = k+1; i < iNbFeature; i++)
+        {
+            Standard_Real fFactor = fMatrix[i][k]/fMatrix[k][k];
+            for(int j = k; j <= iNbFeature; j++)
+            {
+                fMatrix[i][j] -= fFactor*fMatrix[k][j];
+            }
+        }
+    }
+
+    vector<Standard_Real> fWeight(iNbFeature, 0.0);
+    for(int i = iNbFeature-1; i >= 0; i--)
+    {
+        Standard_Real fSum = fMatrix[i][iNbFeature];
+        for(int j = i+1; j < iNbFeature; j++)
+        {
+            fSum -= fMatrix[i][j]*fWeight[j];
+        }
+        fWeight[i] = fSum/fMatrix[i][i];
+    }
+
+    theWeight = fWeight;
+    return Standard_True;
+}
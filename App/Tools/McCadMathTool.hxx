@@ -2,6 +2,7 @@
 #define MCCADMATHTOOL_HXX
 
 #include <Standard.hxx>
+#include <vector>
 
 #include <TCollection_AsciiString.hxx>
 #include <QString>
@@ -9,6 +10,8 @@
 #define MAX2(X, Y)	(Abs(X) > Abs(Y)? Abs(X) : Abs(Y))
 #define MAX3(X, Y, Z)	(MAX2(MAX2(X,Y) , Z) )
 
+using namespace std;
+
 class McCadMathTool
 {
 public:
@@ -37,6 +40,10 @@ public:
     Standard_EXPORT static void ZeroValue(Standard_Real &theValue, Standard_Real dTolerance);
     /**< Reture the max one of the three input values */
     Standard_EXPORT static Standard_Real MaxValue(Standard_Real value1, Standard_Real value2, Standard_Real value3);
+    /**< Fit the weights of a linear model by least squares with a small ridge */
+    Standard_EXPORT static Standard_Boolean FitLeastSquares(const vector< vector<Standard_Real> > &theRows,
+                                                            const vector<Standard_Real> &theValues,
+                                                            vector<Standard_Real> &theWeight);
 
 };
 
@@ -59,6 +59,7 @@
 #include "McCadLostParticle.h"
 #include "McCadExporter.h"
 #include "McCadConvertorDlg.h"
+#include "McCadDecomposeDlg.h"
 #include "MatDlg.h"
 #include "McCadSettingDlg.h"
 #include "ConfigDlg.h"
@@ -374,10 +375,17 @@ CmdMcCadDecompose::CmdMcCadDecompose()
 
 void CmdMcCadDecompose::activated(int iMsg)
 {
-    MatDlg *pMatDlg = new MatDlg();
-    pMatDlg->setFixedSize(pMatDlg->width(),pMatDlg->height());
-    pMatDlg->setModal(true);
-    pMatDlg->show();
+    static QWeakPointer<McCadDecomposeDlg>pp;
+    if(!pp)
+    {
+        pp = new McCadDecomposeDlg();
+    }
+
+    McCadDecomposeDlg *pDlg = pp.data();
+    pDlg->setAttribute(Qt::WA_DeleteOnClose);
+    pDlg->show();
+    pDlg->raise();
+    pDlg->activateWindow();
 }
 
 
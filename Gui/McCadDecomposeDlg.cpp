@@ -0,0 +1,271 @@
+#include "PreCompiled.h"
+
+#include <QVBoxLayout>
+#include <QHBoxLayout>
+#include <qdir.h>
+
+#include "McCadDecomposeDlg.h"
+
+#include <App/Application.h>
+#include <App/Document.h>
+#include <App/DocumentObjectGroup.h>
+#include <Gui/Application.h>
+#include <Gui/Document.h>
+#include <Gui/Selection.h>
+#include <Gui/ViewProvider.h>
+#include <Gui/WorkbenchManager.h>
+
+#include <Mod/Part/App/PartFeature.h>
+
+#include <TopExp_Explorer.hxx>
+#include <TopoDS.hxx>
+
+#include "../App/Decompose/McCadDcompProgress.hxx"
+#include "Workbench.h"
+
+using namespace McCadGui;
+
+McCadDecomposeDlg::McCadDecomposeDlg(QWidget *parent):
+    QDialog(parent)
+{
+    m_bClosing = false;
+
+    setWindowTitle(tr("Decompose"));
+    setWindowFlags(Qt::Window | Qt::CustomizeWindowHint | Qt::WindowMinimizeButtonHint | Qt::WindowCloseButtonHint);
+
+    m_pLabel = new QLabel(this);
+    m_pProgressBar = new QProgressBar(this);
+    m_pProgressBar->setMinimum(0);
+    m_pProgressBar->setMaximum(100);
+    m_pProgressBar->setValue(0);
+
+    m_pBntStart = new QPushButton(tr("Start"), this);
+    m_pBntStop = new QPushButton(tr("Stop"), this);
+    m_pBntStop->setEnabled(false);
+
+    QHBoxLayout *pBntLayout = new QHBoxLayout();
+    pBntLayout->addStretch();
+    pBntLayout->addWidget(m_pBntStart);
+    pBntLayout->addWidget(m_pBntStop);
+
+    QVBoxLayout *pLayout = new QVBoxLayout(this);
+    pLayout->addWidget(m_pLabel);
+    pLayout->addWidget(m_pProgressBar);
+    pLayout->addLayout(pBntLayout);
+
+    m_pTimer = new QTimer(this);
+    m_pTimer->setInterval(500);
+
+    pDecomposer = new McCadDecomposition();
+
+    connect(m_pBntStart, SIGNAL(clicked()), this, SLOT(StartDecomposition()));
+    connect(m_pBntStop, SIGNAL(clicked()), this, SLOT(StopDecomposition()));
+    connect(m_pTimer, SIGNAL(timeout()), this, SLOT(UpdateProgress()));
+    connect(pDecomposer, SIGNAL(finished()), this, SLOT(FinishDecomposition()));
+
+    if(!LoadSolids())
+    {
+        m_pLabel->setText(tr("No solid is found in the active document."));
+        m_pBntStart->setEnabled(false);
+    }
+    else
+    {
+        m_pLabel->setText(tr("%1 solids will be decomposed.").arg(m_SolidList->Length()));
+    }
+}
+
+McCadDecomposeDlg::~McCadDecomposeDlg()
+{
+    if(pDecomposer)
+    {
+        delete pDecomposer;
+        pDecomposer = NULL;
+    }
+}
+
+
+void McCadDecomposeDlg::closeEvent(QCloseEvent * event)
+{
+    /// Cancel the running thread and close when it finishes, not block the gui
+    if(pDecomposer->isRunning())
+    {
+        m_bClosing = true;
+        StopDecomposition();
+        event->ignore();
+        return;
+    }
+
+    m_pTimer->stop();
+    AddPieces();
+    event->accept();
+}
+
+
+bool McCadDecomposeDlg::LoadSolids()
+{
+    m_SolidList = new TopTools_HSequenceOfShape;
+
+    App::Document *doc = App::GetApplication().getActiveDocument();
+    if(!doc)
+    {
+        return false;
+    }
+    m_strDocName = doc->getName();
+
+    /** Get the config file in the working directory, the output files are
+        named after the document and saved in the same directory */
+    m_strModelFile = QString::fromStdString(m_strDocName) + QString::fromLatin1(".stp");
+    McCadGui::Workbench *wb = (McCadGui::Workbench *)Gui::WorkbenchManager::instance()->active();
+    McCadData *pData = wb ? wb->GetDataManager()->getData(m_strDocName) : NULL;
+    if(pData && !pData->GetWorkingDir().isEmpty())
+    {
+        QDir dir(pData->GetWorkingDir());
+        if(dir.exists(QString::fromLatin1("McCadConfig.txt")))
+        {
+            m_strConfigFile = pData->GetWorkingDir() + QString::fromLatin1("/McCadConfig.txt");
+        }
+        m_strModelFile = pData->GetWorkingDir() + QString::fromLatin1("/") + m_strModelFile;
+    }
+
+    /** The selected solids are decomposed, or all visible solids if none is selected */
+    vector<App::DocumentObject*> obj_list
+            = Gui::Selection().getObjectsOfType(Part::Feature::getClassTypeId(), doc->getName());
+    if(obj_list.empty())
+    {
+        Gui::Document *pGuiDoc = Gui::Application::Instance->getDocument(doc);
+        vector<App::DocumentObject*> all_list = doc->getObjectsOfType(Part::Feature::getClassTypeId());
+        for(unsigned int i = 0; i < all_list.size(); i++)
+        {
+            Gui::ViewProvider *vp = pGuiDoc ? pGuiDoc->getViewProvider(all_list.at(i)) : NULL;
+            if (vp && vp->isVisible())
+            {
+                obj_list.push_back(all_list.at(i));
+            }
+        }
+    }
+
+    for(unsigned int i = 0; i < obj_list.size(); i++)
+    {
+        Part::Feature *feature = static_cast<Part::Feature *>(obj_list.at(i));
+        const TopoDS_Shape & shape = feature->Shape.getValue();
+        if(shape.IsNull())
+        {
+            continue;
+        }
+
+        for(TopExp_Explorer ex(shape,TopAbs_SOLID); ex.More(); ex.Next())
+        {
+            m_SolidList->Append(TopoDS::Solid(ex.Current()));
+        }
+    }
+
+    return m_SolidList->Length() > 0;
+}
+
+
+void McCadDecomposeDlg::StartDecomposition()
+{
+    if(pDecomposer->isRunning())
+    {
+        return;
+    }
+
+    /// Take the run before the thread starts, a stop at once is not lost, and
+    /// the shared status is not touched by a conversion at the same time
+    if(!McCadDcompProgress::Acquire())
+    {
+        m_pLabel->setText(tr("Another decomposition or conversion is running."));
+        return;
+    }
+
+    m_pBntStart->setEnabled(false);
+    m_pBntStop->setEnabled(true);
+    m_pProgressBar->setValue(0);
+    m_strGroupName.clear();
+
+    pDecomposer->Setting(m_strConfigFile, m_strModelFile, m_SolidList);
+    pDecomposer->start();
+    m_pTimer->start();
+}
+
+
+void McCadDecomposeDlg::StopDecomposition()
+{
+    if(pDecomposer->isRunning())
+    {
+        pDecomposer->stop();
+        m_pBntStop->setEnabled(false);
+        m_pLabel->setText(tr("Stop the decomposition ..."));
+    }
+}
+
+
+void McCadDecomposeDlg::UpdateProgress()
+{
+    Standard_Integer iSolidNum, iFinished, iLevel, iPieceNum;
+    McCadDcompProgress::GetStatus(iSolidNum, iFinished, iLevel, iPieceNum);
+
+    if(iSolidNum > 0)
+    {
+        m_pProgressBar->setValue(iFinished*100/iSolidNum);
+    }
+    m_pLabel->setText(tr("Solids %1 / %2,   level %3,   decomposed solids %4")
+                      .arg(iFinished).arg(iSolidNum).arg(iLevel).arg(iPieceNum));
+
+    AddPieces();
+}
+
+
+void McCadDecomposeDlg::FinishDecomposition()
+{
+    m_pTimer->stop();
+    UpdateProgress();
+
+    m_pBntStart->setEnabled(true);
+    m_pBntStop->setEnabled(false);
+
+    /// The dialog waits for the thread to close
+    if(m_bClosing)
+    {
+        close();
+    }
+}
+
+
+void McCadDecomposeDlg::AddPieces()
+{
+    vector<TopoDS_Shape> piece_list;
+    McCadDcompProgress::TakePieces(piece_list);
+    if(piece_list.empty())
+    {
+        return;
+    }
+
+    App::Document *doc = App::GetApplication().getDocument(m_strDocName.c_str());
+    if(!doc)
+    {
+        return;
+    }
+
+    /** The decomposed solids of each input solid are added as one compound */
+    App::DocumentObjectGroup *pGroup
+            = dynamic_cast<App::DocumentObjectGroup*>(doc->getObject(m_strGroupName.c_str()));
+    if(!pGroup)
+    {
+        pGroup = new App::DocumentObjectGroup();
+        doc->addObject(pGroup, "Decomposed");
+        m_strGroupName = pGroup->getNameInDocument();
+    }
+
+    for(unsigned int i = 0; i < piece_list.size(); i++)
+    {
+        Part::Feature *feature = static_cast<Part::Feature *>(doc->addObject("Part::Feature","Decomposed"));
+        feature->Shape.setValue(piece_list.at(i));
+        pGroup->addObject(feature);
+    }
+
+    doc->recompute();
+}
+
+
+#include "moc_McCadDecomposeDlg.cpp"
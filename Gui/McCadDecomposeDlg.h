@@ -0,0 +1,58 @@
+#ifndef MCCADDECOMPOSEDLG_H
+#define MCCADDECOMPOSEDLG_H
+
+#include <QDialog>
+#include <QCloseEvent>
+#include <QLabel>
+#include <QProgressBar>
+#include <QPushButton>
+#include <QTimer>
+
+#include <string>
+#include <TopTools_HSequenceOfShape.hxx>
+
+#include "../App/McCadDecomposition.h"
+
+using namespace std;
+
+class McCadDecomposeDlg : public QDialog
+{
+    Q_OBJECT
+
+public:
+
+    explicit McCadDecomposeDlg(QWidget *parent = 0);
+    ~McCadDecomposeDlg();
+
+private Q_SLOTS:
+
+    void StartDecomposition();
+    void StopDecomposition();
+    void UpdateProgress();                  // Read the progress of background decomposition
+    void FinishDecomposition();             // The background decomposition is finished
+
+private:
+
+    bool LoadSolids();                      // Collect the selected solids, or all visible solids
+    void AddPieces();                       // Add the new decomposed solids into the document
+
+    QLabel * m_pLabel;
+    QProgressBar * m_pProgressBar;
+    QPushButton * m_pBntStart;
+    QPushButton * m_pBntStop;
+    QTimer * m_pTimer;                      // Refresh the progress, not for every solid
+
+    McCadDecomposition * pDecomposer;
+    Handle(TopTools_HSequenceOfShape) m_SolidList;      // The solids to be decomposed
+    QString m_strConfigFile;                // The config file in the working directory
+    QString m_strModelFile;                 // The name of output files, after the document
+    string m_strDocName;                    // The document of the solids
+    string m_strGroupName;                  // The group of decomposed solids
+    bool m_bClosing;                        // Close the dialog when the thread finishes
+
+protected:
+    void closeEvent(QCloseEvent * event);
+
+};
+
+#endif // MCCADDECOMPOSEDLG_H
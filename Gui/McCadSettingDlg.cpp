@@ -55,6 +55,8 @@ void McCadSettingDlg::SetDefaultPrmt()
     m_vecPrmt.push_back(make_pair(tr("InitSurfNb"),tr("1")));
     m_vecPrmt.push_back(make_pair(tr("WriteCollisionFile"),tr("Yes")));    
     m_vecPrmt.push_back(make_pair(tr("InitialVoidBoxNumber"),tr("1")));
+    m_vecPrmt.push_back(make_pair(tr("AdaptiveVoidSplit"),tr("No")));
+    m_vecPrmt.push_back(make_pair(tr("CheckPointClassify"),tr("No")));
     m_vecPrmt.push_back(make_pair(tr("MinimumInputSolidVolume"),tr("1.00")));
     m_vecPrmt.push_back(make_pair(tr("MinimumVoidVolume"),tr("1.25e2")));
     m_vecPrmt.push_back(make_pair(tr("MinimumSizeOfDecompositionFaceArea"),tr("50")));
@@ -68,6 +70,21 @@ void McCadSettingDlg::SetDefaultPrmt()
     m_vecPrmt.push_back(make_pair(tr("RResolution"),tr("0.00314")));
     m_vecPrmt.push_back(make_pair(tr("MaxDecomposeDepth"),tr("15")));    
     m_vecPrmt.push_back(make_pair(tr("MaxCellExpressionLength"),tr("500")));
+    m_vecPrmt.push_back(make_pair(tr("SplitSpeculateNumber"),tr("0")));
+    m_vecPrmt.push_back(make_pair(tr("SplitCostFile"),tr("None")));
+    m_vecPrmt.push_back(make_pair(tr("AstSurfGenerators"),tr("CylnCyln,CylnPln")));
+    m_vecPrmt.push_back(make_pair(tr("PlanarBSPDecompose"),tr("No")));
+    m_vecPrmt.push_back(make_pair(tr("MergeConvexSolids"),tr("No")));
+    m_vecPrmt.push_back(make_pair(tr("SurfaceReuse"),tr("No")));
+    m_vecPrmt.push_back(make_pair(tr("SymbolicDecompose"),tr("No")));
+    m_vecPrmt.push_back(make_pair(tr("HullMinusPockets"),tr("No")));
+    m_vecPrmt.push_back(make_pair(tr("DecomposeEstimate"),tr("No")));
+    m_vecPrmt.push_back(make_pair(tr("CheckpointInterval"),tr("100")));
+    m_vecPrmt.push_back(make_pair(tr("ResumeDecompose"),tr("No")));
+    m_vecPrmt.push_back(make_pair(tr("DecomposeBeforeConvert"),tr("No")));
+    m_vecPrmt.push_back(make_pair(tr("BooleanRetryNumber"),tr("3")));
+    m_vecPrmt.push_back(make_pair(tr("BooleanFuzzyValue"),tr("1e-6")));
+    m_vecPrmt.push_back(make_pair(tr("BooleanPerturbation"),tr("1e-6")));
     m_vecPrmt.push_back(make_pair(tr("Tolerance"),tr("1e-4")));
     m_vecPrmt.push_back(make_pair(tr("VoidGenerate"),tr("Yes")));
 }
@@ -245,7 +262,12 @@ void McCadSettingDlg::UpdateTable()
         m_pModel->appendRow(itemPrmt);
         m_pModel->setItem(itemPrmt->row(),1,itemData);
 
-        if(pmrt.compare(tr("VoidGenerate")) == 0 || pmrt.compare(tr("WriteCollisionFile")) == 0)
+        if(pmrt.compare(tr("VoidGenerate")) == 0 || pmrt.compare(tr("WriteCollisionFile")) == 0
+           || pmrt.compare(tr("PlanarBSPDecompose")) == 0 || pmrt.compare(tr("MergeConvexSolids")) == 0
+           || pmrt.compare(tr("SurfaceReuse")) == 0 || pmrt.compare(tr("SymbolicDecompose")) == 0
+           || pmrt.compare(tr("HullMinusPockets")) == 0 || pmrt.compare(tr("DecomposeEstimate")) == 0
+           || pmrt.compare(tr("ResumeDecompose")) == 0 || pmrt.compare(tr("DecomposeBeforeConvert")) == 0
+           || pmrt.compare(tr("AdaptiveVoidSplit")) == 0 || pmrt.compare(tr("CheckPointClassify")) == 0)
         {
             ComboDelegate* delegate = new ComboDelegate();
             ui->treeViewConfig->setItemDelegateForRow(iRow, delegate);